@@ -333,8 +333,8 @@ public:
     // Return the list of sections found in ini file
     const std::set<std::string>& Sections() const;
 	
-    // Return the list of keys found in section
-	const std::set<std::string>& Keys(std::string section) const;
+    // Return the list of keys found in section (without copying or allocating)
+	const std::set<std::string>& Keys(const char* section) const;
     
     // Get a string value from INI file, returning default_value if not found.
     std::string Get(std::string section, std::string name,
@@ -376,7 +376,7 @@ protected:
     int _error;
     std::map<std::string, std::string> _values;
     std::set<std::string> _sections;
-    std::map<std::string, std::set<std::string> > _keys;
+    std::map<std::string, std::set<std::string>, std::less<> > _keys;
     static std::string MakeKey(std::string section, std::string name);
     static int ValueHandler(void* user, const char* section, const char* name,
                             const char* value);
@@ -412,9 +412,11 @@ inline const std::set<std::string>& INIReader::Sections() const
     return _sections;
 }
 
-inline const std::set<std::string>& INIReader::Keys(std::string section) const
+inline const std::set<std::string>& INIReader::Keys(const char* section) const
 {
-    return ((INIReader*)this)->_keys[section];
+    static const std::set<std::string> empty;
+    auto found = _keys.find(section);
+    return (found != _keys.end()) ? found->second : empty;
 }
 
 inline std::string INIReader::Get(std::string section, std::string name, std::string default_value) const
@@ -517,12 +519,12 @@ bool INIReader::Save(const char* path) const
 		return false;
 	}
 		
-	auto sections = Sections();
-	for (auto section : sections)
+	const auto& sections = Sections();
+	for (const auto& section : sections)
 	{
 		fprintf_s(file, "\n[%s]\n", section.c_str());
-		auto keys = Keys(section);
-		for (auto key : keys)
+		const auto& keys = Keys(section.c_str());
+		for (const auto& key : keys)
 		{
 			const char* val = this->GetRef(section, key, nullptr);
 			fprintf_s(file, "%s = %s\n", key.c_str(), val);
@@ -6,10 +6,11 @@
  */
 
 #pragma once
+#include <Sfx/Defs.h>
 
 // Register a proper playback speed effect handler for this channel according to the current audio format. Effect valid for the current (or next) playback only.
 struct Mix_Chunk;
-void Custom_Mix_RegisterPlaybackSpeedEffect(int channel, Mix_Chunk* chunk, float speed, int loop, Uint16 fmt);
+void Custom_Mix_RegisterPlaybackSpeedEffect(int channel, Mix_Chunk* chunk, float speed, int loop, bon::sfx::ResamplerQuality quality);
 
 // update sound specs after initializing sfx
 void Custom_Mix_UpdateSpecs();
\ No newline at end of file
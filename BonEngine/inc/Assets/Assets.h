@@ -7,8 +7,11 @@
  *********************************************************************/
 #pragma once
 #include "IAssets.h"
+#include "FileWatcher.h"
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <atomic>
 
 namespace bon
 {
@@ -31,8 +34,79 @@ namespace bon
 			// per-type counters
 			size_t _counts[(int)AssetTypes::_Count] = { 0 };
 
+			/**
+			 * Key to find assets in cache.
+			 * Hash is calculated once per lookup, directly from the path string, so we don't need to build temporary strings.
+			 */
+			struct CacheKey
+			{
+				// pre-calculated hash of path + variant
+				unsigned long long Hash = 0;
+
+				// asset path
+				const char* Path = nullptr;
+
+				// asset variant, for example image filtering mode or font size
+				int Variant = 0;
+			};
+
+			/**
+			 * A single entry in the assets cache.
+			 */
+			struct CachedAsset
+			{
+				// cached asset
+				AssetPtr Asset;
+
+				// asset path and variant, to detect hash collisions
+				std::string Path;
+				int Variant = 0;
+
+				// estimated memory size when added to cache
+				size_t MemorySize = 0;
+
+				// access counter value when this asset was last retrieved from cache.
+				// atomic so we can update it while only holding a shared lock on the cache.
+				std::atomic<unsigned long long> LastAccess{ 0 };
+			};
+
+			/**
+			 * Cache keys are already hashed, so just use them as-is.
+			 */
+			struct PreHashed
+			{
+				size_t operator()(unsigned long long hash) const { return (size_t)hash; }
+			};
+
 			// assets cache
-			std::unordered_map<std::string, AssetPtr> _cache;
+			std::unordered_map<unsigned long long, CachedAsset, PreHashed> _cache;
+
+			// increased every time we access the cache, used to find least recently used assets
+			std::atomic<unsigned long long> _accessCounter{ 0 };
+
+			// estimated memory of all cached assets
+			std::atomic<size_t> _cachedBytes{ 0 };
+
+			// memory budget for cached assets (0 = unlimited)
+			size_t _memoryBudget = 0;
+
+			// time left until we try to enforce memory budget again, after failing to fit it
+			double _timeToNextBudgetCheck = 0;
+
+			// is hot reload enabled (read on asset loader threads)
+			std::atomic<bool> _hotReload{ false };
+
+			// watch asset files for changes, for hot reload
+			FileWatcher _fileWatcher;
+
+			// assets to reload when files change, by normalized file path
+			std::unordered_map<std::string, std::vector<std::weak_ptr<IAsset>>> _hotReloadAssets;
+
+			// changed files waiting to be reloaded, and time left until they stop changing
+			std::unordered_map<std::string, double> _pendingReloads;
+
+			// time left until we check watched files for changes again
+			double _timeToNextFilesCheck = 0;
 
 		protected:
 
@@ -86,6 +160,25 @@ namespace bon
 			 */
 			virtual SoundAsset LoadSound(const char* filename, bool useCache = true) override;
 
+			/**
+			 * Load and return a streamed sound asset.
+			 *
+			 * \param filename Sound file path.
+			 * \param useCache If true, will try to get asset from cache first. If not found in cache will add to cache after load.
+			 * \return Sound asset.
+			 */
+			virtual SoundAsset LoadSoundStream(const char* filename, bool useCache = true) override;
+
+			/**
+			 * Create a streamed sound asset from encoded data in memory.
+			 *
+			 * \param data Encoded sound data.
+			 * \param size Data size, in bytes.
+			 * \param format Data format, as file extension.
+			 * \return Sound asset.
+			 */
+			virtual SoundAsset CreateSoundStream(const void* data, size_t size, const char* format) override;
+
 			/**
 			 * Load and return a configuration asset.
 			 *
@@ -138,6 +231,17 @@ namespace bon
 			 */
 			virtual bool SaveConfig(ConfigAsset config, const char* filename) override;
 
+			/**
+			 * Compile a configuration into a binary file with pre-parsed values, which loads and reads faster than ini files.
+			 * Compiled configs are opt-in: to use one, load the compiled file path (for example 'sprites.ini.bcfg') instead of the ini file.
+			 * Loading an ini path always loads the ini, even if a compiled version exists next to it. Note: compiled configs are read-only.
+			 *
+			 * \param config Config to compile.
+			 * \param filename Output file path. If null, will write compiled file next to the config source file, with '.bcfg' suffix.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool CompileConfig(ConfigAsset config, const char* filename = nullptr) override;
+
 			/**
 			 * Clear all assets in cache.
 			 * Note: this won't necessarily dispose all assets - assets that are still held in external code will survive.
@@ -145,6 +249,46 @@ namespace bon
 			 */
 			virtual void ClearCache() override;
 
+			/**
+			 * Set memory budget for cached assets.
+			 * When cached assets exceed this budget, assets that are only held by the cache will be evicted, least recently used first.
+			 * Assets that are still held by external code are never evicted, and don't count as free memory.
+			 *
+			 * \param bytes Memory budget in bytes, or 0 for unlimited (default).
+			 */
+			virtual void SetMemoryBudget(size_t bytes) override;
+
+			/**
+			 * Get memory budget for cached assets.
+			 *
+			 * \return Memory budget in bytes, or 0 if unlimited.
+			 */
+			virtual size_t MemoryBudget() const override;
+
+			/**
+			 * Get estimated memory currently held by the assets cache.
+			 *
+			 * \return Cached assets memory, in bytes.
+			 */
+			virtual size_t CachedMemorySize() const override;
+
+			/**
+			 * Enable or disable hot reload (meant for development).
+			 * When enabled, images, configs and effects loaded from files are watched for changes, and reloaded when their files change.
+			 * Reloaded assets keep the same instance and get a new internal handle, so existing asset pointers will see the new data.
+			 * Note: only assets loaded while hot reload is enabled are watched.
+			 *
+			 * \param enable True to enable hot reload, false to disable it.
+			 */
+			virtual void EnableHotReload(bool enable) override;
+
+			/**
+			 * Get if hot reload is enabled.
+			 *
+			 * \return True if hot reload is enabled.
+			 */
+			virtual bool HotReloadEnabled() const override;
+
 			/**
 			 * Creates and return an empty image asset.
 			 * 
@@ -182,17 +326,67 @@ namespace bon
 
 		private:
 
+			/**
+			 * Build cache key from asset path and variant.
+			 *
+			 * \param path Asset path.
+			 * \param variant Asset variant (for example image filtering mode or font size).
+			 * \return Cache key.
+			 */
+			static CacheKey MakeCacheKey(const char* path, int variant);
+
+			/**
+			 * Get the variant an asset was cached with.
+			 * 
+			 * \param asset Asset to get variant for. Must be valid.
+			 * \return Asset cache variant.
+			 */
+			static int GetCacheVariant(const IAsset* asset);
+
 			/**
 			 * Put value in cache.
+			 * Must be called without holding the cache lock.
 			 */
-			void PutInCache(AssetPtr asset, const char* key);
+			void PutInCache(AssetPtr asset, const CacheKey& key);
 
 			/**
 			 * Get asset from cache.
+			 * Must be called while holding at least a shared lock on the cache.
 			 *
 			 * \return asset instance if found, or nullptr if not.
 			 */
-			AssetPtr GetFromCache(const char* id);
+			AssetPtr GetFromCache(const CacheKey& key);
+
+			/**
+			 * Evict least recently used assets that are only held by the cache, until cache fits memory budget.
+			 * 
+			 * \return True if cache now fits memory budget.
+			 */
+			bool EnforceMemoryBudget();
+
+			/**
+			 * Watch asset files for changes, if hot reload is enabled and asset type supports it.
+			 * 
+			 * \param asset Asset to watch.
+			 */
+			void WatchForHotReload(const AssetPtr& asset);
+
+			/**
+			 * Check for changed files and reload their assets.
+			 * Reloads are batched and limited per frame, and files are reloaded only after they stop changing for a short while.
+			 * 
+			 * \param deltaTime Frame delta time.
+			 */
+			void UpdateHotReload(double deltaTime);
+
+			/**
+			 * Reload an asset from file, and replace its handle in place.
+			 * If reload fails, asset will keep its previous handle.
+			 * 
+			 * \param asset Asset to reload.
+			 * \return True if reloaded successfully.
+			 */
+			bool ReloadAsset(IAsset* asset);
 
 			/**
 			 * Called to initialize every new asset we create.
@@ -0,0 +1,213 @@
+/*****************************************************************//**
+ * \file   CompiledConfig.h
+ * \brief  Compiled binary config format, with pre-parsed values and a perfect hash keys table.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "Types/Config.h"
+#include "Types/ConfigHandle.h"
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <set>
+#include <map>
+
+
+namespace bon
+{
+	namespace assets
+	{
+		/**
+		 * Suffix added to ini file path to get its compiled version path.
+		 * For example, the compiled version of 'sprites.ini' is 'sprites.ini.bcfg'.
+		 */
+		const char* const CompiledConfigSuffix = ".bcfg";
+
+		/**
+		 * Compiled config file header.
+		 * File layout: [header] [displacements table] [padding to 8 bytes] [entries] [strings].
+		 * All values are stored in little-endian.
+		 */
+		struct CompiledConfigHeader
+		{
+			// file magic, must be 'BCFG'
+			char Magic[4];
+
+			// format version
+			uint32_t Version;
+
+			// number of entries (and slots in entries table)
+			uint32_t EntriesCount;
+
+			// number of buckets in displacements table
+			uint32_t BucketsCount;
+
+			// offset of entries table from file start
+			uint32_t EntriesOffset;
+
+			// offset of strings block from file start
+			uint32_t StringsOffset;
+
+			// size of strings block, in bytes
+			uint32_t StringsSize;
+
+			// reserved for future use
+			uint32_t Reserved;
+		};
+
+		/**
+		 * Flags of which pre-parsed values are valid for an entry.
+		 */
+		enum CompiledConfigValueFlags : uint32_t
+		{
+			HasInt = 1 << 0,
+			HasFloat = 1 << 1,
+			HasBool = 1 << 2,
+			HasPoint = 1 << 3,
+			HasColor = 1 << 4,
+			HasRectangle = 1 << 5,
+		};
+
+		/**
+		 * A single key / value entry in compiled config.
+		 */
+		struct CompiledConfigEntry
+		{
+			// hash of lowercase 'section=name' key
+			uint64_t KeyHash;
+
+			// offsets in strings block: lowercase key, original section name, original key name, and raw value
+			uint32_t KeyOffset;
+			uint32_t SectionOffset;
+			uint32_t NameOffset;
+			uint32_t ValueOffset;
+
+			// which pre-parsed values are valid (CompiledConfigValueFlags)
+			uint32_t Flags;
+
+			// pre-parsed numeric values
+			int32_t IntValue;
+			float FloatValue;
+			uint32_t BoolValue;
+			float PointValue[2];
+			float ColorValue[4];
+			float RectangleValue[4];
+		};
+
+		/**
+		 * Current compiled config format version.
+		 */
+		const uint32_t CompiledConfigVersion = 1;
+
+		/**
+		 * Config handle that reads from compiled config files.
+		 * Compiled configs are read-only.
+		 */
+		class CompiledConfigHandle : public _ConfigHandle
+		{
+		private:
+			// raw file data (stored as 64 bit words to keep entries aligned)
+			std::vector<uint64_t> _data;
+
+			// pointers into data
+			const CompiledConfigHeader* _header = nullptr;
+			const int32_t* _displacements = nullptr;
+			const CompiledConfigEntry* _entries = nullptr;
+			const char* _strings = nullptr;
+
+			// sections and keys sets, built on load
+			std::set<std::string> _sections;
+			std::map<std::string, std::set<std::string>, std::less<>> _keys;
+
+			/**
+			 * Find entry by section and name.
+			 *
+			 * \return Entry, or nullptr if not found.
+			 */
+			const CompiledConfigEntry* Find(const char* section, const char* name) const;
+
+		public:
+
+			/**
+			 * Load compiled config file.
+			 *
+			 * \param path Compiled config path.
+			 */
+			CompiledConfigHandle(const char* path);
+
+			/**
+			 * Check if a file is a compiled config file (by its magic).
+			 *
+			 * \param path File path.
+			 * \return True if file is a compiled config.
+			 */
+			static bool IsCompiledConfig(const char* path);
+
+			/**
+			 * Compile a config asset into a compiled config file.
+			 *
+			 * \param config Config to compile.
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			static bool Compile(const _Config& config, const char* filename);
+
+			/**
+			 * Get if this config file is valid.
+			 */
+			virtual bool IsValid() const override { return _header != nullptr; }
+
+			/**
+			 * Get string value from config.
+			 */
+			virtual const char* GetStr(const char* section, const char* name, const char* defaultVal) const override;
+
+			/**
+			 * Get bool value from config.
+			 */
+			virtual bool GetBool(const char* section, const char* name, bool defaultVal) const override;
+
+			/**
+			 * Get integer value from config.
+			 */
+			virtual long GetInt(const char* section, const char* name, int defaultVal) const override;
+
+			/**
+			 * Get float value from config.
+			 */
+			virtual float GetFloat(const char* section, const char* name, float defaultVal) const override;
+
+			/**
+			 * Get a pre-parsed multi-numbers value.
+			 */
+			virtual bool _GetParsedValue(const char* section, const char* name, ConfigValueFormat format, float* out) const override;
+
+			/**
+			 * Get set with all section names.
+			 */
+			virtual const std::set<std::string>& Sections() const override { return _sections; }
+
+			/**
+			 * Get set with all keys in section.
+			 */
+			virtual const std::set<std::string>& Keys(const char* section) const override;
+
+			/**
+			 * Compiled configs are read-only - will throw exception.
+			 */
+			virtual void UpdateValue(const char* section, const char* key, const char* value) override;
+
+			/**
+			 * Compiled configs are read-only - will throw exception.
+			 */
+			virtual void RemoveKey(const char* section, const char* key) override;
+
+			/**
+			 * Save configuration to file, as ini.
+			 */
+			virtual bool SaveConfig(const char* filename) const override;
+		};
+	}
+}
@@ -0,0 +1,111 @@
+/*****************************************************************//**
+ * \file   FileWatcher.h
+ * \brief  Detect changes in asset files, used for hot reloading.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include <unordered_map>
+#include <unordered_set>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+
+namespace bon
+{
+	namespace assets
+	{
+		/**
+		 * Watch a set of files and report which of them changed.
+		 * On Linux uses inotify on the files' parent folders, on other platforms (or folders inotify fails to watch) falls back to polling files modification time.
+		 * Not thread safe - should only be used from the main thread.
+		 */
+		class FileWatcher
+		{
+		private:
+
+			// watched files and their last known modification time (used by polling)
+			std::unordered_map<std::string, std::filesystem::file_time_type> _files;
+
+#if defined(__linux__)
+			// inotify instance
+			int _inotifyFd = -1;
+
+			// watched folders, by inotify watch descriptor
+			std::unordered_map<int, std::string> _folders;
+
+			// watch descriptors by folder path
+			std::unordered_map<std::string, int> _foldersWatch;
+
+			// folders we failed to watch with inotify, and watched files in them that we poll instead
+			std::unordered_set<std::string> _pollFolders;
+			std::unordered_set<std::string> _pollFiles;
+#endif
+
+			/**
+			 * Check if a watched file modification time changed, and update it.
+			 *
+			 * \return True if file changed since last check.
+			 */
+			static bool CheckModifyTime(const std::string& path, std::filesystem::file_time_type& lastModifyTime);
+
+			/**
+			 * Get file last modification time, or default value if failed to get it.
+			 */
+			static std::filesystem::file_time_type GetModifyTime(const std::string& path);
+
+		public:
+
+			/**
+			 * Create the file watcher.
+			 */
+			FileWatcher();
+
+			/**
+			 * Destroy the file watcher.
+			 */
+			~FileWatcher();
+
+			/**
+			 * Normalize a file path, the same way the watcher stores and reports it.
+			 *
+			 * \param path File path.
+			 * \return Normalized path.
+			 */
+			static std::string NormalizePath(const std::string& path);
+
+			/**
+			 * Start watching a file. Does nothing if already watched.
+			 *
+			 * \param path File path.
+			 */
+			void Watch(const std::string& path);
+
+			/**
+			 * Stop watching a file.
+			 *
+			 * \param path File path.
+			 */
+			void Unwatch(const std::string& path);
+
+			/**
+			 * Stop watching all files.
+			 */
+			void Clear();
+
+			/**
+			 * Get how many files are watched.
+			 */
+			inline size_t Count() const { return _files.size(); }
+
+			/**
+			 * Check for changes in watched files.
+			 *
+			 * \param outChanged Will add normalized paths of files that changed since last call to this vector.
+			 */
+			void Poll(std::vector<std::string>& outChanged);
+		};
+	}
+}
@@ -75,6 +75,28 @@ namespace bon
 			 */
 			virtual SoundAsset LoadSound(const char* filename, bool useCache = true) = 0;
 
+			/**
+			 * Load and return a streamed sound asset.
+			 * Streamed sounds are decoded incrementally while playing, instead of fully on load. Use for long ambience loops and voice lines.
+			 * Format is picked by file extension (see SoundStreams::RegisterDecoder()).
+			 *
+			 * \param filename Sound file path.
+			 * \param useCache If true, will try to get asset from cache first. If not found in cache will add to cache after load.
+			 * \return Sound asset.
+			 */
+			virtual SoundAsset LoadSoundStream(const char* filename, bool useCache = true) = 0;
+
+			/**
+			 * Create a streamed sound asset from encoded data in memory.
+			 * Data is copied, so you can release it after this call.
+			 *
+			 * \param data Encoded sound data (for example, content of a wav file).
+			 * \param size Data size, in bytes.
+			 * \param format Data format, as file extension (for example "wav").
+			 * \return Sound asset.
+			 */
+			virtual SoundAsset CreateSoundStream(const void* data, size_t size, const char* format) = 0;
+
 			/**
 			 * Load and return a font asset.
 			 *
@@ -127,6 +149,17 @@ namespace bon
 			 */
 			virtual bool SaveConfig(ConfigAsset config, const char* filename) = 0;
 
+			/**
+			 * Compile a configuration into a binary file with pre-parsed values, which loads and reads faster than ini files.
+			 * Compiled configs are opt-in: to use one, load the compiled file path (for example 'sprites.ini.bcfg') instead of the ini file.
+			 * Loading an ini path always loads the ini, even if a compiled version exists next to it. Note: compiled configs are read-only.
+			 *
+			 * \param config Config to compile.
+			 * \param filename Output file path. If null, will write compiled file next to the config source file, with '.bcfg' suffix.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool CompileConfig(ConfigAsset config, const char* filename = nullptr) = 0;
+
 			/**
 			 * Clear all assets from cache.
 			 * Note: this won't necessarily dispose all assets - assets that are still held in external code will survive.
@@ -134,6 +167,46 @@ namespace bon
 			 */
 			virtual void ClearCache() = 0;
 
+			/**
+			 * Set memory budget for cached assets.
+			 * When cached assets exceed this budget, assets that are only held by the cache will be evicted, least recently used first.
+			 * Assets that are still held by external code are never evicted, and don't count as free memory.
+			 *
+			 * \param bytes Memory budget in bytes, or 0 for unlimited (default).
+			 */
+			virtual void SetMemoryBudget(size_t bytes) = 0;
+
+			/**
+			 * Get memory budget for cached assets.
+			 *
+			 * \return Memory budget in bytes, or 0 if unlimited.
+			 */
+			virtual size_t MemoryBudget() const = 0;
+
+			/**
+			 * Get estimated memory currently held by the assets cache.
+			 *
+			 * \return Cached assets memory, in bytes.
+			 */
+			virtual size_t CachedMemorySize() const = 0;
+
+			/**
+			 * Enable or disable hot reload (meant for development).
+			 * When enabled, images, configs and effects loaded from files are watched for changes, and reloaded when their files change.
+			 * Reloaded assets keep the same instance and get a new internal handle, so existing asset pointers will see the new data.
+			 * Note: only assets loaded while hot reload is enabled are watched.
+			 *
+			 * \param enable True to enable hot reload, false to disable it.
+			 */
+			virtual void EnableHotReload(bool enable) = 0;
+
+			/**
+			 * Get if hot reload is enabled.
+			 *
+			 * \return True if hot reload is enabled.
+			 */
+			virtual bool HotReloadEnabled() const = 0;
+
 			/**
 			 * Get loaded assets count by type.
 			 * 
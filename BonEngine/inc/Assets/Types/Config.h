@@ -14,18 +14,162 @@
 #include "../../Framework/RectangleF.h"
 #include <string>
 #include <set>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <cstdint>
 #include "ConfigHandle.h"
+#pragma warning ( push )
+#pragma warning ( disable: 4251 ) // "..needs to have dll-interface to be used by clients..." it's ok in this case because its private.
 
 namespace bon
 {
 	namespace assets
 	{
+		/**
+		 * A config key (section + name), resolved once and reused for lookups.
+		 * Keep these as static / class members for values you read often, to skip hashing key strings on every lookup.
+		 * Note: like all config keys, lookups are not case sensitive.
+		 */
+		class BON_DLLEXPORT ConfigKey
+		{
+		private:
+			// section and key names
+			std::string _section;
+			std::string _name;
+
+			// pre-calculated key hash
+			uint64_t _hash;
+
+		public:
+			/**
+			 * Create the config key.
+			 *
+			 * \param section Section name.
+			 * \param name Key name.
+			 */
+			ConfigKey(const char* section, const char* name) : _section(section), _name(name), _hash(Hash(section, name)) {}
+
+			/**
+			 * Get section name.
+			 */
+			inline const char* Section() const { return _section.c_str(); }
+
+			/**
+			 * Get key name.
+			 */
+			inline const char* Name() const { return _name.c_str(); }
+
+			/**
+			 * Get key hash.
+			 */
+			inline uint64_t Hash() const { return _hash; }
+
+			/**
+			 * Calculate the (case insensitive) hash of a config key without building key strings.
+			 *
+			 * \param section Section name.
+			 * \param name Key name.
+			 * \param seed Optional hash seed.
+			 * \return Key hash.
+			 */
+			static uint64_t Hash(const char* section, const char* name, uint64_t seed = 0);
+
+			/**
+			 * Check if a lowercase 'section=name' key string matches section and name (case insensitive).
+			 *
+			 * \param key Lowercase key string.
+			 * \param section Section name.
+			 * \param name Key name.
+			 * \return True if key matches section and name.
+			 */
+			static bool Matches(const char* key, const char* section, const char* name);
+		};
+
 		/**
 		 * A configuration asset.
 		 * Used to read config from user.
 		 */
 		class BON_DLLEXPORT _Config : public IAsset
 		{
+		private:
+			/**
+			 * A config value in cache, with its typed conversions.
+			 */
+			struct CachedValue
+			{
+				// lowercase 'section=name' key, to detect hash collisions
+				std::string Key;
+
+				// raw value, or nullptr if not found
+				const char* Str = nullptr;
+
+				// which typed values were converted, and which of them are valid
+				unsigned int Converted = 0;
+				unsigned int Valid = 0;
+
+				// converted values
+				long Int = 0;
+				float Float = 0;
+				bool Bool = false;
+				framework::PointF Point;
+				framework::Color Color;
+				framework::RectangleF Rectangle;
+			};
+
+			// values cache, populated lazily on lookups. only keys that exist are cached, so its bounded by config size
+			mutable std::unordered_map<uint64_t, CachedValue> _cache;
+
+			// section names by section hash, built on first section lookup
+			mutable std::unordered_multimap<uint64_t, const std::string*> _sectionsIndex;
+			mutable bool _sectionsIndexed = false;
+
+			// protect cache and sections index, so config reads are thread safe.
+			// reads of cached and converted values only take a shared lock.
+			mutable std::shared_mutex _cacheMutex;
+
+			/**
+			 * Get value from cache.
+			 * Must be called while holding the cache lock (shared or exclusive).
+			 *
+			 * \return Cached value, or nullptr if not cached or can't use cache for this key (hash collision).
+			 */
+			const CachedValue* FindCached(const char* section, const char* name, uint64_t hash) const;
+
+			/**
+			 * Get value from cache, or add it if not cached yet.
+			 * Must be called while holding the cache exclusive lock.
+			 *
+			 * \return Cached value, or nullptr if key doesn't exist or can't use cache for this key (hash collision).
+			 */
+			CachedValue* GetCached(const char* section, const char* name, uint64_t hash) const;
+
+			/**
+			 * Read a cached value, converting it to a typed value on first read.
+			 * Only takes a shared lock if value is already cached and converted.
+			 *
+			 * \param flag Typed value flag, or 0 to only read raw string.
+			 * \param convert Called with cached value under exclusive lock, if typed value is not converted yet.
+			 * \param read Called with cached value under lock, to read result.
+			 * \return False if key doesn't exist or can't use cache for this key (hash collision).
+			 */
+			template <typename Convert, typename Read>
+			bool ReadCached(const char* section, const char* name, uint64_t hash, unsigned int flag, Convert convert, Read read) const;
+
+			/**
+			 * Clear values cache.
+			 */
+			void ClearCache();
+
+			// typed getters implementation, by section, name and key hash
+			const char* GetStr(const char* section, const char* name, uint64_t hash, const char* defaultVal) const;
+			bool GetBool(const char* section, const char* name, uint64_t hash, bool defaultVal) const;
+			long GetInt(const char* section, const char* name, uint64_t hash, int defaultVal) const;
+			float GetFloat(const char* section, const char* name, uint64_t hash, float defaultVal) const;
+			framework::PointF GetPointF(const char* section, const char* name, uint64_t hash, const framework::PointF& defaultVal) const;
+			framework::RectangleF GetRectangleF(const char* section, const char* name, uint64_t hash, const framework::RectangleF& defaultVal) const;
+			framework::Color GetColor(const char* section, const char* name, uint64_t hash, const framework::Color& defaultVal) const;
+
 		public:
 
 			/**
@@ -57,6 +201,13 @@ namespace bon
 				return _untypedHandle != nullptr && Handle()->IsValid();
 			}
 
+			/**
+			 * Set this asset's internal handle (clears values cache).
+			 *
+			 * \param handle Handle to set.
+			 */
+			virtual void _SetHandle(void* handle) override;
+
 			/**
 			 * Get asset type.
 			 *
@@ -72,7 +223,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as string.
 			 */
-			const char* GetStr(const char* section, const char* name, const char* defaultVal) const { return Handle()->GetStr(section, name, defaultVal); }
+			const char* GetStr(const char* section, const char* name, const char* defaultVal) const { return GetStr(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get string value from config, using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as string.
+			 */
+			const char* GetStr(const ConfigKey& key, const char* defaultVal) const { return GetStr(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get bool value from config.
@@ -82,7 +242,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as boolean.
 			 */
-			bool GetBool(const char* section, const char* name, bool defaultVal) const { return Handle()->GetBool(section, name, defaultVal); }
+			bool GetBool(const char* section, const char* name, bool defaultVal) const { return GetBool(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get bool value from config, using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as boolean.
+			 */
+			bool GetBool(const ConfigKey& key, bool defaultVal) const { return GetBool(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get integer value from config.
@@ -92,7 +261,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as integer.
 			 */
-			long GetInt(const char* section, const char* name, int defaultVal) const { return Handle()->GetInt(section, name, defaultVal); }
+			long GetInt(const char* section, const char* name, int defaultVal) const { return GetInt(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get integer value from config, using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as integer.
+			 */
+			long GetInt(const ConfigKey& key, int defaultVal) const { return GetInt(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get float value from config.
@@ -102,7 +280,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as float.
 			 */
-			float GetFloat(const char* section, const char* name, float defaultVal) const { return Handle()->GetFloat(section, name, defaultVal); }
+			float GetFloat(const char* section, const char* name, float defaultVal) const { return GetFloat(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get float value from config, using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as float.
+			 */
+			float GetFloat(const ConfigKey& key, float defaultVal) const { return GetFloat(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get point value from config (format: "x,y").
@@ -112,7 +299,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as PointF.
 			 */
-			framework::PointF GetPointF(const char* section, const char* name, const framework::PointF& defaultVal) const;
+			framework::PointF GetPointF(const char* section, const char* name, const framework::PointF& defaultVal) const { return GetPointF(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get point value from config (format: "x,y"), using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as PointF.
+			 */
+			framework::PointF GetPointF(const ConfigKey& key, const framework::PointF& defaultVal) const { return GetPointF(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get rectanlge value from config (format: "x,y,w,h").
@@ -122,7 +318,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as RectangleF.
 			 */
-			framework::RectangleF GetRectangleF(const char* section, const char* name, const framework::RectangleF& defaultVal) const;
+			framework::RectangleF GetRectangleF(const char* section, const char* name, const framework::RectangleF& defaultVal) const { return GetRectangleF(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get rectangle value from config (format: "x,y,w,h"), using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as RectangleF.
+			 */
+			framework::RectangleF GetRectangleF(const ConfigKey& key, const framework::RectangleF& defaultVal) const { return GetRectangleF(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get color value from config (format: "r,g,b,a" where values range from 0 to 255).
@@ -132,7 +337,16 @@ namespace bon
 			 * \param defaultVal Default value to retrieve if not found.
 			 * \return Config value as Color.
 			 */
-			framework::Color GetColor(const char* section, const char* name, const framework::Color& defaultVal) const;
+			framework::Color GetColor(const char* section, const char* name, const framework::Color& defaultVal) const { return GetColor(section, name, ConfigKey::Hash(section, name), defaultVal); }
+
+			/**
+			 * Get color value from config (format: "r,g,b,a" where values range from 0 to 255), using pre-resolved key.
+			 *
+			 * \param key Config key.
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as Color.
+			 */
+			framework::Color GetColor(const ConfigKey& key, const framework::Color& defaultVal) const { return GetColor(key.Section(), key.Name(), key.Hash(), defaultVal); }
 
 			/**
 			 * Get the index of the selected option from options list.
@@ -184,7 +398,7 @@ namespace bon
 			 * \param key Key name.
 			 * \param value New value to set.
 			 */
-			void SetValue(const char* section, const char* key, const char* value) { Handle()->UpdateValue(section, key, value); }
+			void SetValue(const char* section, const char* key, const char* value) { ClearCache(); Handle()->UpdateValue(section, key, value); }
 
 			/**
 			 * Removes a key.
@@ -192,7 +406,7 @@ namespace bon
 			 * \param section Section name.
 			 * \param key Key name.
 			 */
-			void RemoveKey(const char* section, const char* key) { Handle()->RemoveKey(section, key); }
+			void RemoveKey(const char* section, const char* key) { ClearCache(); Handle()->RemoveKey(section, key); }
 	
 			/**
 			 * Return if a section exists.
@@ -211,6 +425,14 @@ namespace bon
 			 */
 			bool Exists(const char* section, const char* key) const;
 
+			/**
+			 * Return if a key exists.
+			 *
+			 * \param key Key to check if exists.
+			 * \return True if key exists, false otherwise.
+			 */
+			bool Exists(const ConfigKey& key) const;
+
 			/**
 			 * Save configuration to file.
 			 * Note: don't call this directly, use Assets() method, as the asset manager may need to manipulate the path.
@@ -221,4 +443,6 @@ namespace bon
 			bool _SaveToFile(const char* filename) const { return Handle()->SaveConfig(filename); }
 		};
 	}
-}
\ No newline at end of file
+}
+
+#pragma warning (pop)
\ No newline at end of file
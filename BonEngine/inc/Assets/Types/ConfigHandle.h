@@ -16,6 +16,17 @@ namespace bon
 {
 	namespace assets
 	{
+		/**
+		 * Formats of config values that are made of multiple numbers.
+		 * Config handles may store these values pre-parsed.
+		 */
+		enum class BON_DLLEXPORT ConfigValueFormat
+		{
+			Point,
+			Color,
+			Rectangle,
+		};
+
 		/**
 		 * Define the interface for a configuration internal handle.
 		 * To create new config asset types, you must implement this API.
@@ -23,6 +34,11 @@ namespace bon
 		class BON_DLLEXPORT _ConfigHandle
 		{
 		public:
+			/**
+			 * Virtual destructor, since config handles are destroyed via base class (there are multiple config handle types).
+			 */
+			virtual ~_ConfigHandle() {}
+
 			/**
 			 * Get if this config file is valid.
 			 *
@@ -70,6 +86,18 @@ namespace bon
 			 */
 			virtual float GetFloat(const char* section, const char* name, float defaultVal) const = 0;
 
+			/**
+			 * Get a pre-parsed multi-numbers value, if this handle supports it.
+			 * If returns false, caller should parse the string value instead.
+			 *
+			 * \param section Config section name.
+			 * \param name Config name.
+			 * \param format Value format.
+			 * \param out Output numbers: x,y for points, r,g,b,a (0-1) for colors, x,y,width,height for rectangles.
+			 * \return True if found a pre-parsed value, false otherwise.
+			 */
+			virtual bool _GetParsedValue(const char* section, const char* name, ConfigValueFormat format, float* out) const { return false; }
+
 			/**
 			 * Get set with all section names.
 			 */
@@ -69,6 +69,13 @@ namespace bon
 			 */
 			inline int FontSize() const { return Handle()->FontSize(); }
 
+			/**
+			 * Get estimated font memory, in bytes.
+			 *
+			 * \return Font memory size in bytes.
+			 */
+			virtual size_t MemorySize() const override { return IsValid() ? Handle()->MemorySize() : 0; }
+
 		};
 	}
 }
\ No newline at end of file
@@ -40,6 +40,13 @@ namespace bon
 			 * \return Font size.
 			 */
 			virtual int FontSize() const = 0;
+
+			/**
+			 * Get estimated font memory, in bytes.
+			 *
+			 * \return Font memory size in bytes.
+			 */
+			virtual size_t MemorySize() const { return 0; }
 		};
 	}
 }
\ No newline at end of file
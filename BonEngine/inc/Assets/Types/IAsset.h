@@ -26,6 +26,9 @@ namespace bon
 			// asset path
 			std::string _path;
 
+			// how many times this asset was hot-reloaded
+			unsigned int _reloadCount = 0;
+
 		protected:
 			/**
 			 * The underlying asset handle.
@@ -42,6 +45,18 @@ namespace bon
 			 */
 			virtual void _SetHandle(void* handle) { _untypedHandle = handle; }
 
+			/**
+			 * Get this asset's internal handle.
+			 * 
+			 * \return Untyped handle.
+			 */
+			inline void* _GetHandle() const { return _untypedHandle; }
+
+			/**
+			 * Mark that this asset was reloaded with a new handle.
+			 */
+			inline void _MarkReloaded() { _reloadCount++; }
+
 			/**
 			 * Destroy the currently set handle.
 			 */
@@ -80,6 +95,14 @@ namespace bon
 			 */
 			const char* Path() const { return _path.c_str(); }
 
+			/**
+			 * Get how many times this asset was hot-reloaded since loaded.
+			 * Objects that build data from assets (for example sprite sheets built from config) can compare this value to know when to rebuild.
+			 * 
+			 * \return Reloads count.
+			 */
+			inline unsigned int ReloadCount() const { return _reloadCount; }
+
 			/**
 			 * Return if this asset is properly loaded / valid.
 			 */
@@ -91,6 +114,14 @@ namespace bon
 			 * \return Asset type identifier.
 			 */
 			virtual AssetTypes AssetType() const = 0;
+
+			/**
+			 * Get estimated memory this asset occupies while loaded, in bytes.
+			 * Used by the assets manager to account for cache residency and memory budget.
+			 * 
+			 * \return Estimated memory size in bytes, or 0 if unknown / negligible.
+			 */
+			virtual size_t MemorySize() const { return 0; }
 		};
 	}
 }
@@ -97,6 +97,16 @@ namespace bon
 			 */
 			virtual AssetTypes AssetType() const override { return AssetTypes::Image; }
 
+			/**
+			 * Get estimated texture memory, in bytes.
+			 *
+			 * \return Texture size in bytes.
+			 */
+			virtual size_t MemorySize() const override
+			{
+				return IsValid() ? Handle()->MemorySize() : 0;
+			}
+
 			/**
 			 * Get image filtering mode.
 			 * 
@@ -58,6 +58,14 @@ namespace bon
 			 */
 			virtual bool HaveAlphaChannel() const = 0;
 
+			/**
+			 * Get estimated texture memory, in bytes.
+			 * Default implementation assume 4 bytes per pixel.
+			 *
+			 * \return Texture size in bytes.
+			 */
+			virtual size_t MemorySize() const { return (size_t)Width() * (size_t)Height() * 4; }
+
 			/**
 			 * Save image asset to file.
 			 *
@@ -60,8 +60,10 @@ namespace bon
 
 			/**
 			 * Get track length, in seconds.
+			 * Length is read from file headers when loading: exact for wav and ogg (vorbis / opus) files, and any format with a registered
+			 * stream decoder that knows its length (see SoundStreams::RegisterDecoder()). Other formats return -1.
 			 *
-			 * \return Music track length.
+			 * \return Music track length, or -1 if unknown.
 			 */
 			float Length() const { return Handle()->Length(); }
 		};
@@ -16,12 +16,30 @@ namespace bon
 {
 	namespace assets
 	{
+		/**
+		 * Extra data to create a streamed sound from memory.
+		 */
+		struct BON_DLLEXPORT _SoundStreamData
+		{
+			const void* Data;
+			size_t Size;
+			const char* Format;
+		};
+
 		/**
 		 * A sound track asset.
 		 * Used to play sound effects.
 		 */
 		class BON_DLLEXPORT _Sound : public IAsset
 		{
+		private:
+			// voice pool priority and sound group
+			int _priority = 0;
+			int _group = -1;
+
+			// is this sound decoded incrementally while playing
+			bool _streamed = false;
+
 		public:
 
 			/**
@@ -42,8 +60,9 @@ namespace bon
 			 * Create the asset.
 			 *
 			 * \param path Asset's path.
+			 * \param streamed If true, sound will be decoded incrementally while playing instead of fully on load.
 			 */
-			_Sound(const char* path) : IAsset(path) {
+			_Sound(const char* path, bool streamed = false) : IAsset(path), _streamed(streamed) {
 			}
 
 			/**
@@ -69,6 +88,61 @@ namespace bon
 			* Get if this sound is currently playing.
 			*/
 			bool IsPlaying() const { return Handle()->IsPlaying(); }
+
+			/**
+			 * Get how many instances of this sound are currently playing.
+			 *
+			 * \return Playing instances count.
+			 */
+			int PlayingInstances() const { return Handle()->PlayingInstances(); }
+
+			/**
+			 * Get decoded audio memory, in bytes.
+			 *
+			 * \return Decoded sound size in bytes.
+			 */
+			virtual size_t MemorySize() const override { return IsValid() ? Handle()->MemorySize() : 0; }
+
+			/**
+			 * Get how many bytes this sound takes when fully decoded.
+			 * For streamed sounds, compare with MemorySize() to see how much memory streaming saves.
+			 *
+			 * \return Fully decoded sound size in bytes.
+			 */
+			size_t DecodedSize() const { return IsValid() ? Handle()->DecodedSize() : 0; }
+
+			/**
+			 * Get if this sound is streamed (decoded incrementally while playing).
+			 */
+			bool IsStreamed() const { return _streamed; }
+
+			/**
+			 * Set sound priority. When all voices are busy, sounds may only steal voices from sounds with same or lower priority.
+			 *
+			 * \param priority Sound priority (default is 0).
+			 */
+			void SetPriority(int priority) { _priority = priority; }
+
+			/**
+			 * Get sound priority.
+			 *
+			 * \return Sound priority.
+			 */
+			int Priority() const { return _priority; }
+
+			/**
+			 * Set sound group, to limit how many sounds of the same group can play at once (see ISfx::SetSoundGroupLimit()).
+			 *
+			 * \param group Sound group id, or -1 for no group.
+			 */
+			void SetGroup(int group) { _group = group; }
+
+			/**
+			 * Get sound group.
+			 *
+			 * \return Sound group id, or -1 if not in a group.
+			 */
+			int Group() const { return _group; }
 		};
 	}
 }
\ No newline at end of file
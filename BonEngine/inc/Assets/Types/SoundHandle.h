@@ -44,6 +44,28 @@ namespace bon
 			* Get if this sound is currently playing.
 			*/
 			virtual bool IsPlaying() const = 0;
+
+			/**
+			 * Get how many instances of this sound are currently playing.
+			 *
+			 * \return Playing instances count.
+			 */
+			virtual int PlayingInstances() const { return IsPlaying() ? 1 : 0; }
+
+			/**
+			 * Get decoded audio memory, in bytes.
+			 *
+			 * \return Decoded sound size in bytes.
+			 */
+			virtual size_t MemorySize() const { return 0; }
+
+			/**
+			 * Get how many bytes this sound takes when fully decoded.
+			 * For streamed sounds this is more than MemorySize(), which only counts what's resident.
+			 *
+			 * \return Fully decoded sound size in bytes.
+			 */
+			virtual size_t DecodedSize() const { return MemorySize(); }
 		};
 	}
 }
\ No newline at end of file
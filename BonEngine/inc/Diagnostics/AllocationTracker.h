@@ -0,0 +1,199 @@
+/*****************************************************************//**
+ * \file   AllocationTracker.h
+ * \brief  Opt-in heap allocations tracker, to find allocations in hot paths.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+
+
+namespace bon
+{
+	namespace diagnostics
+	{
+		/**
+		 * Heap allocations counters.
+		 */
+		struct BON_DLLEXPORT AllocationStats
+		{
+			/**
+			 * How many allocations were made.
+			 */
+			uint64_t Allocations = 0;
+
+			/**
+			 * How many allocations were freed.
+			 */
+			uint64_t Frees = 0;
+
+			/**
+			 * How many bytes were allocated.
+			 */
+			uint64_t Bytes = 0;
+		};
+
+		/**
+		 * Heap allocations made under a given tag.
+		 */
+		struct BON_DLLEXPORT AllocationTagStats
+		{
+			/**
+			 * Tag name (profiled scope name or BON_ALLOCATION_TAG name).
+			 */
+			const char* Tag = nullptr;
+
+			/**
+			 * How many allocations were made under this tag.
+			 */
+			uint64_t Allocations = 0;
+
+			/**
+			 * How many bytes were allocated under this tag.
+			 */
+			uint64_t Bytes = 0;
+		};
+
+		/**
+		 * Heap allocations tracker.
+		 * Hooks the engine's global operator new / delete and SDL memory functions, and when enabled counts allocations globally and per thread.
+		 * In debug builds, allocations are also attributed to the innermost profiled scope or BON_ALLOCATION_TAG() on the allocating thread.
+		 * When tracker is disabled, hooks only cost a single flag check. Define BON_DISABLE_ALLOCATION_TRACKER to compile the hooks out.
+		 * Note: only allocations made by the engine's module are tracked.
+		 */
+		class BON_DLLEXPORT AllocationTracker
+		{
+		public:
+			/**
+			 * Max different tags we keep track on. Allocations under tags beyond this limit are not attributed.
+			 */
+			static const int MaxTags = 512;
+
+			/**
+			 * Get if allocation hooks were compiled in.
+			 */
+			static bool IsAvailable();
+
+			/**
+			 * Enable or disable tracking allocations.
+			 *
+			 * \param enable Should we track allocations.
+			 */
+			static void Enable(bool enable);
+
+			/**
+			 * Get if tracking allocations.
+			 */
+			static inline bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+			/**
+			 * Get allocations made by all threads while tracker was enabled.
+			 */
+			static AllocationStats GetTotals();
+
+			/**
+			 * Get allocations made by current thread while tracker was enabled.
+			 */
+			static AllocationStats GetThreadTotals();
+
+			/**
+			 * Get allocations per tag. Only collected in debug builds.
+			 *
+			 * \param out Array to write tags stats to.
+			 * \param maxCount Max tags to write.
+			 * \return How many tags were written.
+			 */
+			static int GetTags(AllocationTagStats* out, int maxCount);
+
+			/**
+			 * Write allocations per tag to a CSV file, sorted by allocations count. Only collected in debug builds.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			static bool DumpTags(const char* filename);
+
+			/**
+			 * Start a zero-allocations region on current thread, for asserting steady state code doesn't allocate.
+			 * Regions may be nested. Tracker must be enabled.
+			 */
+			static void BeginNoAllocations();
+
+			/**
+			 * End a zero-allocations region on current thread.
+			 *
+			 * \param throwIfAllocated If true and allocations were made during region, will log the first allocating tag and throw InvalidState.
+			 * \return How many allocations were made during region.
+			 */
+			static uint64_t EndNoAllocations(bool throwIfAllocated = true);
+
+			/**
+			 * Hook SDL memory functions. Called by the engine on start, before SDL allocates anything.
+			 */
+			static void _InstallSdlHooks();
+
+			/**
+			 * Set current thread's allocations tag.
+			 *
+			 * \param tag New tag. Must remain valid forever (normally a string literal).
+			 * \return Previous tag, to restore later.
+			 */
+			static const char* _SetTag(const char* tag);
+
+			/**
+			 * Report an allocation. Called by allocation hooks.
+			 *
+			 * \param size Allocation size, in bytes.
+			 */
+			static void _OnAllocate(size_t size);
+
+			/**
+			 * Report freeing an allocation. Called by allocation hooks.
+			 */
+			static void _OnFree();
+
+		private:
+			// is tracker currently enabled
+			static std::atomic<bool> _enabled;
+		};
+
+		/**
+		 * Set current thread's allocations tag from construction to destruction.
+		 * Don't use directly, use BON_ALLOCATION_TAG() instead.
+		 */
+		class AllocationTagScope
+		{
+		private:
+			// tag to restore when scope ends
+			const char* _prevTag;
+
+		public:
+			/**
+			 * Start tagged scope.
+			 */
+			inline AllocationTagScope(const char* tag) : _prevTag(AllocationTracker::_SetTag(tag)) {}
+
+			/**
+			 * End tagged scope.
+			 */
+			inline ~AllocationTagScope() { AllocationTracker::_SetTag(_prevTag); }
+		};
+	}
+}
+
+/**
+ * Attribute allocations made in current scope to a given tag.
+ * Tag must remain valid forever (normally a string literal).
+ * Only active in debug builds. Profiled scopes (BON_PROFILE_SCOPE) are also used as tags.
+ */
+#if defined(_DEBUG) && !defined(BON_DISABLE_ALLOCATION_TRACKER)
+#define _BON_ALLOCATION_TAG_CONCAT2(a, b) a##b
+#define _BON_ALLOCATION_TAG_CONCAT(a, b) _BON_ALLOCATION_TAG_CONCAT2(a, b)
+#define BON_ALLOCATION_TAG(name) bon::diagnostics::AllocationTagScope _BON_ALLOCATION_TAG_CONCAT(_bonAllocationTag, __LINE__)(name)
+#else
+#define BON_ALLOCATION_TAG(name)
+#endif
@@ -8,6 +8,11 @@
 #pragma once
 #include "IDiagnostics.h"
 #include <stdio.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 
 namespace bon
@@ -24,8 +29,50 @@ namespace bon
 			int _currFpsCount = 0;
 			int _lastFpsCount = 0;
 
-			// for counters
-			long _counters[(int)DiagnosticsCounters::_MaxCounters] = { 0 };
+			// counters values, and per-frame counters values from last frame
+			std::atomic<long> _counters[(int)DiagnosticsCounters::_MaxCounters] = { };
+			long _countersLastFrame[(int)DiagnosticsCounters::_MaxCounters] = { 0 };
+
+			// registered counters names and types.
+			// counters are only added, and count is published after name and type are set, so readers don't need to lock.
+			std::string _countersNames[(int)DiagnosticsCounters::_MaxCounters];
+			CounterTypes _countersTypes[(int)DiagnosticsCounters::_MaxCounters] = { };
+			std::unordered_map<std::string, int> _countersIds;
+			std::atomic<int> _registeredCountersCount{ 0 };
+			mutable std::mutex _countersMutex;
+
+			// used to sort counters when drawing overlay
+			std::vector<std::pair<long, int>> _overlayScratch;
+
+			// per asset type residency stats
+			AssetsResidencyCounters _assetsResidency[(int)assets::AssetTypes::_Count];
+
+			// profiler hotkey, export file, and if hotkey was down last frame
+			input::KeyCodes _profilerHotkey = input::KeyCodes::KeyUnknown;
+			std::string _profilerExportFilename;
+			bool _profilerHotkeyWasDown = false;
+
+			// allocations totals when last frame ended, and allocations made during last frame
+			AllocationStats _lastAllocationTotals;
+			AllocationStats _frameAllocations;
+
+			// frame times ring buffers, per phase, in milliseconds
+			std::vector<float> _frameTimes[(int)FramePhases::_Count];
+			int _frameTimesWindow = 300;
+			int _frameTimesCount = 0;
+			int _frameTimesIndex = 0;
+
+			// time spent on every phase in current frame
+			double _currFramePhases[(int)FramePhases::_Count] = { 0 };
+
+			// frame budget, in milliseconds
+			double _frameBudget = 1000.0 / 60.0;
+
+			// csv file to write frame stats to on exit
+			std::string _frameStatsCsvOnExit;
+
+			// used to sort frame times when calculating percentiles
+			mutable std::vector<float> _frameStatsScratch;
 
 		protected:
 			/**
@@ -33,8 +80,23 @@ namespace bon
 			 */
 			virtual void _Update(double deltaTime) override;
 
+			/**
+			 * Init diagnostics manager.
+			 */
+			virtual void _Initialize() override;
+
+			/**
+			 * Dispose diagnostics manager.
+			 */
+			virtual void _Dispose() override;
+
 		public:
 
+			/**
+			 * Create diagnostics manager and register built-in counters.
+			 */
+			Diagnostics();
+
 			/**
 			 * Get FPS count based on last second.
 			 * Note: this may not be completely accurate and should only be used for debug purposes.
@@ -65,6 +127,204 @@ namespace bon
 			 * \param counterId Counter id to reset.
 			 */
 			virtual void _ResetCounter(int counterId) override;
+
+			/**
+			 * Set counter value. Useful for gauges.
+			 *
+			 * \param counterId Counter id to set.
+			 * \param value New counter value.
+			 */
+			virtual void _SetCounter(int counterId, long value) override;
+
+			/**
+			 * Get per-frame counter value from last completed frame.
+			 *
+			 * \param counterId Counter id to get.
+			 * \return Counter value at the end of last frame.
+			 */
+			virtual long _GetCounterLastFrame(int counterId) const override { return _countersLastFrame[counterId]; }
+
+			/**
+			 * Register a named counter, or get its id if already registered.
+			 *
+			 * \param name Counter unique name.
+			 * \param type Counter type. Ignored if counter was already registered.
+			 * \return Counter id.
+			 */
+			virtual int RegisterCounter(const char* name, CounterTypes type = CounterTypes::PerFrame) override;
+
+			/**
+			 * Get a registered counter id by name.
+			 *
+			 * \param name Counter name.
+			 * \return Counter id, or -1 if not registered.
+			 */
+			virtual int GetCounterId(const char* name) const override;
+
+			/**
+			 * Get a registered counter name.
+			 *
+			 * \param counterId Counter id.
+			 * \return Counter name, or nullptr if not registered.
+			 */
+			virtual const char* GetCounterName(int counterId) const override;
+
+			/**
+			 * Get a registered counter type.
+			 *
+			 * \param counterId Counter id.
+			 * \return Counter type.
+			 */
+			virtual CounterTypes GetCounterType(int counterId) const override;
+
+			/**
+			 * Get how many counters are registered (including built-ins).
+			 *
+			 * \return Registered counters count.
+			 */
+			virtual int RegisteredCountersCount() const override { return _registeredCountersCount.load(std::memory_order_acquire); }
+
+			/**
+			 * Draw the top counters and their values on screen.
+			 *
+			 * \param font Font to draw with.
+			 * \param topN How many counters to draw, sorted by value.
+			 * \param position Overlay top-left position.
+			 * \param fontSize Font size to draw with, or 0 for font's native size.
+			 */
+			virtual void DrawCountersOverlay(const assets::FontAsset& font, int topN = 10, const framework::PointF& position = framework::PointF(0, 0), int fontSize = 18) override;
+
+			/**
+			 * Get assets residency and eviction statistics for a given asset type.
+			 *
+			 * \param type Asset type to get stats for.
+			 * \return Residency stats snapshot.
+			 */
+			virtual AssetsResidencyStats GetAssetsResidency(assets::AssetTypes type) const override;
+
+			/**
+			 * Get assets residency counters, used by the assets manager to report.
+			 *
+			 * \param type Asset type to get counters for.
+			 * \return Residency counters.
+			 */
+			virtual AssetsResidencyCounters& _GetAssetsResidency(assets::AssetTypes type) override { return _assetsResidency[(int)type]; }
+
+			/**
+			 * Start recording profiled scopes (see BON_PROFILE_SCOPE).
+			 */
+			virtual void StartProfiler() override { Profiler::Start(); }
+
+			/**
+			 * Stop recording profiled scopes.
+			 */
+			virtual void StopProfiler() override { Profiler::Stop(); }
+
+			/**
+			 * Get if profiler is currently recording.
+			 *
+			 * \return True if profiler is recording.
+			 */
+			virtual bool IsProfilerRunning() const override { return Profiler::IsRunning(); }
+
+			/**
+			 * Export recorded profiled scopes to a Chrome trace json file.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool ExportProfiler(const char* filename) override { return Profiler::Export(filename); }
+
+			/**
+			 * Set a hotkey to toggle profiler: first press starts recording, second press stops and exports.
+			 *
+			 * \param key Hotkey to use, or KeyUnknown to disable hotkey.
+			 * \param exportFilename File to export to when profiler stops.
+			 */
+			virtual void SetProfilerHotkey(input::KeyCodes key, const char* exportFilename = "profile.json") override;
+
+			/**
+			 * Enable or disable heap allocations tracking (see AllocationTracker).
+			 *
+			 * \param enable Should we track allocations.
+			 */
+			virtual void EnableAllocationTracker(bool enable) override;
+
+			/**
+			 * Get if heap allocations tracking is enabled.
+			 *
+			 * \return True if tracking allocations.
+			 */
+			virtual bool IsAllocationTrackerEnabled() const override { return AllocationTracker::IsEnabled(); }
+
+			/**
+			 * Get heap allocations made during last frame.
+			 *
+			 * \return Last frame allocations.
+			 */
+			virtual const AllocationStats& GetFrameAllocations() const override { return _frameAllocations; }
+
+			/**
+			 * Write heap allocations per tag to a CSV file. Tags are only collected in debug builds.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool DumpAllocationTags(const char* filename) override { return AllocationTracker::DumpTags(filename); }
+
+			/**
+			 * Get frame time statistics of a given frame phase, over the frame stats window.
+			 * Stats are calculated when called, so avoid calling this multiple times per frame.
+			 *
+			 * \param phase Frame phase to get stats for.
+			 * \return Frame time stats.
+			 */
+			virtual FrameTimeStats GetFrameStats(FramePhases phase = FramePhases::Frame) const override;
+
+			/**
+			 * Set how many recent frames frame stats are calculated on (default to 300).
+			 * Will reset collected frame times.
+			 *
+			 * \param frames Frame stats window size, in frames.
+			 */
+			virtual void SetFrameStatsWindow(int frames) override;
+
+			/**
+			 * Set frame time budget, used to count frames that took too long (default to 60 FPS).
+			 *
+			 * \param milliseconds Frame budget, in milliseconds.
+			 */
+			virtual void SetFrameBudget(double milliseconds) override { _frameBudget = milliseconds; }
+
+			/**
+			 * Write frame time stats of all frame phases to a CSV file.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool DumpFrameStatsCsv(const char* filename) const override;
+
+			/**
+			 * Set a CSV file to write frame time stats to when engine exits.
+			 *
+			 * \param filename Output file path, or nullptr to disable.
+			 */
+			virtual void SetFrameStatsCsvOnExit(const char* filename) override { _frameStatsCsvOnExit = filename ? filename : ""; }
+
+			/**
+			 * Report time spent on a frame phase during current frame. Called by the engine.
+			 *
+			 * \param phase Frame phase.
+			 * \param milliseconds Time spent, in milliseconds.
+			 */
+			virtual void _ReportFramePhase(FramePhases phase, double milliseconds) override { _currFramePhases[(int)phase] += milliseconds; }
+
+			/**
+			 * Report the end of a frame. Called by the engine.
+			 *
+			 * \param frameMilliseconds Whole frame time, in milliseconds.
+			 */
+			virtual void _EndFrame(double frameMilliseconds) override;
 		};
 	}
 }
\ No newline at end of file
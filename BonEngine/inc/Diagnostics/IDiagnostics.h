@@ -8,6 +8,11 @@
 #pragma once
 #include "../dllimport.h"
 #include "../IManager.h"
+#include "../Assets/Defs.h"
+#include "../Input/Defs.h"
+#include "../Framework/Point.h"
+#include "Profiler.h"
+#include <atomic>
 
 namespace bon
 {
@@ -33,16 +38,274 @@ namespace bon
 			   */
 			  LoadedAssets = 2,
 
+			  /**
+			   * Texture binds during this frame.
+			   */
+			  TextureBinds = 3,
+
+			  /**
+			   * Shader program switches during this frame.
+			   */
+			  ShaderSwitches = 4,
+
+			  /**
+			   * Text drawings that found their texture in text cache during this frame.
+			   */
+			  TextCacheHits = 5,
+
+			  /**
+			   * Text drawings that had to render a new texture during this frame.
+			   */
+			  TextCacheMisses = 6,
+
+			  /**
+			   * Total assets actually loaded (not retrieved from cache) since engine started.
+			   */
+			  AssetLoads = 7,
+
+			  /**
+			   * Heap allocations made during last frame, when allocation tracker is enabled.
+			   */
+			  FrameAllocations = 8,
+
+			  /**
+			   * Heap bytes allocated during last frame, when allocation tracker is enabled.
+			   */
+			  FrameAllocatedBytes = 9,
+
+			  /**
+			   * Total sounds that stopped because their voice was stolen by another sound.
+			   */
+			  SoundsStolen = 10,
+
+			  /**
+			   * Total sounds that didn't play because there was no voice to play them on.
+			   */
+			  SoundsDropped = 11,
+
+			  /**
+			   * How many positional sounds are currently virtual (out of range, not using a voice).
+			   */
+			  VirtualVoices = 12,
+
 			  /**
 			   * Last built-in counter value.
-			   * If you want to add custom counters, start here and go up until 'MaxCounters'
+			   * Custom counters registered with RegisterCounter() get ids from here up to 'MaxCounters'.
 			   */
-			  _BuiltInCounterCount = 3,
+			  _BuiltInCounterCount = 13,
 
 			  /**
 			   * Max counters value.
 			   */
-			  _MaxCounters = 50,
+			  _MaxCounters = 256,
+		};
+
+		/**
+		 * Counter types, which determine when counters are reset.
+		 */
+		enum class BON_DLLEXPORT CounterTypes
+		{
+			/**
+			 * Counts events during a single frame, and reset at the beginning of every frame.
+			 * Last frame value is kept and can be read with GetCounterLastFrame().
+			 */
+			PerFrame = 0,
+
+			/**
+			 * Counts events since engine started, and never reset automatically.
+			 */
+			Cumulative = 1,
+
+			/**
+			 * Measures a current amount that goes up and down (like loaded assets), and never reset automatically.
+			 */
+			Gauge = 2,
+		};
+
+		/**
+		 * Per asset type residency and eviction statistics.
+		 * Updated by the assets manager.
+		 */
+		struct BON_DLLEXPORT AssetsResidencyStats
+		{
+			/**
+			 * How many assets of this type are currently loaded.
+			 */
+			long LoadedCount = 0;
+
+			/**
+			 * Estimated memory, in bytes, of all loaded assets of this type.
+			 */
+			long long LoadedBytes = 0;
+
+			/**
+			 * How many assets of this type are currently held by the assets cache.
+			 */
+			long CachedCount = 0;
+
+			/**
+			 * Estimated memory, in bytes, of cached assets of this type.
+			 */
+			long long CachedBytes = 0;
+
+			/**
+			 * How many assets of this type were evicted from cache due to memory budget.
+			 */
+			long Evictions = 0;
+
+			/**
+			 * Total estimated memory, in bytes, evicted from cache for this type.
+			 */
+			long long EvictedBytes = 0;
+		};
+
+		/**
+		 * Per asset type residency counters, updated by the assets manager.
+		 * Counters are atomic since assets may load and dispose on any thread, while stats are read from others.
+		 * Internal - use GetAssetsResidency() to get a snapshot.
+		 */
+		struct AssetsResidencyCounters
+		{
+			std::atomic<long> LoadedCount{ 0 };
+			std::atomic<long long> LoadedBytes{ 0 };
+			std::atomic<long> CachedCount{ 0 };
+			std::atomic<long long> CachedBytes{ 0 };
+			std::atomic<long> Evictions{ 0 };
+			std::atomic<long long> EvictedBytes{ 0 };
+
+			/**
+			 * Get a snapshot of the counters.
+			 */
+			AssetsResidencyStats Snapshot() const
+			{
+				AssetsResidencyStats ret;
+				ret.LoadedCount = LoadedCount.load(std::memory_order_relaxed);
+				ret.LoadedBytes = LoadedBytes.load(std::memory_order_relaxed);
+				ret.CachedCount = CachedCount.load(std::memory_order_relaxed);
+				ret.CachedBytes = CachedBytes.load(std::memory_order_relaxed);
+				ret.Evictions = Evictions.load(std::memory_order_relaxed);
+				ret.EvictedBytes = EvictedBytes.load(std::memory_order_relaxed);
+				return ret;
+			}
+		};
+
+		/**
+		 * Frame phases we measure timing for.
+		 */
+		enum class BON_DLLEXPORT FramePhases
+		{
+			/**
+			 * Whole frame, from one frame start to the next.
+			 */
+			Frame = 0,
+
+			/**
+			 * Scene update.
+			 */
+			Update = 1,
+
+			/**
+			 * Scene fixed updates (all fixed updates of the frame combined).
+			 */
+			FixedUpdate = 2,
+
+			/**
+			 * Scene draw.
+			 */
+			Draw = 3,
+
+			/**
+			 * Presenting the frame on screen (including waiting for vsync, if enabled).
+			 */
+			Present = 4,
+
+			/**
+			 * GPU time of the whole frame (sum of all GPU phases below).
+			 * GPU phases are only measured when GPU timers are enabled (see Gfx().EnableGpuTimers()), and arrive a few frames late.
+			 */
+			GpuFrame = 5,
+
+			/**
+			 * GPU time spent on clearing the screen or images.
+			 */
+			GpuClear = 6,
+
+			/**
+			 * GPU time spent on drawing to screen with default effects.
+			 */
+			GpuDraw = 7,
+
+			/**
+			 * GPU time spent on drawing to screen with custom effects.
+			 */
+			GpuEffects = 8,
+
+			/**
+			 * GPU time spent on drawing to images (render targets).
+			 */
+			GpuRenderToTexture = 9,
+
+			/**
+			 * GPU time spent on presenting the frame.
+			 */
+			GpuPresent = 10,
+
+			/**
+			 * Number of frame phases.
+			 */
+			_Count = 11,
+		};
+
+		/**
+		 * Number of buckets in frame time histogram.
+		 * Buckets are log-scaled, see FrameTimeHistogramUpperBound().
+		 */
+		const int FrameTimeHistogramBuckets = 20;
+
+		/**
+		 * Get frame time histogram bucket upper bound, in milliseconds.
+		 * Every bucket is sqrt(2) times bigger than the previous one, starting from 0.5ms. 
+		 * Last bucket also counts all frames above its upper bound.
+		 *
+		 * \param bucket Bucket index.
+		 * \return Bucket upper bound, in milliseconds.
+		 */
+		BON_DLLEXPORT double FrameTimeHistogramUpperBound(int bucket);
+
+		/**
+		 * Frame time statistics over the frame stats window.
+		 * All times are in milliseconds.
+		 */
+		struct BON_DLLEXPORT FrameTimeStats
+		{
+			/**
+			 * How many frames these stats are based on.
+			 */
+			int FramesCount = 0;
+
+			/**
+			 * Min, max and mean frame time.
+			 */
+			double Min = 0;
+			double Max = 0;
+			double Mean = 0;
+
+			/**
+			 * Frame time percentiles.
+			 */
+			double P50 = 0;
+			double P95 = 0;
+			double P99 = 0;
+
+			/**
+			 * How many frames took longer than frame budget.
+			 */
+			int FramesOverBudget = 0;
+
+			/**
+			 * Log-bucketed histogram of frame times.
+			 */
+			int Histogram[FrameTimeHistogramBuckets] = { 0 };
 		};
 
 		/**
@@ -75,7 +338,7 @@ namespace bon
 			 * \param counterId Counter id to get.
 			 * \param increaseBy How much to increase counter.
 			 */
-			inline void IncreaseCounter(DiagnosticsCounters counterId, int increaseBy = 1) { _IncreaseCounter((int)(counterId)); }
+			inline void IncreaseCounter(DiagnosticsCounters counterId, int increaseBy = 1) { _IncreaseCounter((int)(counterId), increaseBy); }
 
 			/**
 			 * Reset counter value.
@@ -84,6 +347,67 @@ namespace bon
 			 */
 			inline void ResetCounter(DiagnosticsCounters counterId) { _ResetCounter((int)(counterId)); }
 
+			/**
+			 * Get per-frame counter value from last completed frame.
+			 *
+			 * \param counterId Counter id to get.
+			 * \return Counter value at the end of last frame.
+			 */
+			inline long GetCounterLastFrame(DiagnosticsCounters counterId) const { return _GetCounterLastFrame((int)(counterId)); }
+
+			/**
+			 * Register a named counter, or get its id if already registered.
+			 * Register counters once (for example when scene loads) and keep their id, then use the _underscore counter methods with it.
+			 * 
+			 * \param name Counter unique name.
+			 * \param type Counter type. Ignored if counter was already registered.
+			 * \return Counter id.
+			 */
+			virtual int RegisterCounter(const char* name, CounterTypes type = CounterTypes::PerFrame) = 0;
+
+			/**
+			 * Get a registered counter id by name.
+			 *
+			 * \param name Counter name.
+			 * \return Counter id, or -1 if not registered.
+			 */
+			virtual int GetCounterId(const char* name) const = 0;
+
+			/**
+			 * Get a registered counter name.
+			 *
+			 * \param counterId Counter id.
+			 * \return Counter name, or nullptr if not registered.
+			 */
+			virtual const char* GetCounterName(int counterId) const = 0;
+
+			/**
+			 * Get a registered counter type.
+			 *
+			 * \param counterId Counter id.
+			 * \return Counter type.
+			 */
+			virtual CounterTypes GetCounterType(int counterId) const = 0;
+
+			/**
+			 * Get how many counters are registered (including built-ins).
+			 * Registered counters ids are 0 to RegisteredCountersCount() - 1.
+			 *
+			 * \return Registered counters count.
+			 */
+			virtual int RegisteredCountersCount() const = 0;
+
+			/**
+			 * Draw the top counters and their values on screen.
+			 * Per-frame counters show their last frame value. Call this from your scene's draw.
+			 *
+			 * \param font Font to draw with.
+			 * \param topN How many counters to draw, sorted by value.
+			 * \param position Overlay top-left position.
+			 * \param fontSize Font size to draw with, or 0 for font's native size.
+			 */
+			virtual void DrawCountersOverlay(const assets::FontAsset& font, int topN = 10, const framework::PointF& position = framework::PointF(0, 0), int fontSize = 18) = 0;
+
 			/**
 			 * Get counter value.
 			 * 
@@ -107,6 +431,158 @@ namespace bon
 			 */
 			virtual void _ResetCounter(int counterId) = 0;
 
+			/**
+			 * Set counter value. Useful for gauges.
+			 *
+			 * \param counterId Counter id to set.
+			 * \param value New counter value.
+			 */
+			virtual void _SetCounter(int counterId, long value) = 0;
+
+			/**
+			 * Get per-frame counter value from last completed frame.
+			 *
+			 * \param counterId Counter id to get.
+			 * \return Counter value at the end of last frame.
+			 */
+			virtual long _GetCounterLastFrame(int counterId) const = 0;
+
+			/**
+			 * Get assets residency and eviction statistics for a given asset type.
+			 * Throws InvalidValue if type is not a valid asset type.
+			 *
+			 * \param type Asset type to get stats for.
+			 * \return Residency stats snapshot.
+			 */
+			virtual AssetsResidencyStats GetAssetsResidency(assets::AssetTypes type) const = 0;
+
+			/**
+			 * Get assets residency counters, used by the assets manager to report.
+			 *
+			 * \param type Asset type to get counters for.
+			 * \return Residency counters.
+			 */
+			virtual AssetsResidencyCounters& _GetAssetsResidency(assets::AssetTypes type) = 0;
+
+			/**
+			 * Start recording profiled scopes (see BON_PROFILE_SCOPE).
+			 */
+			virtual void StartProfiler() = 0;
+
+			/**
+			 * Stop recording profiled scopes.
+			 */
+			virtual void StopProfiler() = 0;
+
+			/**
+			 * Get if profiler is currently recording.
+			 *
+			 * \return True if profiler is recording.
+			 */
+			virtual bool IsProfilerRunning() const = 0;
+
+			/**
+			 * Export recorded profiled scopes to a Chrome trace json file.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool ExportProfiler(const char* filename) = 0;
+
+			/**
+			 * Set a hotkey to toggle profiler: first press starts recording, second press stops and exports.
+			 *
+			 * \param key Hotkey to use, or KeyUnknown to disable hotkey.
+			 * \param exportFilename File to export to when profiler stops.
+			 */
+			virtual void SetProfilerHotkey(input::KeyCodes key, const char* exportFilename = "profile.json") = 0;
+
+			/**
+			 * Enable or disable heap allocations tracking (see AllocationTracker).
+			 * When enabled, allocations are counted per frame and per profiled scope.
+			 *
+			 * \param enable Should we track allocations.
+			 */
+			virtual void EnableAllocationTracker(bool enable) = 0;
+
+			/**
+			 * Get if heap allocations tracking is enabled.
+			 *
+			 * \return True if tracking allocations.
+			 */
+			virtual bool IsAllocationTrackerEnabled() const = 0;
+
+			/**
+			 * Get heap allocations made during last frame.
+			 *
+			 * \return Last frame allocations.
+			 */
+			virtual const AllocationStats& GetFrameAllocations() const = 0;
+
+			/**
+			 * Write heap allocations per tag to a CSV file. Tags are only collected in debug builds.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool DumpAllocationTags(const char* filename) = 0;
+
+			/**
+			 * Get frame time statistics of a given frame phase, over the frame stats window.
+			 * Stats are calculated when called, so avoid calling this multiple times per frame.
+			 *
+			 * Throws InvalidValue if phase is not a valid frame phase.
+			 *
+			 * \param phase Frame phase to get stats for.
+			 * \return Frame time stats.
+			 */
+			virtual FrameTimeStats GetFrameStats(FramePhases phase = FramePhases::Frame) const = 0;
+
+			/**
+			 * Set how many recent frames frame stats are calculated on (default to 300).
+			 * Will reset collected frame times.
+			 *
+			 * \param frames Frame stats window size, in frames.
+			 */
+			virtual void SetFrameStatsWindow(int frames) = 0;
+
+			/**
+			 * Set frame time budget, used to count frames that took too long (default to 60 FPS).
+			 *
+			 * \param milliseconds Frame budget, in milliseconds.
+			 */
+			virtual void SetFrameBudget(double milliseconds) = 0;
+
+			/**
+			 * Write frame time stats of all frame phases to a CSV file.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			virtual bool DumpFrameStatsCsv(const char* filename) const = 0;
+
+			/**
+			 * Set a CSV file to write frame time stats to when engine exits.
+			 *
+			 * \param filename Output file path, or nullptr to disable.
+			 */
+			virtual void SetFrameStatsCsvOnExit(const char* filename) = 0;
+
+			/**
+			 * Report time spent on a frame phase during current frame. Called by the engine.
+			 *
+			 * \param phase Frame phase.
+			 * \param milliseconds Time spent, in milliseconds.
+			 */
+			virtual void _ReportFramePhase(FramePhases phase, double milliseconds) = 0;
+
+			/**
+			 * Report the end of a frame. Called by the engine.
+			 *
+			 * \param frameMilliseconds Whole frame time, in milliseconds.
+			 */
+			virtual void _EndFrame(double frameMilliseconds) = 0;
+
 		protected:
 			/**
 			 * Get manager identifier.
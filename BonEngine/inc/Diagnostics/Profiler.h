@@ -0,0 +1,133 @@
+/*****************************************************************//**
+ * \file   Profiler.h
+ * \brief  Scoped CPU profiler, with Chrome trace export.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "AllocationTracker.h"
+#include <cstdint>
+#include <atomic>
+
+
+namespace bon
+{
+	namespace diagnostics
+	{
+		/**
+		 * Scoped CPU profiler.
+		 * Records named scopes with nanoseconds timestamps into per-thread ring buffers, and export them to Chrome trace format.
+		 * Open exported files in 'chrome://tracing' or 'ui.perfetto.dev'.
+		 * When profiler is not running, scopes only cost a single flag check.
+		 * Use the BON_PROFILE_SCOPE(name) macro to profile a scope.
+		 */
+		class BON_DLLEXPORT Profiler
+		{
+		public:
+			/**
+			 * Max events kept per thread. When exceeded, oldest events are overwritten.
+			 */
+			static const uint32_t MaxEventsPerThread = 1 << 16;
+
+			/**
+			 * Start recording profiled scopes.
+			 * Events from previous sessions are discarded.
+			 */
+			static void Start();
+
+			/**
+			 * Stop recording profiled scopes.
+			 */
+			static void Stop();
+
+			/**
+			 * Get if profiler is currently recording.
+			 */
+			static inline bool IsRunning() { return _running.load(std::memory_order_relaxed); }
+
+			/**
+			 * Export recorded events to Chrome trace json file.
+			 * Best called after Stop(), since events recorded by other threads during export may be overwritten.
+			 * Note: events of threads that exited are kept until exported (or until next Start()), then their buffers are reused by new threads.
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			static bool Export(const char* filename);
+
+			/**
+			 * Get current time, in nanoseconds.
+			 */
+			static uint64_t _Now();
+
+			/**
+			 * Record a profiled scope on the current thread.
+			 *
+			 * \param name Scope name. Must remain valid until exported (normally a string literal).
+			 * \param start Scope start time, in nanoseconds.
+			 * \param end Scope end time, in nanoseconds.
+			 * \param allocations Heap allocations made during scope (see AllocationTracker).
+			 * \param allocatedBytes Heap bytes allocated during scope.
+			 */
+			static void _Record(const char* name, uint64_t start, uint64_t end, uint64_t allocations = 0, uint64_t allocatedBytes = 0);
+
+		private:
+			// is profiler currently recording
+			static std::atomic<bool> _running;
+		};
+
+		/**
+		 * Record a profiled scope from construction to destruction.
+		 * Don't use directly, use BON_PROFILE_SCOPE() instead.
+		 */
+		class ProfileScope
+		{
+		private:
+			// scope name, or nullptr if profiler was not running when scope started
+			const char* _name;
+
+			// scope start time
+			uint64_t _start;
+
+			// thread allocations when scope started
+			AllocationStats _allocations;
+
+		public:
+			/**
+			 * Start profiled scope.
+			 */
+			inline ProfileScope(const char* name) : _name(Profiler::IsRunning() ? name : nullptr), _start(_name ? Profiler::_Now() : 0) 
+			{
+				if (_name) { _allocations = AllocationTracker::GetThreadTotals(); }
+			}
+
+			/**
+			 * End profiled scope.
+			 */
+			inline ~ProfileScope() 
+			{ 
+				if (_name) 
+				{ 
+					AllocationStats allocations = AllocationTracker::GetThreadTotals();
+					Profiler::_Record(_name, _start, Profiler::_Now(), allocations.Allocations - _allocations.Allocations, allocations.Bytes - _allocations.Bytes);
+				} 
+			}
+		};
+	}
+}
+
+/**
+ * Profile the current scope under a given name.
+ * Name must remain valid until exported (normally a string literal).
+ * In debug builds, name is also used as allocations tag (see BON_ALLOCATION_TAG).
+ * Define BON_DISABLE_PROFILER to compile profiled scopes out.
+ */
+#ifndef BON_DISABLE_PROFILER
+#define _BON_PROFILE_CONCAT2(a, b) a##b
+#define _BON_PROFILE_CONCAT(a, b) _BON_PROFILE_CONCAT2(a, b)
+#define BON_PROFILE_SCOPE(name) bon::diagnostics::ProfileScope _BON_PROFILE_CONCAT(_bonProfileScope, __LINE__)(name); BON_ALLOCATION_TAG(name)
+#else
+#define BON_PROFILE_SCOPE(name) BON_ALLOCATION_TAG(name)
+#endif
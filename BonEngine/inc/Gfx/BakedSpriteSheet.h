@@ -0,0 +1,95 @@
+/*****************************************************************//**
+ * \file   BakedSpriteSheet.h
+ * \brief  Baked binary spritesheet format, with animation frames and bookmarks ready to use.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Suffix added to spritesheet config path to get its baked version path, by convention.
+		 * For example, the baked version of 'player_spritesheet.ini' is 'player_spritesheet.ini.bsheet'.
+		 */
+		const char* const BakedSpriteSheetSuffix = ".bsheet";
+
+		/**
+		 * Current baked spritesheet format version.
+		 */
+		const uint32_t BakedSpriteSheetVersion = 1;
+
+		/**
+		 * Baked spritesheet file header.
+		 * File layout: [header] [animations] [frames] [bookmarks] [strings].
+		 * All values are stored in little-endian.
+		 */
+		struct BakedSpriteSheetHeader
+		{
+			// file magic, must be 'BSHT'
+			char Magic[4];
+
+			// format version
+			uint32_t Version;
+
+			// how many sprites there are in spritesheet, on X and Y axis
+			int32_t SpritesCountX;
+			int32_t SpritesCountY;
+
+			// number of animations, frames (of all animations) and bookmarks
+			uint32_t AnimationsCount;
+			uint32_t FramesCount;
+			uint32_t BookmarksCount;
+
+			// size of strings block, in bytes
+			uint32_t StringsSize;
+		};
+
+		/**
+		 * A single animation in baked spritesheet.
+		 */
+		struct BakedSpriteSheetAnimation
+		{
+			// animation identifier offset in strings block
+			uint32_t NameOffset;
+
+			// index of animation's first frame, and how many frames it has
+			uint32_t FirstFrame;
+			uint32_t FramesCount;
+
+			// does this animation repeat (0 / 1)
+			uint32_t Repeats;
+		};
+
+		/**
+		 * A single animation frame in baked spritesheet.
+		 */
+		struct BakedSpriteSheetFrame
+		{
+			// sprite index in spritesheet
+			int32_t IndexX;
+			int32_t IndexY;
+
+			// frame duration, in seconds
+			float Duration;
+		};
+
+		/**
+		 * A single bookmark in baked spritesheet.
+		 */
+		struct BakedSpriteSheetBookmark
+		{
+			// bookmark identifier offset in strings block
+			uint32_t NameOffset;
+
+			// sprite index in spritesheet
+			int32_t IndexX;
+			int32_t IndexY;
+		};
+	}
+}
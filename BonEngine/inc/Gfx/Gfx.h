@@ -279,6 +279,16 @@ namespace bon
 			 * \return New image containing whats currently rendered on screen.
 			 */
 			virtual assets::ImageAsset CreateImageFromScreen() const override;
+
+			/**
+			 * Enable or disable GPU timer queries, to measure GPU time of frame phases (clear, draw, effects, render to texture and present).
+			 * Results are read back a few frames late to avoid stalls, and reported to Diagnostics as the Gpu* frame phases.
+			 * Requires OpenGL renderer with timer queries support.
+			 *
+			 * \param enable True to enable GPU timers, false to disable.
+			 * \return True if succeed, false if GPU timers are not supported.
+			 */
+			virtual bool EnableGpuTimers(bool enable) override;
 		};
 	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <Framework/RectangleF.h>
 #include <Framework/Color.h>
 #include <Gfx/Defs.h>
+#include <Diagnostics/IDiagnostics.h>
 
 typedef unsigned int GLuint;
 typedef int GLint;
@@ -50,6 +51,34 @@ namespace bon
 			 */
 			static bool IsInit();
 
+			/**
+			 * Enable / disable gpu timer queries. 
+			 * Returns false if not supported.
+			 */
+			static bool EnableGpuTimers(bool enable);
+
+			/**
+			 * Get if gpu timer queries are enabled.
+			 */
+			static bool GpuTimersEnabled();
+
+			/**
+			 * Recreate gpu timers queries, must be called when gl context is recreated.
+			 */
+			static void ResetGpuTimers();
+
+			/**
+			 * Set which frame phase gpu timers currently measure (GpuDraw, GpuClear, etc), or _Count to stop measuring.
+			 */
+			static void SetGpuTimerPhase(diagnostics::FramePhases phase);
+
+			/**
+			 * End gpu timers frame and collect results from a few frames ago, to avoid stalling.
+			 * Adds measured time, in milliseconds, to outPhasesMs (indexed by FramePhases).
+			 * Returns false if there were no results.
+			 */
+			static bool EndGpuTimersFrame(double* outPhasesMs);
+
 			/**
 			 * Get current shader program.
 			 */
@@ -49,6 +49,9 @@ namespace bon
 			// currently active effect
 			assets::EffectAsset _currentEffect;
 
+			// true while clearing screen or textures, for gpu timers
+			bool _clearing = false;
+
 #pragma warning (pop)
 
 		public:
@@ -91,6 +94,14 @@ namespace bon
 			 * \param effect Effect to draw with.
 			 */
 			void SetEffect(const assets::EffectAsset& effect);
+
+			/**
+			 * Enable / disable gpu timer queries.
+			 *
+			 * \param enable True to enable gpu timers.
+			 * \return True if succeed, false if not supported.
+			 */
+			bool EnableGpuTimers(bool enable);
 			
 			/**
 			 * Draw an image on screen.
@@ -363,6 +374,11 @@ namespace bon
 			 */
 			void RestoreDefaultStates();
 
+			/**
+			 * Set gpu timers phase based on current state (clearing, render target and effect).
+			 */
+			void UpdateGpuTimerPhase();
+
 			/**
 			 * Draw texture directly. Used internally.
 			 */
@@ -250,6 +250,16 @@ namespace bon
 			 */
 			virtual assets::ImageAsset CreateImageFromScreen() const = 0;
 
+			/**
+			 * Enable or disable GPU timer queries, to measure GPU time of frame phases (clear, draw, effects, render to texture and present).
+			 * Results are read back a few frames late to avoid stalls, and reported to Diagnostics as the Gpu* frame phases.
+			 * Requires OpenGL renderer with timer queries support.
+			 *
+			 * \param enable True to enable GPU timers, false to disable.
+			 * \return True if succeed, false if GPU timers are not supported.
+			 */
+			virtual bool EnableGpuTimers(bool enable) = 0;
+
 		protected:
 
 			/**
@@ -13,9 +13,11 @@
 #include "../Framework/Point.h"
 #include "../Framework/Rectangle.h"
 #include "Sprite.h"
+#include "BakedSpriteSheet.h"
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
 
 #pragma warning ( push )
 #pragma warning ( disable: 4251 ) // "..needs to have dll-interface to be used by clients..." it's ok in this case because its private.
@@ -110,11 +112,62 @@ namespace bon
 			 * Get animation steps count.
 			 */
 			int StepsCount() const { return (int)_steps.size(); }
+
+			/**
+			 * Get animation steps.
+			 */
+			const std::vector<SpriteAnimationStep>& Steps() const { return _steps; }
 		};
 
 		// Sprite animation pointer type
 		typedef std::shared_ptr<SpriteAnimation> SpriteAnimationPtr;
 
+		/**
+		 * Animation handle - identify an animation in a spritesheet.
+		 * Get it once from the animation identifier with SpriteSheet::GetAnimationHandle(), and use it to animate sprites without string lookups.
+		 */
+		typedef int AnimationHandle;
+
+		/**
+		 * Invalid animation handle value.
+		 */
+		const AnimationHandle InvalidAnimationHandle = -1;
+
+		/**
+		 * Compact per-sprite animation state, used to animate sprites with animation handles.
+		 */
+		struct BON_DLLEXPORT AnimationState
+		{
+		public:
+			// Animation currently playing.
+			AnimationHandle Animation = InvalidAnimationHandle;
+
+			// Current animation frame (step) index.
+			int Frame = 0;
+
+			// How long, in seconds, we've been in current frame.
+			float Elapsed = 0.0f;
+
+			/**
+			 * Create empty animation state.
+			 */
+			AnimationState() {}
+
+			/**
+			 * Create animation state for a given animation.
+			 *
+			 * \param animation Animation to play.
+			 */
+			AnimationState(AnimationHandle animation) : Animation(animation) {}
+
+			/**
+			 * Switch animation and start it from first frame.
+			 *
+			 * \param animation Animation to play.
+			 */
+			inline void Reset(AnimationHandle animation) { Animation = animation; Frame = 0; Elapsed = 0.0f; }
+		};
+
 		/**
 		 * A sprite sheet with animations.
 		 * You can load sprite sheets from config files.
@@ -125,9 +178,76 @@ namespace bon
 			// spritesheet animations
 			std::unordered_map<std::string, SpriteAnimationPtr> _animations;
 
+			// animation handles by identifier, and animations by handle
+			std::unordered_map<std::string, AnimationHandle> _animationHandles;
+			std::vector<SpriteAnimationPtr> _animationsByHandle;
+
+			/**
+			 * Animation handle cache that can be read and written from const methods on multiple threads.
+			 * Atomic, but copyable so spritesheets remain copyable.
+			 */
+			struct CachedAnimationHandle
+			{
+				std::atomic<AnimationHandle> Value;
+				CachedAnimationHandle() : Value(InvalidAnimationHandle) {}
+				CachedAnimationHandle(const CachedAnimationHandle& other) : Value(other.Value.load(std::memory_order_relaxed)) {}
+				CachedAnimationHandle& operator=(const CachedAnimationHandle& other) { Value.store(other.Value.load(std::memory_order_relaxed), std::memory_order_relaxed); return *this; }
+			};
+
+			// last animation handle found by identifier, so repeated lookups of the same animation skip the handles map
+			mutable CachedAnimationHandle _lastFoundAnimation;
+
+			/**
+			 * Frames range of a single animation in the flat frames arrays.
+			 */
+			struct AnimationFrames
+			{
+				int First;
+				int Count;
+				bool Repeats;
+			};
+
+			// flat animation frames data, built from animations steps on first use after animations change
+			mutable std::vector<AnimationFrames> _animationFrames;
+			mutable std::vector<framework::PointI> _frameIndices;
+			mutable std::vector<float> _frameDurations;
+			mutable bool _framesDirty = true;
+
+			// frames source rects and the image size they were calculated for (rebuilt if sprite image size changes)
+			mutable std::vector<framework::RectangleI> _frameRects;
+			mutable framework::PointI _frameRectsImageSize;
+			mutable framework::PointI _frameSize;
+
+			/**
+			 * Build flat frames arrays from animations steps.
+			 */
+			void BuildFrames() const;
+
+			/**
+			 * Build frames source rects for a given image size.
+			 */
+			void BuildFrameRects(const framework::PointI& imageSize) const;
+
+			/**
+			 * Try to load spritesheet from baked file.
+			 *
+			 * \param filename Baked spritesheet file path.
+			 * \return True if loaded, false if file is missing or invalid (spritesheet will remain unchanged).
+			 */
+			bool TryLoadFromBaked(const char* filename);
+
 			// spritesheet bookmarks
 			std::unordered_map<std::string, framework::PointI> _bookmarks;
 
+			// config we loaded from (only kept when assets hot reload is enabled) and its reloads count, to rebuild when it reloads
+			assets::ConfigAsset _config;
+			unsigned int _configReloadCount = 0;
+
+			/**
+			 * Reload spritesheet if its config was hot-reloaded.
+			 */
+			void RefreshIfReloaded() const;
+
 		public:
 			/**
 			 * How many sprites we have on X and Y axis inside the spritesheet.
@@ -161,9 +281,30 @@ namespace bon
 			 *				*		- optional, contains a list of values where every key is a bookmark identifier and value is sprite index "x,y".
 			 *				*			later, you can use this to set sprites from spritesheet by names. for example: sheet.SetSprite(sprite, "item_sword");
 			 *	For more info, check out demo_spritesheet.ini in test assets folder.
+			 *	Note: if assets hot reload is enabled, spritesheet will reload automatically when config file changes, 
+			 *	discarding animations and bookmarks that were added manually.
 			 */
 			void LoadFromConfig(assets::ConfigAsset config);
 
+			/**
+			 * Load the spritesheet from a baked spritesheet file (see Bake()).
+			 * Baked spritesheets are opt-in: LoadFromConfig() always parses the config, even if a baked version exists next to it.
+			 *
+			 * \param filename Baked spritesheet file path.
+			 */
+			void LoadFromBaked(const char* filename);
+
+			/**
+			 * Bake this spritesheet into a binary file, which loads much faster than parsing config.
+			 * Baked files contain sprites count, animations with their frames, and bookmarks.
+			 *
+			 * To use it, load it with LoadFromBaked(). By convention, save it next to the config file with BakedSpriteSheetSuffix (for example 'player.ini.bsheet').
+			 *
+			 * \param filename Output file path.
+			 * \return True if succeed, false otherwise.
+			 */
+			bool Bake(const char* filename) const;
+
 			/**
 			 * Set a sprite's source rectangle from index in spritesheet.
 			 * 
@@ -200,6 +341,31 @@ namespace bon
 			 */
 			void Animate(Sprite& sprite, const char* animationId, double& progress, double deltaTime, int* currStep = nullptr, bool* didFinish = nullptr, float sizeFactor = 1.0f) const;
 
+			/**
+			 * Animate a sprite using animation handle and state.
+			 * This is the faster way to animate sprites, as it doesn't involve any string lookups or allocations.
+			 * Note: animation steps are read when the animation is added to spritesheet. If you change an animation after adding it, add it again.
+			 *
+			 * \param sprite Sprite object to animate.
+			 * \param state Sprite's animation state (animation handle, frame and elapsed time). You need to keep it between Animate() calls.
+			 * \param deltaTime Current animation step's delta time, ie how much to advance animation.
+			 * \param sizeFactor Set the size of the sprite to be tilesheet sprite's size multiplied by this value.
+			 *						If set to 0, will not change sprite size.
+			 * \return True if animation finished.
+			 *					Note: if animation repeats, will return true every time animation resets, for a single frame.
+			 *						  if animation don't repeat, will remain 'true' once animation finished its final step.
+			 */
+			bool Animate(Sprite& sprite, AnimationState& state, double deltaTime, float sizeFactor = 1.0f) const;
+
+			/**
+			 * Get animation handle from identifier.
+			 * Handles are assigned in the order animations are added, so they remain valid after reloading the spritesheet from a config with the same animations list.
+			 *
+			 * \param animationId Animation identifier.
+			 * \return Animation handle, or InvalidAnimationHandle if not found.
+			 */
+			AnimationHandle GetAnimationHandle(const char* animationId) const;
+
 			/**
 			 * Get animation from identifier.
 			 * 
@@ -210,6 +376,8 @@ namespace bon
 
 			/**
 			 * Add animation to spritesheet.
+			 * If an animation with the same identifier already exists, it will be replaced (and keep its handle).
+			 * Note: animations without steps can be added, but animating them with AnimationState will throw.
 			 * 
 			 * \param animation Animation instance.
 			 */
@@ -353,13 +353,86 @@ namespace bon
 				MouseRight,
 				MouseX1,
 				MouseX2,
+
+				GamepadA,
+				GamepadB,
+				GamepadX,
+				GamepadY,
+				GamepadBack,
+				GamepadGuide,
+				GamepadStart,
+				GamepadLeftStick,
+				GamepadRightStick,
+				GamepadLeftShoulder,
+				GamepadRightShoulder,
+				GamepadDpadUp,
+				GamepadDpadDown,
+				GamepadDpadLeft,
+				GamepadDpadRight,
+				GamepadLeftTrigger,
+				GamepadRightTrigger,
 		};
+
+		/**
+		 * Number of key codes.
+		 */
+		const int KeyCodesCount = (int)KeyCodes::GamepadRightTrigger + 1;
+
+		/**
+		 * Number of gamepad buttons (including triggers, which also act as buttons).
+		 * Gamepad buttons are the key codes from GamepadA to GamepadRightTrigger.
+		 */
+		const int GamepadButtonsCount = (int)KeyCodes::GamepadRightTrigger - (int)KeyCodes::GamepadA + 1;
+
+		/**
+		 * Max number of gamepads connected at the same time (players).
+		 */
+		const int MaxGamepads = 4;
+
+		/**
+		 * Gamepad analog axes.
+		 */
+		enum class BON_DLLEXPORT GamepadAxes
+		{
+			// left stick, -1 to 1
+			LeftX,
+			LeftY,
+
+			// right stick, -1 to 1
+			RightX,
+			RightY,
+
+			// triggers, 0 to 1
+			LeftTrigger,
+			RightTrigger,
+		};
+
+		/**
+		 * Number of gamepad axes.
+		 */
+		const int GamepadAxesCount = (int)GamepadAxes::RightTrigger + 1;
+
+		/**
+		 * Action identifier - an interned action name, used to query actions without string lookups.
+		 * Get it once from action name with IInput::GetActionId().
+		 */
+		typedef int ActionId;
+
+		/**
+		 * Invalid / unknown action id.
+		 */
+		const ActionId InvalidActionId = -1;
 	
 		/**
 		 * Convert string to a key code value.
 		 */
 		KeyCodes _StrToKeyCode(const char* str);
 
+		/**
+		 * Convert key code value to string.
+		 */
+		const char* _KeyCodeToString(KeyCodes key);
+
 		/**
 		* To convert:
 			for i in original_enum.split('\n'):
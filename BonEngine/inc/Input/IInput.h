@@ -51,6 +51,39 @@ namespace bon
 			 */
 			virtual bool PressedNow(const char* actionId) const = 0;
 
+			/**
+			 * Get action id from action name, to query actions without string lookups.
+			 * Action ids are created on first request, so its valid to get ids of actions that are not bound to any key yet.
+			 *
+			 * \param actionId Action identifier, based on mapping.
+			 * \return Action id.
+			 */
+			virtual ActionId GetActionId(const char* actionId) = 0;
+
+			/**
+			 * Get if a given game action is down.
+			 *
+			 * \param action Action id (see GetActionId()).
+			 * \return If input action is currently down.
+			 */
+			virtual bool Down(ActionId action) const = 0;
+
+			/**
+			 * Get if a given game action was released this frame
+			 *
+			 * \param action Action id (see GetActionId()).
+			 * \return If input action was released now.
+			 */
+			virtual bool ReleasedNow(ActionId action) const = 0;
+
+			/**
+			 * Get if a given game action was pressed this frame
+			 *
+			 * \param action Action id (see GetActionId()).
+			 * \return If input action was pressed now.
+			 */
+			virtual bool PressedNow(ActionId action) const = 0;
+
 			/**
 			 * Get if a key code is down.
 			 *
@@ -157,6 +190,121 @@ namespace bon
 			 */
 			virtual const TextInputData& GetTextInput() const = 0;
 
+			/**
+			 * Get if a gamepad is connected to a given player slot.
+			 * Gamepads are assigned to the first free player slot when connected.
+			 *
+			 * \param player Player index (0 to MaxGamepads - 1).
+			 * \return True if player slot has a connected gamepad.
+			 */
+			virtual bool GamepadConnected(int player) const = 0;
+
+			/**
+			 * Get how many gamepads are currently connected.
+			 */
+			virtual int GamepadsCount() const = 0;
+
+			/**
+			 * Get if a gamepad button of a specific player is down.
+			 * Note: to check gamepad buttons of any player, or bind them to actions, use the gamepad key codes with the regular Down() / PressedNow() / ReleasedNow().
+			 *
+			 * \param player Player index.
+			 * \param button Gamepad button key code (GamepadA to GamepadRightTrigger).
+			 * \return If button is currently down.
+			 */
+			virtual bool GamepadDown(int player, KeyCodes button) const = 0;
+
+			/**
+			 * Get if a gamepad button of a specific player was pressed this frame.
+			 *
+			 * \param player Player index.
+			 * \param button Gamepad button key code (GamepadA to GamepadRightTrigger).
+			 * \return If button was pressed now.
+			 */
+			virtual bool GamepadPressedNow(int player, KeyCodes button) const = 0;
+
+			/**
+			 * Get if a gamepad button of a specific player was released this frame.
+			 *
+			 * \param player Player index.
+			 * \param button Gamepad button key code (GamepadA to GamepadRightTrigger).
+			 * \return If button was released now.
+			 */
+			virtual bool GamepadReleasedNow(int player, KeyCodes button) const = 0;
+
+			/**
+			 * Get gamepad axis value, after applying dead zones.
+			 *
+			 * \param player Player index.
+			 * \param axis Axis to get.
+			 * \return Axis value, from -1 to 1 for sticks and from 0 to 1 for triggers.
+			 */
+			virtual float GamepadAxis(int player, GamepadAxes axis) const = 0;
+
+			/**
+			 * Set gamepad dead zones.
+			 * Stick values inside dead zone (measured by distance from center) return 0, and values outside it are rescaled to start from 0.
+			 *
+			 * \param sticks Sticks dead zone, from 0 to 1.
+			 * \param triggers Triggers dead zone, from 0 to 1.
+			 */
+			virtual void SetGamepadDeadZones(float sticks, float triggers) = 0;
+
+			/**
+			 * Rumble a player's gamepad.
+			 *
+			 * \param player Player index.
+			 * \param lowFrequency Low frequency (left) motor intensity, from 0 to 1.
+			 * \param highFrequency High frequency (right) motor intensity, from 0 to 1.
+			 * \param durationMs Rumble duration, in milliseconds.
+			 * \return True if rumble is supported and started.
+			 */
+			virtual bool GamepadRumble(int player, float lowFrequency, float highFrequency, unsigned int durationMs) = 0;
+
+			/**
+			 * Start recording input into a file, to replay it later with StartReplay().
+			 * Records every frame's delta time, keys and mouse buttons changes, cursor position, scroll delta and text input.
+			 *
+			 * \param filename File to write recording to.
+			 */
+			virtual void StartRecording(const char* filename) = 0;
+
+			/**
+			 * Stop recording input and close recording file.
+			 */
+			virtual void StopRecording() = 0;
+
+			/**
+			 * Get if currently recording input.
+			 */
+			virtual bool IsRecording() const = 0;
+
+			/**
+			 * Start replaying recorded input.
+			 * While replaying, input events from OS are ignored and every frame's delta time is forced to the recorded value.
+			 *
+			 * \param filename Recording file to replay.
+			 * \param exitWhenDone If true, will exit game when replay ends. Useful to run recorded sessions as benchmarks or tests.
+			 */
+			virtual void StartReplay(const char* filename, bool exitWhenDone = false) = 0;
+
+			/**
+			 * Stop replaying recorded input and return to normal input.
+			 */
+			virtual void StopReplay() = 0;
+
+			/**
+			 * Get if currently replaying recorded input.
+			 */
+			virtual bool IsReplaying() const = 0;
+
+			/**
+			 * Called by the engine before updating managers, to override frame delta time when replaying recorded input.
+			 *
+			 * \param deltaTime Frame delta time, will be set to recorded value if replaying.
+			 */
+			virtual void _OverrideDeltaTime(double& deltaTime) {}
+
 		protected:
 
 			/**
@@ -10,6 +10,13 @@
 #include "IInput.h"
 #include "../Framework/Point.h"
 #include <unordered_map>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+// forward declare sdl game controller
+struct _SDL_GameController;
 
 
 namespace bon
@@ -33,14 +40,37 @@ namespace bon
 				unsigned long long FixedUpdateFrameId = -1;
 			};
 
-			// raw keyboard, keys, scroller and even mouse-move values
-			std::unordered_map<KeyCodes, _ActionStates> _currKeyStates;
+			// raw keyboard and mouse keys states, indexed by key code
+			_ActionStates _currKeyStates[KeyCodesCount];
+
+			// bind keys to actions, indexed by key code
+			ActionId _keyBinds[KeyCodesCount];
+
+			// how many keys are bound to actions
+			int _keyBindsCount = 0;
+
+			// action ids by name, and action names and states indexed by action id
+			std::unordered_map<std::string, ActionId> _actionIds;
+			std::vector<std::string> _actionNames;
+			std::vector<_ActionStates> _actionStates;
+
+			/**
+			 * State of a connected gamepad.
+			 */
+			struct _GamepadState
+			{
+				_SDL_GameController* Controller = nullptr;
+				int InstanceId = -1;
+				_ActionStates Buttons[GamepadButtonsCount];
+				float Axes[GamepadAxesCount] = { 0 };
+			};
 
-			// bind keys to commands
-			std::unordered_map<KeyCodes, std::string> _keyBinds;
+			// gamepads, by player index
+			_GamepadState _gamepads[MaxGamepads];
 
-			// action states
-			std::unordered_map<std::string, _ActionStates> _actionStates;
+			// gamepad dead zones
+			float _sticksDeadZone = 0.2f;
+			float _triggersDeadZone = 0.1f;
 
 			// the position of mouse or other pointers
 			framework::PointI _cursorPosition;
@@ -56,6 +86,11 @@ namespace bon
 
 		public:
 
+			/**
+			 * Create the input manager.
+			 */
+			Input();
+
 			/**
 			 * Get if a given game action is down.
 			 *
@@ -80,6 +115,38 @@ namespace bon
 			 */
 			virtual bool PressedNow(const char* actionId) const override;
 
+			/**
+			 * Get action id from action name, to query actions without string lookups.
+			 *
+			 * \param actionId Action identifier, based on mapping.
+			 * \return Action id.
+			 */
+			virtual ActionId GetActionId(const char* actionId) override;
+
+			/**
+			 * Get if a given game action is down.
+			 *
+			 * \param action Action id.
+			 * \return If input action is currently down.
+			 */
+			virtual bool Down(ActionId action) const override;
+
+			/**
+			 * Get if a given game action was released this frame
+			 *
+			 * \param action Action id.
+			 * \return If input action was released now.
+			 */
+			virtual bool ReleasedNow(ActionId action) const override;
+
+			/**
+			 * Get if a given game action was pressed this frame
+			 *
+			 * \param action Action id.
+			 * \return If input action was pressed now.
+			 */
+			virtual bool PressedNow(ActionId action) const override;
+
 			/**
 			 * Get if a key code is down.
 			 *
@@ -186,15 +253,95 @@ namespace bon
 			 */
 			virtual void LoadControlsFromConfig(const assets::ConfigAsset& config, bool removePreviousBinds) override;
 
+			/**
+			 * Get if a gamepad is connected to a given player slot.
+			 */
+			virtual bool GamepadConnected(int player) const override;
+
+			/**
+			 * Get how many gamepads are currently connected.
+			 */
+			virtual int GamepadsCount() const override;
+
+			/**
+			 * Get if a gamepad button of a specific player is down.
+			 */
+			virtual bool GamepadDown(int player, KeyCodes button) const override;
+
+			/**
+			 * Get if a gamepad button of a specific player was pressed this frame.
+			 */
+			virtual bool GamepadPressedNow(int player, KeyCodes button) const override;
+
+			/**
+			 * Get if a gamepad button of a specific player was released this frame.
+			 */
+			virtual bool GamepadReleasedNow(int player, KeyCodes button) const override;
+
+			/**
+			 * Get gamepad axis value, after applying dead zones.
+			 */
+			virtual float GamepadAxis(int player, GamepadAxes axis) const override;
+
+			/**
+			 * Set gamepad dead zones.
+			 */
+			virtual void SetGamepadDeadZones(float sticks, float triggers) override;
+
+			/**
+			 * Rumble a player's gamepad.
+			 */
+			virtual bool GamepadRumble(int player, float lowFrequency, float highFrequency, unsigned int durationMs) override;
+
+			/**
+			 * Start recording input into a file.
+			 *
+			 * \param filename File to write recording to.
+			 */
+			virtual void StartRecording(const char* filename) override;
+
+			/**
+			 * Stop recording input.
+			 */
+			virtual void StopRecording() override;
+
+			/**
+			 * Get if currently recording input.
+			 */
+			virtual bool IsRecording() const override { return _recordFile.is_open(); }
+
+			/**
+			 * Start replaying recorded input.
+			 *
+			 * \param filename Recording file to replay.
+			 * \param exitWhenDone If true, will exit game when replay ends.
+			 */
+			virtual void StartReplay(const char* filename, bool exitWhenDone = false) override;
+
+			/**
+			 * Stop replaying recorded input.
+			 */
+			virtual void StopReplay() override;
+
+			/**
+			 * Get if currently replaying recorded input.
+			 */
+			virtual bool IsReplaying() const override { return _replaying; }
+
+			/**
+			 * Override frame delta time when replaying recorded input.
+			 */
+			virtual void _OverrideDeltaTime(double& deltaTime) override;
+
 		protected:
 
 			/**
 			 * Get key state of an action.
 			 *
-			 * \param actionId Action to get.
+			 * \param action Action to get.
 			 * \return Action state.
 			 */
-			KeyStates GetState(const char* actionId) const;
+			KeyStates GetState(ActionId action) const;
 
 			/**
 			 * Get key state of a key code.
@@ -204,6 +351,22 @@ namespace bon
 			 */
 			KeyStates GetState(KeyCodes keyCode) const;
 
+			/**
+			 * Get key state from stored action / key state.
+			 *
+			 * \param state Stored state.
+			 * \return Key state.
+			 */
+			KeyStates GetState(const _ActionStates& state) const;
+
+			/**
+			 * Find action id without creating it.
+			 *
+			 * \param actionId Action name.
+			 * \return Action id, or InvalidActionId if action was never used.
+			 */
+			ActionId FindActionId(const char* actionId) const;
+
 			/**
 			 * Initialize manager when engine starts.
 			 */
@@ -242,6 +405,54 @@ namespace bon
 			 */
 			void SetDefaultKeyBinds();
 
+			/**
+			 * Set key state from OS event (also records it, if recording input).
+			 * Ignored while replaying recorded input.
+			 */
+			void SetKeyStateFromEvent(KeyCodes key, bool state);
+
+			/**
+			 * Handle gamepad events (connect, disconnect, buttons and axes).
+			 */
+			void HandleGamepadEvent(SDL_Event& event);
+
+			/**
+			 * Set gamepad button state of a player, and update the matching key code state.
+			 */
+			void SetGamepadButtonState(int player, int button, bool state);
+
+			/**
+			 * Get player index from gamepad instance id, or -1 if not found.
+			 */
+			int GetGamepadPlayer(int instanceId) const;
+
+			/**
+			 * Get gamepad button state of a player.
+			 */
+			KeyStates GetGamepadButtonState(int player, KeyCodes button) const;
+
+			/**
+			 * Write current frame to recording file.
+			 */
+			void WriteRecordedFrame();
+
+			/**
+			 * Read and apply next recorded frame.
+			 */
+			void ReadRecordedFrame();
+
+			// recording file and current frame's recorded data
+			std::ofstream _recordFile;
+			std::vector<uint16_t> _recordKeyEvents;
+			double _recordDeltaTime = 0.0;
+			bool _recordFramePending = false;
+
+			// replay data and position
+			std::vector<char> _replayData;
+			size_t _replayPosition = 0;
+			bool _replaying = false;
+			bool _exitWhenReplayDone = false;
+
 			// current frame's text input data
 			TextInputData _textInputData;
 		};
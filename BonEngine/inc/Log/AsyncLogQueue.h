@@ -0,0 +1,137 @@
+/*****************************************************************//**
+ * \file   AsyncLogQueue.h
+ * \brief  Lock-free queue of packed log records, used by the asynchronous log backend.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "ILog.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstdarg>
+#include <atomic>
+#include <vector>
+
+
+namespace bon
+{
+	namespace log
+	{
+		/**
+		 * Max bytes of packed arguments a single log record can hold.
+		 * Arguments beyond this limit are truncated.
+		 */
+		const size_t LogRecordArgsSize = 224;
+
+		/**
+		 * A single log message, with its arguments packed but not formatted yet.
+		 */
+		struct LogRecord
+		{
+			// message time, in nanoseconds since epoch
+			int64_t Timestamp;
+
+			// message format. must remain valid until record is formatted (normally a string literal)
+			const char* Format;
+
+			// message log level
+			LogLevel Level;
+
+			// were arguments truncated, and how many bytes of packed arguments we have
+			bool Truncated;
+			uint16_t ArgsSize;
+
+			// packed arguments, in the order they appear in format
+			unsigned char Args[LogRecordArgsSize];
+		};
+
+		/**
+		 * Pack log arguments into a log record, based on its format string.
+		 * Strings are copied, so they may be freed after packing.
+		 *
+		 * \param record Record to pack arguments into. Its format must be set.
+		 * \param args Arguments to pack.
+		 */
+		void PackLogArguments(LogRecord& record, va_list args);
+
+		/**
+		 * Format a log record message.
+		 *
+		 * \param record Record to format.
+		 * \param out Output buffer.
+		 * \param outSize Output buffer size.
+		 * \return Formatted message length (without null terminator).
+		 */
+		size_t FormatLogRecord(const LogRecord& record, char* out, size_t outSize);
+
+		/**
+		 * Bounded lock-free multiple producers single consumer queue of log records.
+		 * Producers claim a slot, fill it and publish it. Consumer peeks the oldest published record and releases it when done.
+		 */
+		class AsyncLogQueue
+		{
+		private:
+			// a single slot in queue, with its sequence number used to sync producers and consumer
+			struct Cell
+			{
+				std::atomic<uint64_t> Sequence;
+				LogRecord Record;
+			};
+
+			// queue cells and capacity mask
+			std::vector<Cell> _cells;
+			uint64_t _mask;
+
+			// next position to claim by producers, and next position to consume (only used by consumer)
+			alignas(64) std::atomic<uint64_t> _enqueuePos{ 0 };
+			alignas(64) std::atomic<uint64_t> _dequeuePos{ 0 };
+
+		public:
+			/**
+			 * Create the queue.
+			 *
+			 * \param capacity Max records in queue. Will be rounded up to power of 2.
+			 */
+			AsyncLogQueue(size_t capacity);
+
+			/**
+			 * Try to claim a slot to write a record to.
+			 * Must be followed by a call to Publish().
+			 *
+			 * \param outTicket Claimed slot ticket, to pass to Publish().
+			 * \return Record to fill, or nullptr if queue is full.
+			 */
+			LogRecord* TryClaim(uint64_t& outTicket);
+
+			/**
+			 * Publish a claimed record to the consumer.
+			 *
+			 * \param ticket Ticket returned from TryClaim().
+			 */
+			void Publish(uint64_t ticket);
+
+			/**
+			 * Get oldest published record. Only call from the consumer.
+			 *
+			 * \return Oldest record, or nullptr if there's nothing to consume.
+			 */
+			LogRecord* Peek();
+
+			/**
+			 * Release the record returned by Peek(), so producers can reuse its slot. Only call from the consumer.
+			 */
+			void Release();
+
+			/**
+			 * Get if all claimed records were consumed.
+			 */
+			bool IsEmpty() const { return _dequeuePos.load(std::memory_order_acquire) == _enqueuePos.load(std::memory_order_acquire); }
+
+			/**
+			 * Get queue capacity.
+			 */
+			size_t Capacity() const { return _cells.size(); }
+		};
+	}
+}
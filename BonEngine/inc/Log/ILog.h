@@ -9,6 +9,8 @@
 #include "../dllimport.h"
 #include "../IManager.h"
 #include "LogMacros.h"
+#include <atomic>
+#include <cstdint>
 
 namespace bon
 {
@@ -27,6 +29,74 @@ namespace bon
 			Critical = 4,
 		};
 
+		/**
+		 * Log categories, to control log level per engine subsystem.
+		 */
+		enum class BON_DLLEXPORT LogCategory
+		{
+			General = 0,
+			Gfx = 1,
+			Assets = 2,
+			Input = 3,
+			Sfx = 4,
+			UI = 5,
+			_Count = 6,
+		};
+
+		/**
+		 * Cached log levels per category, so log macros can filter messages with a single branch and without calling the log manager.
+		 * Updated by the default log manager whenever log level or category levels change.
+		 */
+		class BON_DLLEXPORT LogFilter
+		{
+		public:
+			/**
+			 * Get if a message with given level and category will be written.
+			 *
+			 * \param level Message log level.
+			 * \param category Message category.
+			 * \return True if message should be written.
+			 */
+			static inline bool IsEnabled(LogLevel level, LogCategory category) { return (int)level >= _minLevels[(int)category].load(std::memory_order_relaxed); }
+
+			/**
+			 * Set min level to write for a category. Called by log manager.
+			 *
+			 * \param category Category to set.
+			 * \param minLevel Min level to write, or LogLevel::None to write nothing.
+			 */
+			static void _SetMinLevel(LogCategory category, LogLevel minLevel);
+
+			/**
+			 * Check and update rate limit of a rate-limited log call site. Don't use directly, use BON_xLOG_RATE() macros instead.
+			 *
+			 * \param lastWriteTime Call site's last write time.
+			 * \param intervalMs Min interval between writes, in milliseconds.
+			 * \return True if message should be written now.
+			 */
+			static bool _RateLimit(std::atomic<uint64_t>& lastWriteTime, uint64_t intervalMs);
+
+		private:
+			// min level to write, per category
+			static std::atomic<int> _minLevels[(int)LogCategory::_Count];
+		};
+
+		/**
+		 * What to do when writing to asynchronous log while its queue is full.
+		 */
+		enum class BON_DLLEXPORT LogOverflowPolicy
+		{
+			/**
+			 * Drop the message (dropped messages are counted and reported in log).
+			 */
+			Drop = 0,
+
+			/**
+			 * Block the writing thread until there's room in queue.
+			 */
+			Block = 1,
+		};
+
 		/**
 		 * Interface for the log manager.
 		 * Used basically for console prints and logging.
@@ -68,6 +138,73 @@ namespace bon
 			 * Flush log and internal buffers.
 			 */
 			virtual void Flush() = 0;
+
+			/**
+			 * Enable or disable asynchronous logging.
+			 * When enabled, writing only packs the message format and arguments into a lock-free queue, and a background thread formats and writes them.
+			 * Note: while async, message format must remain valid until written (normally a string literal). String arguments are copied.
+			 * 
+			 * \param async Should we write logs asynchronously.
+			 * \param overflowPolicy What to do when queue is full.
+			 * \param capacity Max messages in queue. Only used when async logging starts.
+			 */
+			virtual void SetAsync(bool async, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop, int capacity = 8192) = 0;
+
+			/**
+			 * Get if writing logs asynchronously.
+			 * 
+			 * \return True if async logging is enabled.
+			 */
+			virtual bool IsAsync() const = 0;
+
+			/**
+			 * Get how many messages were dropped because async log queue was full.
+			 * 
+			 * \return Dropped messages count.
+			 */
+			virtual long long DroppedMessagesCount() const = 0;
+
+			/**
+			 * Set log file write buffer size.
+			 * Bigger buffer means less file writes, but more messages lost if process is killed before flushing.
+			 * 
+			 * \param bufferSize Buffer size, in bytes. 0 to write directly to file.
+			 */
+			virtual void SetFileBufferSize(int bufferSize) = 0;
+
+			/**
+			 * Set interval between forced log file flushes.
+			 * Flushing writes buffered messages to the OS, without forcing them to disk (no fsync).
+			 * 
+			 * \param seconds Flush interval, in seconds.
+			 */
+			virtual void SetFlushInterval(double seconds) = 0;
+
+			/**
+			 * Set log file rotation by size.
+			 * When log file exceeds max size, it's renamed to '_log.1.txt' (previous backups are shifted) and a new log file starts.
+			 * 
+			 * \param maxFileSize Max log file size, in bytes. 0 to never rotate.
+			 * \param maxBackups How many rotated log files to keep.
+			 */
+			virtual void SetFileRotation(long long maxFileSize, int maxBackups = 3) = 0;
+
+			/**
+			 * Set log level of a category.
+			 * Category levels can only be stricter than the global log level, ie messages must pass both.
+			 * 
+			 * \param category Category to set level for.
+			 * \param level Category log level.
+			 */
+			virtual void SetCategoryLevel(LogCategory category, LogLevel level) = 0;
+
+			/**
+			 * Get log level of a category.
+			 * 
+			 * \param category Category to get level for.
+			 * \return Category log level.
+			 */
+			virtual LogLevel GetCategoryLevel(LogCategory category) const = 0;
 		
 		protected:
 
@@ -7,7 +7,13 @@
  *********************************************************************/
 #pragma once
 #include "ILog.h"
+#include "AsyncLogQueue.h"
+#include "LogPlatform.h"
 #include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <vector>
 
 
 namespace bon
@@ -23,8 +29,11 @@ namespace bon
 			// current log level
 			LogLevel _level = LogLevel::Debug;
 
+			// log level per category
+			LogLevel _categoryLevels[(int)LogCategory::_Count] = { LogLevel::Debug, LogLevel::Debug, LogLevel::Debug, LogLevel::Debug, LogLevel::Debug, LogLevel::Debug };
+
 			// log file
-			FILE* _logFile = nullptr;
+			LogFile _logFile;
 
 			// last tick time, so we'll update time signature only when needed
 			unsigned long long _lastTick = 0;
@@ -32,6 +41,26 @@ namespace bon
 			// time until next time we force flushing log file, so we won't lose data due to crashes.
 			double _timeForNextFlush = 1;
 
+			// interval, in seconds, between forced log file flushes
+			double _flushInterval = 1.5;
+
+			// async logging queue and the thread that writes its records
+			std::atomic<AsyncLogQueue*> _asyncQueue{ nullptr };
+			std::thread _asyncThread;
+			std::atomic<bool> _asyncRunning{ false };
+
+			// queues from previous times async logging was disabled.
+			// kept alive until log manager is destroyed, in case other threads are still writing to them.
+			std::vector<std::unique_ptr<AsyncLogQueue>> _retiredAsyncQueues;
+
+			// set while draining async queue, so only one thread drains at a time
+			std::atomic_flag _asyncDraining = ATOMIC_FLAG_INIT;
+
+			// async overflow policy, and dropped messages counters
+			LogOverflowPolicy _overflowPolicy = LogOverflowPolicy::Drop;
+			std::atomic<long long> _droppedCount{ 0 };
+			long long _reportedDroppedCount = 0;
+
 		protected:
 
 			/**
@@ -69,7 +98,7 @@ namespace bon
 			 *
 			 * \param level New logs level.
 			 */
-			virtual void SetLevel(LogLevel level) override { _level = level; }
+			virtual void SetLevel(LogLevel level) override;
 
 			/**
 			 * Get current log level.
@@ -91,6 +120,73 @@ namespace bon
 			 */
 			virtual void Flush() override;
 
+			/**
+			 * Enable or disable asynchronous logging.
+			 *
+			 * \param async Should we write logs asynchronously.
+			 * \param overflowPolicy What to do when queue is full.
+			 * \param capacity Max messages in queue. Only used when async logging starts.
+			 */
+			virtual void SetAsync(bool async, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop, int capacity = 8192) override;
+
+			/**
+			 * Get if writing logs asynchronously.
+			 *
+			 * \return True if async logging is enabled.
+			 */
+			virtual bool IsAsync() const override { return _asyncQueue.load(std::memory_order_relaxed) != nullptr; }
+
+			/**
+			 * Get how many messages were dropped because async log queue was full.
+			 *
+			 * \return Dropped messages count.
+			 */
+			virtual long long DroppedMessagesCount() const override { return _droppedCount.load(std::memory_order_relaxed); }
+
+			/**
+			 * Set log file write buffer size.
+			 *
+			 * \param bufferSize Buffer size, in bytes. 0 to write directly to file.
+			 */
+			virtual void SetFileBufferSize(int bufferSize) override;
+
+			/**
+			 * Set interval between forced log file flushes.
+			 *
+			 * \param seconds Flush interval, in seconds.
+			 */
+			virtual void SetFlushInterval(double seconds) override { _flushInterval = seconds; }
+
+			/**
+			 * Set log file rotation by size.
+			 *
+			 * \param maxFileSize Max log file size, in bytes. 0 to never rotate.
+			 * \param maxBackups How many rotated log files to keep.
+			 */
+			virtual void SetFileRotation(long long maxFileSize, int maxBackups = 3) override;
+
+			/**
+			 * Set log level of a category.
+			 *
+			 * \param category Category to set level for.
+			 * \param level Category log level.
+			 */
+			virtual void SetCategoryLevel(LogCategory category, LogLevel level) override;
+
+			/**
+			 * Get log level of a category.
+			 *
+			 * \param category Category to get level for.
+			 * \return Category log level.
+			 */
+			virtual LogLevel GetCategoryLevel(LogCategory category) const override { return _categoryLevels[(int)category]; }
+
+			/**
+			 * Write all pending async messages and flush log file. Called from crash signal handler.
+			 * Async-signal-safe: never blocks, and writes messages with raw file writes, without their arguments.
+			 */
+			void _FlushOnCrash();
+
 		private:
 
 			/**
@@ -103,10 +199,38 @@ namespace bon
 			 */
 			void FlushLogFile();
 
+			/**
+			 * Update cached log levels used by log macros.
+			 */
+			void UpdateLogFilter();
+
+			/**
+			 * Write a formatted line to log file and console.
+			 *
+			 * \param line Line to write, including line break.
+			 * \param length Line length.
+			 */
+			void WriteLine(const char* line, size_t length);
+
 			/**
 			 * Update timestamp text.
 			 */
 			void UpdateTimeStamp();
+
+			/**
+			 * Format and write all records in async queue.
+			 *
+			 * \param queue Queue to drain.
+			 * \return How many records were written.
+			 */
+			size_t DrainAsyncQueue(AsyncLogQueue& queue);
+
+			/**
+			 * Async writer thread main loop.
+			 *
+			 * \param queue Queue to write records from.
+			 */
+			void AsyncWriterLoop(AsyncLogQueue* queue);
 		};
 	}
 }
\ No newline at end of file
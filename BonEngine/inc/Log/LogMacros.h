@@ -7,27 +7,144 @@
  *********************************************************************/
 #pragma once
 
+/**
+ * Min log level to compile (0 = debug, 1 = info, 2 = warn, 3 = error, 4 = critical).
+ * Log macros below this level are stripped entirely, and their arguments are never evaluated.
+ * For example, define BON_LOG_COMPILE_LEVEL=1 in release builds to remove all debug logs.
+ */
+#ifndef BON_LOG_COMPILE_LEVEL
+#define BON_LOG_COMPILE_LEVEL 0
+#endif
+
+/*
+ * Every level has 3 macros:
+ *	- BON_xLOG(msg, ...): write general log.
+ *	- BON_xLOG_CAT(category, msg, ...): write log under a category (Gfx, Assets, Input, Sfx, UI), which has its own log level.
+ *	- BON_xLOG_RATE(intervalMs, msg, ...): write general log at most once per interval from this call site. Use for messages emitted every frame.
+ * All macros check level with a single branch on cached log level, and only evaluate arguments if level is active.
+ */
+
+#if BON_LOG_COMPILE_LEVEL <= 0
+
 /**
  * Write debug log in an efficient way (will only evaluate arguments if log level is active).
  */
-#define BON_DLOG(msg, ...) if (bon::_GetEngine().Log().IsValid(bon::LogLevel::Debug)) bon::_GetEngine().Log().Write(bon::LogLevel::Debug, msg, __VA_ARGS__)
+#define BON_DLOG(msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Debug, bon::log::LogCategory::General)) bon::_GetEngine().Log().Write(bon::LogLevel::Debug, msg, __VA_ARGS__)
+
+/**
+ * Write debug log under a category in an efficient way (will only evaluate arguments if category log level is active).
+ */
+#define BON_DLOG_CAT(category, msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Debug, bon::log::LogCategory::category)) bon::_GetEngine().Log().Write(bon::LogLevel::Debug, msg, __VA_ARGS__)
+
+/**
+ * Write debug log at most once per interval (in milliseconds) from this call site.
+ */
+#define BON_DLOG_RATE(intervalMs, msg, ...) do { if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Debug, bon::log::LogCategory::General)) { static std::atomic<uint64_t> _bonLogLastWrite{ 0 }; if (bon::log::LogFilter::_RateLimit(_bonLogLastWrite, intervalMs)) bon::_GetEngine().Log().Write(bon::LogLevel::Debug, msg, __VA_ARGS__); } } while (0)
+
+#else
+
+#define BON_DLOG(msg, ...) ((void)0)
+#define BON_DLOG_CAT(category, msg, ...) ((void)0)
+#define BON_DLOG_RATE(intervalMs, msg, ...) ((void)0)
+
+#endif
+
+#if BON_LOG_COMPILE_LEVEL <= 1
+
+/**
+ * Write info log in an efficient way (will only evaluate arguments if log level is active).
+ */
+#define BON_ILOG(msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Info, bon::log::LogCategory::General)) bon::_GetEngine().Log().Write(bon::LogLevel::Info, msg, __VA_ARGS__)
 
 /**
-* Write info log in an efficient way (will only evaluate arguments if log level is active).
-*/
-#define BON_ILOG(msg, ...) if (bon::_GetEngine().Log().IsValid(bon::LogLevel::Info)) bon::_GetEngine().Log().Write(bon::LogLevel::Info, msg, __VA_ARGS__)
+ * Write info log under a category in an efficient way (will only evaluate arguments if category log level is active).
+ */
+#define BON_ILOG_CAT(category, msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Info, bon::log::LogCategory::category)) bon::_GetEngine().Log().Write(bon::LogLevel::Info, msg, __VA_ARGS__)
 
 /**
-* Write warning log in an efficient way (will only evaluate arguments if log level is active).
-*/
-#define BON_WLOG(msg, ...) if (bon::_GetEngine().Log().IsValid(bon::LogLevel::Warn)) bon::_GetEngine().Log().Write(bon::LogLevel::Warn, msg, __VA_ARGS__)
+ * Write info log at most once per interval (in milliseconds) from this call site.
+ */
+#define BON_ILOG_RATE(intervalMs, msg, ...) do { if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Info, bon::log::LogCategory::General)) { static std::atomic<uint64_t> _bonLogLastWrite{ 0 }; if (bon::log::LogFilter::_RateLimit(_bonLogLastWrite, intervalMs)) bon::_GetEngine().Log().Write(bon::LogLevel::Info, msg, __VA_ARGS__); } } while (0)
+
+#else
+
+#define BON_ILOG(msg, ...) ((void)0)
+#define BON_ILOG_CAT(category, msg, ...) ((void)0)
+#define BON_ILOG_RATE(intervalMs, msg, ...) ((void)0)
+
+#endif
+
+#if BON_LOG_COMPILE_LEVEL <= 2
 
 /**
-* Write error log in an efficient way (will only evaluate arguments if log level is active).
-*/
-#define BON_ELOG(msg, ...) if (bon::_GetEngine().Log().IsValid(bon::LogLevel::Error)) bon::_GetEngine().Log().Write(bon::LogLevel::Error, msg, __VA_ARGS__)
+ * Write warning log in an efficient way (will only evaluate arguments if log level is active).
+ */
+#define BON_WLOG(msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Warn, bon::log::LogCategory::General)) bon::_GetEngine().Log().Write(bon::LogLevel::Warn, msg, __VA_ARGS__)
 
 /**
-* Write critical log in an efficient way (will only evaluate arguments if log level is active).
-*/
-#define BON_CLOG(msg, ...) if (bon::_GetEngine().Log().IsValid(bon::LogLevel::Critical)) bon::_GetEngine().Log().Write(bon::LogLevel::Critical, msg, __VA_ARGS__)
\ No newline at end of file
+ * Write warning log under a category in an efficient way (will only evaluate arguments if category log level is active).
+ */
+#define BON_WLOG_CAT(category, msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Warn, bon::log::LogCategory::category)) bon::_GetEngine().Log().Write(bon::LogLevel::Warn, msg, __VA_ARGS__)
+
+/**
+ * Write warning log at most once per interval (in milliseconds) from this call site.
+ */
+#define BON_WLOG_RATE(intervalMs, msg, ...) do { if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Warn, bon::log::LogCategory::General)) { static std::atomic<uint64_t> _bonLogLastWrite{ 0 }; if (bon::log::LogFilter::_RateLimit(_bonLogLastWrite, intervalMs)) bon::_GetEngine().Log().Write(bon::LogLevel::Warn, msg, __VA_ARGS__); } } while (0)
+
+#else
+
+#define BON_WLOG(msg, ...) ((void)0)
+#define BON_WLOG_CAT(category, msg, ...) ((void)0)
+#define BON_WLOG_RATE(intervalMs, msg, ...) ((void)0)
+
+#endif
+
+#if BON_LOG_COMPILE_LEVEL <= 3
+
+/**
+ * Write error log in an efficient way (will only evaluate arguments if log level is active).
+ */
+#define BON_ELOG(msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Error, bon::log::LogCategory::General)) bon::_GetEngine().Log().Write(bon::LogLevel::Error, msg, __VA_ARGS__)
+
+/**
+ * Write error log under a category in an efficient way (will only evaluate arguments if category log level is active).
+ */
+#define BON_ELOG_CAT(category, msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Error, bon::log::LogCategory::category)) bon::_GetEngine().Log().Write(bon::LogLevel::Error, msg, __VA_ARGS__)
+
+/**
+ * Write error log at most once per interval (in milliseconds) from this call site.
+ */
+#define BON_ELOG_RATE(intervalMs, msg, ...) do { if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Error, bon::log::LogCategory::General)) { static std::atomic<uint64_t> _bonLogLastWrite{ 0 }; if (bon::log::LogFilter::_RateLimit(_bonLogLastWrite, intervalMs)) bon::_GetEngine().Log().Write(bon::LogLevel::Error, msg, __VA_ARGS__); } } while (0)
+
+#else
+
+#define BON_ELOG(msg, ...) ((void)0)
+#define BON_ELOG_CAT(category, msg, ...) ((void)0)
+#define BON_ELOG_RATE(intervalMs, msg, ...) ((void)0)
+
+#endif
+
+#if BON_LOG_COMPILE_LEVEL <= 4
+
+/**
+ * Write critical log in an efficient way (will only evaluate arguments if log level is active).
+ */
+#define BON_CLOG(msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Critical, bon::log::LogCategory::General)) bon::_GetEngine().Log().Write(bon::LogLevel::Critical, msg, __VA_ARGS__)
+
+/**
+ * Write critical log under a category in an efficient way (will only evaluate arguments if category log level is active).
+ */
+#define BON_CLOG_CAT(category, msg, ...) if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Critical, bon::log::LogCategory::category)) bon::_GetEngine().Log().Write(bon::LogLevel::Critical, msg, __VA_ARGS__)
+
+/**
+ * Write critical log at most once per interval (in milliseconds) from this call site.
+ */
+#define BON_CLOG_RATE(intervalMs, msg, ...) do { if (bon::log::LogFilter::IsEnabled(bon::LogLevel::Critical, bon::log::LogCategory::General)) { static std::atomic<uint64_t> _bonLogLastWrite{ 0 }; if (bon::log::LogFilter::_RateLimit(_bonLogLastWrite, intervalMs)) bon::_GetEngine().Log().Write(bon::LogLevel::Critical, msg, __VA_ARGS__); } } while (0)
+
+#else
+
+#define BON_CLOG(msg, ...) ((void)0)
+#define BON_CLOG_CAT(category, msg, ...) ((void)0)
+#define BON_CLOG_RATE(intervalMs, msg, ...) ((void)0)
+
+#endif
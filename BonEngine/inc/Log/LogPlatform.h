@@ -0,0 +1,162 @@
+/*****************************************************************//**
+ * \file   LogPlatform.h
+ * \brief  Platform abstraction for the log manager: monotonic time, local time and buffered log files.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+namespace bon
+{
+	namespace log
+	{
+		/**
+		 * Get monotonic time in milliseconds, from an unspecified starting point.
+		 * Uses GetTickCount64 on Windows and clock_gettime on other platforms.
+		 */
+		uint64_t MonotonicMilliseconds();
+
+		/**
+		 * Convert raw time to local time, in a thread safe way.
+		 *
+		 * \param rawtime Time to convert.
+		 * \param out Output local time.
+		 */
+		void LocalTime(time_t rawtime, struct tm& out);
+
+		/**
+		 * Standard output file descriptor, for raw writes.
+		 */
+		const int StdOutFileDescriptor = 1;
+
+		/**
+		 * Write data to a file descriptor with raw write calls, handling partial writes.
+		 * Async-signal-safe.
+		 *
+		 * \param fd File descriptor to write to.
+		 * \param data Data to write.
+		 * \param size Data size, in bytes.
+		 */
+		void WriteRaw(int fd, const char* data, size_t size);
+
+		/**
+		 * Append-only buffered log file, with optional rotation by size.
+		 * Writes go to a memory buffer, and reach the OS when buffer is full or when flushed. Flushing never calls fsync.
+		 * When rotating, current file is renamed to 'name.1.ext', previous 'name.1.ext' to 'name.2.ext', and so on.
+		 * Thread safe.
+		 */
+		class LogFile
+		{
+		private:
+			// file path and descriptor
+			std::string _path;
+			int _fd = -1;
+
+			// write buffer and how many bytes it holds
+			std::vector<char> _buffer;
+			size_t _used = 0;
+
+			// bytes written to current file so far, including buffered bytes
+			uint64_t _fileSize = 0;
+
+			// rotation settings
+			uint64_t _maxFileSize = 0;
+			int _maxBackups = 0;
+
+			// protect buffer and file
+			std::mutex _mutex;
+
+			// write data directly to file
+			void WriteToFile(const char* data, size_t size);
+
+			// write buffer to file
+			void FlushBuffer();
+
+			// close current file, shift backups and open a new file
+			void Rotate();
+
+			// open file at current path, truncating it
+			bool OpenFile();
+
+			// close file descriptor
+			void CloseFile();
+
+		public:
+			/**
+			 * Create the log file object, without opening anything.
+			 *
+			 * \param bufferSize Write buffer size, in bytes. 0 to write directly to file.
+			 */
+			LogFile(size_t bufferSize = 64 * 1024);
+
+			/**
+			 * Flush and close file.
+			 */
+			~LogFile();
+
+			/**
+			 * Open log file for writing, truncating it if already exists.
+			 *
+			 * \param path File path.
+			 * \return True if succeed, false otherwise.
+			 */
+			bool Open(const char* path);
+
+			/**
+			 * Flush and close file, if opened.
+			 */
+			void Close();
+
+			/**
+			 * Get if file is opened.
+			 */
+			bool IsOpen() const { return _fd >= 0; }
+
+			/**
+			 * Write data to file.
+			 *
+			 * \param data Data to write.
+			 * \param size Data size, in bytes.
+			 */
+			void Write(const char* data, size_t size);
+
+			/**
+			 * Write buffered data to file. Doesn't fsync.
+			 */
+			void Flush();
+
+			/**
+			 * Write buffered data and then given data directly to file, without blocking and without rotating.
+			 * Used from crash signal handlers: if file is locked by another write, gives up instead of waiting.
+			 *
+			 * \param data Data to write.
+			 * \param size Data size, in bytes.
+			 * \return False if file was locked and nothing was written.
+			 */
+			bool TryWriteOnCrash(const char* data, size_t size);
+
+			/**
+			 * Set write buffer size. Flushes buffered data.
+			 *
+			 * \param bufferSize Write buffer size, in bytes. 0 to write directly to file.
+			 */
+			void SetBufferSize(size_t bufferSize);
+
+			/**
+			 * Set rotation by size.
+			 *
+			 * \param maxFileSize Max file size, in bytes, before rotating to a new file. 0 to never rotate.
+			 * \param maxBackups How many rotated files to keep. Older files are deleted.
+			 */
+			void SetRotation(uint64_t maxFileSize, int maxBackups);
+		};
+	}
+}
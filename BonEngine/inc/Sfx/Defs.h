@@ -28,6 +28,38 @@ namespace bon
 		 */
 		static const SoundChannelId InvalidSoundChannel = -2;
 
+		/**
+		 * Max voices (mix channels) we can allocate.
+		 */
+		static const int MaxVoices = 256;
+
+		/**
+		 * What to do when playing a sound while all voices are busy (or its sound group reached its limit).
+		 * Voices of sounds with higher priority than the new sound are never stolen.
+		 */
+		enum class BON_DLLEXPORT VoiceStealingPolicy
+		{
+			/**
+			 * Don't steal voices, drop the new sound.
+			 */
+			None = 0,
+
+			/**
+			 * Stop the sound that played for the longest time.
+			 */
+			Oldest = 1,
+
+			/**
+			 * Stop the sound with the lowest volume.
+			 */
+			Quietest = 2,
+
+			/**
+			 * Stop the sound with the lowest priority (oldest first, if same priority).
+			 */
+			LowestPriority = 3,
+		};
+
 		/**
 		 * Format types for audio initialization.
 		 */
@@ -35,5 +67,76 @@ namespace bon
 		{
 			U8, S8, U16LSB, S16LSB, U16MSB, S16MSB
 		};
+
+		/**
+		 * Resampling quality, used when playing sounds with pitch.
+		 */
+		enum class BON_DLLEXPORT ResamplerQuality
+		{
+			/**
+			 * Linear interpolation between 2 samples. Fastest.
+			 */
+			Linear = 0,
+
+			/**
+			 * Cubic (Catmull-Rom) interpolation between 4 samples. Smoother, but slower.
+			 */
+			Cubic = 1,
+		};
+
+		/**
+		 * Buses of the engine mixer. Music, Sfx, UI and Voice buses are mixed into the Master bus.
+		 */
+		enum class BON_DLLEXPORT MixerBus
+		{
+			Master = 0,
+			Music = 1,
+			Sfx = 2,
+			UI = 3,
+			Voice = 4,
+			_Count
+		};
+
+		/**
+		 * Represent the handle of a sound playing on the engine mixer.
+		 */
+		typedef BON_DLLEXPORT int MixerVoiceId;
+
+		/**
+		 * Define mixer voice id for invalid voice / errors.
+		 */
+		static const MixerVoiceId InvalidMixerVoice = -1;
+
+		/**
+		 * Represent the handle of a positional sound (see ISfx::PlaySoundAt()).
+		 * Unlike channels, emitter ids stay valid while the sound is virtual and doesn't use a channel.
+		 */
+		typedef BON_DLLEXPORT int SoundEmitterId;
+
+		/**
+		 * Define emitter id for invalid emitter / errors.
+		 */
+		static const SoundEmitterId InvalidSoundEmitter = -1;
+
+		/**
+		 * How positional sounds volume drops with distance from listener.
+		 */
+		enum class BON_DLLEXPORT AttenuationCurve
+		{
+			/**
+			 * Volume drops linearly from min distance to max distance.
+			 */
+			Linear = 0,
+
+			/**
+			 * Volume drops with the inverse of distance: min / (min + rolloff * (distance - min)). Natural sounding.
+			 */
+			Inverse = 1,
+
+			/**
+			 * Volume drops with (distance / min) raised to the power of -rolloff. Same as inverse when rolloff is 1, and drops faster with higher rolloff.
+			 */
+			Exponential = 2,
+		};
 	}
 }
\ No newline at end of file
@@ -10,6 +10,10 @@
 #include "../IManager.h"
 #include "../Assets/Types/Music.h"
 #include "Defs.h"
+#include "Resampler.h"
+#include "SoundStream.h"
+#include "Mixer.h"
+#include "Spatial.h"
 
 
 namespace bon
@@ -63,6 +67,16 @@ namespace bon
 			 */
 			virtual void StopMusic() = 0;
 
+			/**
+			 * Get current music position, in seconds (0 if no music is playing).
+			 * Position is counted from audio frames mixed while music plays and isn't paused, so it's accurate to one audio
+			 * buffer (audio_chunk_size frames, ~93ms for 4096 frames at 44100Hz) and doesn't include output device latency.
+			 * If track length is known (see MusicAsset Length()), position wraps when music loops.
+			 *
+			 * \return Music position, in seconds.
+			 */
+			virtual float GetMusicPosition() const = 0;
+
 			/**
 			 * Play a sound effect.
 			 *
@@ -137,6 +151,14 @@ namespace bon
 			 */
 			virtual void StopChannel(SoundChannelId channel) = 0;
 
+			/**
+			 * Stop all playing instances of a sound, including positional sounds.
+			 * To get how many instances of a sound are playing, use SoundAsset PlayingInstances().
+			 *
+			 * \param sound Sound to stop.
+			 */
+			virtual void StopSound(assets::SoundAsset sound) = 0;
+
 			/**
 			* Set the master volume of music and sound effects.
 			* Note: affect music volume immediately, but does not affect currently playing sound effects.
@@ -146,6 +168,227 @@ namespace bon
 			*/
 			virtual void SetMasterVolume(int soundEffectsVolume, int musicVolume) = 0;
 
+			/**
+			 * Set resampling quality of sounds played with pitch.
+			 * Note: only affect sounds played after this call.
+			 *
+			 * \param quality Resampling quality.
+			 */
+			virtual void SetPitchQuality(ResamplerQuality quality) = 0;
+
+			/**
+			 * Get resampling quality of sounds played with pitch.
+			 *
+			 * \return Resampling quality.
+			 */
+			virtual ResamplerQuality GetPitchQuality() const = 0;
+
+			/**
+			 * Set how many voices (sounds that can play at the same time) to allocate.
+			 * Can also be set via config file, under [sfx] voices.
+			 *
+			 * \param count Voices count (1 to MaxVoices, default is 32).
+			 */
+			virtual void SetVoicesCount(int count) = 0;
+
+			/**
+			 * Get how many voices are allocated.
+			 *
+			 * \return Voices count.
+			 */
+			virtual int GetVoicesCount() const = 0;
+
+			/**
+			 * Set what to do when playing a sound while all voices are busy, or when its sound group reached its limit.
+			 * Voices of sounds with higher priority than the new sound are never stolen. Sounds that can't get a voice are dropped.
+			 * Can also be set via config file, under [sfx] voice_stealing.
+			 *
+			 * \param policy Voice stealing policy (default is LowestPriority).
+			 */
+			virtual void SetVoiceStealingPolicy(VoiceStealingPolicy policy) = 0;
+
+			/**
+			 * Get voice stealing policy.
+			 *
+			 * \return Voice stealing policy.
+			 */
+			virtual VoiceStealingPolicy GetVoiceStealingPolicy() const = 0;
+
+			/**
+			 * Limit how many sounds of a given sound group can play at the same time (see SoundAsset SetGroup()).
+			 *
+			 * \param group Sound group id.
+			 * \param maxVoices Max voices sounds of this group can use at once (0 = no limit).
+			 */
+			virtual void SetSoundGroupLimit(int group, int maxVoices) = 0;
+
+			/**
+			 * Get stats about currently playing streamed sounds (see IAssets::LoadSoundStream()).
+			 *
+			 * \return Streaming stats.
+			 */
+			virtual StreamingStats GetStreamingStats() = 0;
+
+			/**
+			 * Enable or disable the engine mixer.
+			 * Engine mixer is a software mixer with buses, that runs on its own audio device alongside the regular sounds and music.
+			 * Sounds played with PlaySoundOnBus() are mixed by it, while PlaySound() and PlayMusic() are not affected.
+			 *
+			 * \param enable Should we enable engine mixer.
+			 */
+			virtual void EnableEngineMixer(bool enable) = 0;
+
+			/**
+			 * Get if engine mixer is enabled.
+			 *
+			 * \return True if engine mixer is enabled.
+			 */
+			virtual bool IsEngineMixerEnabled() const = 0;
+
+			/**
+			 * Play a sound on an engine mixer bus.
+			 * Requires the engine mixer to be enabled, signed 16 bit audio format, and a sound that is not streamed.
+			 *
+			 * \param sound Sound asset to play.
+			 * \param bus Bus to play on.
+			 * \param volume Sound volume (0 to 100).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \param pan Stereo panning (-1.0 = left, 0.0 = center, 1.0 = right).
+			 * \return Mixer voice id, or InvalidMixerVoice if failed to play.
+			 */
+			virtual MixerVoiceId PlaySoundOnBus(assets::SoundAsset sound, MixerBus bus, int volume = 100, int loops = 0, float pan = 0.0f) = 0;
+
+			/**
+			 * Stop a sound playing on engine mixer.
+			 *
+			 * \param voice Mixer voice id, as returned from PlaySoundOnBus().
+			 */
+			virtual void StopMixerVoice(MixerVoiceId voice) = 0;
+
+			/**
+			 * Set engine mixer bus volume.
+			 *
+			 * \param bus Bus to set.
+			 * \param volume Bus volume (0.0 - 1.0).
+			 */
+			virtual void SetBusVolume(MixerBus bus, float volume) = 0;
+
+			/**
+			 * Set engine mixer bus low-pass filter.
+			 *
+			 * \param bus Bus to set.
+			 * \param cutoff Cutoff frequency, in Hz. 0 to disable filter.
+			 */
+			virtual void SetBusLowPass(MixerBus bus, float cutoff) = 0;
+
+			/**
+			 * Set engine mixer bus ducking: lower bus volume while another bus is playing.
+			 *
+			 * \param bus Bus to duck.
+			 * \param trigger Bus that triggers ducking when it has audio.
+			 * \param amount How much to lower volume (0.0 = disable ducking, 1.0 = mute while ducked).
+			 * \param attack How long it takes to duck, in seconds.
+			 * \param release How long it takes to return to full volume, in seconds.
+			 */
+			virtual void SetBusDucking(MixerBus bus, MixerBus trigger, float amount, float attack = 0.05f, float release = 0.5f) = 0;
+
+			/**
+			 * Get engine mixer stats.
+			 *
+			 * \return Engine mixer stats (all zeros if engine mixer is not enabled).
+			 */
+			virtual MixerStats GetMixerStats() const = 0;
+
+			/**
+			 * Set listener position, used to calculate volume and panning of positional sounds (see PlaySoundAt()).
+			 *
+			 * \param position Listener position, usually camera center or player position.
+			 */
+			virtual void SetListenerPosition(const framework::PointF& position) = 0;
+
+			/**
+			 * Get listener position.
+			 *
+			 * \return Listener position.
+			 */
+			virtual const framework::PointF& GetListenerPosition() const = 0;
+
+			/**
+			 * Set positional sounds settings: attenuation curve, min and max distance, rolloff and panning distance.
+			 *
+			 * \param settings Spatial settings to set.
+			 */
+			virtual void SetSpatialSettings(const SpatialSettings& settings) = 0;
+
+			/**
+			 * Get positional sounds settings.
+			 *
+			 * \return Spatial settings.
+			 */
+			virtual const SpatialSettings& GetSpatialSettings() const = 0;
+
+			/**
+			 * Play a positional sound. Its volume and panning are updated every frame, based on its position relative to listener.
+			 * When sound is beyond max distance, or there's no free voice to play it, it becomes virtual: it stops using a voice, but keeps
+			 * track of its play time, and resumes from where it should be when it's back in range.
+			 *
+			 * \param sound Sound asset to play.
+			 * \param position Sound position.
+			 * \param volume Sound volume before attenuation (0 to 100).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \param pitch Sound pitch (1 = no pitch).
+			 * \return Emitter id to control the sound with.
+			 */
+			virtual SoundEmitterId PlaySoundAt(assets::SoundAsset sound, const framework::PointF& position, int volume = 100, int loops = 0, float pitch = 1.0f) = 0;
+
+			/**
+			 * Set positional sound position.
+			 *
+			 * \param emitter Emitter id, as returned from PlaySoundAt().
+			 * \param position New sound position.
+			 */
+			virtual void SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position) = 0;
+
+			/**
+			 * Set positional sound volume, before attenuation.
+			 *
+			 * \param emitter Emitter id.
+			 * \param volume Sound volume (0 to 100).
+			 */
+			virtual void SetEmitterVolume(SoundEmitterId emitter, int volume) = 0;
+
+			/**
+			 * Stop a positional sound.
+			 *
+			 * \param emitter Emitter id.
+			 */
+			virtual void StopEmitter(SoundEmitterId emitter) = 0;
+
+			/**
+			 * Get if a positional sound is still playing, including while it's virtual.
+			 *
+			 * \param emitter Emitter id.
+			 * \return True if sound is still playing.
+			 */
+			virtual bool IsEmitterPlaying(SoundEmitterId emitter) const = 0;
+
+			/**
+			 * Get if a positional sound is virtual (playing, but not using a voice).
+			 *
+			 * \param emitter Emitter id.
+			 * \return True if sound is virtual.
+			 */
+			virtual bool IsEmitterVirtual(SoundEmitterId emitter) const = 0;
+
+			/**
+			 * Get the channel a positional sound is currently playing on.
+			 * Note that channel may change when sound goes virtual and comes back.
+			 *
+			 * \param emitter Emitter id.
+			 * \return Channel id, or InvalidSoundChannel if sound is virtual or not playing.
+			 */
+			virtual SoundChannelId GetEmitterChannel(SoundEmitterId emitter) const = 0;
+
 		protected:
 
 			/**
@@ -0,0 +1,369 @@
+/*****************************************************************//**
+ * \file   Mixer.h
+ * \brief  Engine-owned software mixer, with float mixing and buses.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "Defs.h"
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Audio data for a mixer voice to play.
+		 * Data is not copied, and must stay valid while the voice plays.
+		 */
+		struct BON_DLLEXPORT MixerSource
+		{
+			/**
+			 * Interleaved samples.
+			 */
+			const void* Data = nullptr;
+
+			/**
+			 * Length, in frames (samples per channel).
+			 */
+			int Frames = 0;
+
+			/**
+			 * Channels count (1 or 2).
+			 */
+			int Channels = 0;
+
+			/**
+			 * If true, samples are floats (-1.0 to 1.0). Otherwise, samples are signed 16 bit.
+			 */
+			bool Float = false;
+		};
+
+		/**
+		 * Engine mixer stats.
+		 */
+		struct BON_DLLEXPORT MixerStats
+		{
+			/**
+			 * How many times Mix() was called (usually once per audio callback).
+			 */
+			uint64_t Callbacks = 0;
+
+			/**
+			 * How long last Mix() call took, in milliseconds.
+			 */
+			double LastCallbackMs = 0;
+
+			/**
+			 * Average time Mix() calls take, in milliseconds (exponential moving average).
+			 */
+			double AverageCallbackMs = 0;
+
+			/**
+			 * Longest Mix() call, in milliseconds.
+			 */
+			double MaxCallbackMs = 0;
+
+			/**
+			 * Average Mix() time relative to the audio duration it produces (1.0 = mixer takes all the time it has).
+			 */
+			double Load = 0;
+
+			/**
+			 * How many voices are currently playing.
+			 */
+			int ActiveVoices = 0;
+
+			/**
+			 * How many commands were dropped because command queue was full.
+			 */
+			uint64_t DroppedCommands = 0;
+		};
+
+		/**
+		 * Fixed size lock-free queue, for a single producer thread and a single consumer thread.
+		 */
+		template <class T, int Capacity>
+		class _SpscQueue
+		{
+		private:
+			T _items[Capacity];
+			std::atomic<uint32_t> _head{ 0 };
+			std::atomic<uint32_t> _tail{ 0 };
+
+		public:
+			/**
+			 * Push item (producer thread). Returns false if queue is full.
+			 */
+			bool Push(const T& item)
+			{
+				uint32_t tail = _tail.load(std::memory_order_relaxed);
+				if (tail - _head.load(std::memory_order_acquire) >= (uint32_t)Capacity) {
+					return false;
+				}
+				_items[tail % Capacity] = item;
+				_tail.store(tail + 1, std::memory_order_release);
+				return true;
+			}
+
+			/**
+			 * Pop item (consumer thread). Returns false if queue is empty.
+			 */
+			bool Pop(T& out)
+			{
+				uint32_t head = _head.load(std::memory_order_relaxed);
+				if (head == _tail.load(std::memory_order_acquire)) {
+					return false;
+				}
+				out = _items[head % Capacity];
+				_head.store(head + 1, std::memory_order_release);
+				return true;
+			}
+		};
+
+		/**
+		 * Engine-owned software mixer.
+		 * Mixes voices in float into buses (Music, Sfx, UI and Voice, all mixed into Master). Every bus has volume, low-pass filter and ducking.
+		 * Game thread controls the mixer via a fixed size lock-free command queue, so the audio thread never waits for locks or allocates memory.
+		 * Can mix into a memory buffer with Mix(), or drive an SDL audio device with OpenDevice(). To run without sound hardware, use SDL's dummy audio driver (set SDL_AUDIODRIVER=dummy).
+		 * All methods except Mix() should be called from the same thread (usually main thread).
+		 */
+		class BON_DLLEXPORT Mixer
+		{
+		public:
+			/**
+			 * Max frames to mix at once. Larger Mix() calls are split into slices.
+			 */
+			static const int MaxFramesPerSlice = 1024;
+
+			/**
+			 * Command queue size.
+			 */
+			static const int CommandQueueSize = 1024;
+
+		private:
+			// a command from game thread to audio thread
+			struct Command
+			{
+				enum class Types { Play, Stop, StopAll, SetVoiceVolume, SetBusVolume, SetBusLowPass, SetBusDucking };
+				Types Type = Types::Stop;
+				MixerVoiceId Id = InvalidMixerVoice;
+				MixerSource Source;
+				int Bus = 0;
+				int Trigger = 0;
+				int Loops = 0;
+				float Values[3] = { 0 };
+			};
+
+			// a playing voice (audio thread)
+			struct Voice
+			{
+				MixerVoiceId Id = InvalidMixerVoice;
+				MixerSource Source;
+				int Bus = 0;
+				int Position = 0;
+				int Loops = 0;
+				float Volume = 1.0f;
+				float CurrentVolume = 1.0f;
+				float GainLeft = 1.0f;
+				float GainRight = 1.0f;
+			};
+
+			// bus state (audio thread)
+			struct Bus
+			{
+				float Volume = 1.0f;
+				float CurrentVolume = 1.0f;
+				float LowPassCoef = 0.0f;
+				float LowPassState[2] = { 0 };
+				int DuckTrigger = -1;
+				float DuckAmount = 0.0f;
+				float DuckAttack = 0.0f;
+				float DuckRelease = 0.0f;
+				float DuckGain = 1.0f;
+				float Peak = 0.0f;
+			};
+
+			// output format
+			int _frequency;
+			int _channels;
+
+			// voices and buses, owned by audio thread
+			Voice _voices[MaxVoices];
+			Bus _buses[(int)MixerBus::_Count];
+			std::vector<float> _busBuffers[(int)MixerBus::_Count];
+
+			// commands from game thread, and finished voices back to game thread
+			_SpscQueue<Command, CommandQueueSize> _commands;
+			_SpscQueue<MixerVoiceId, CommandQueueSize> _finished;
+
+			// game thread state
+			MixerVoiceId _nextVoiceId = 0;
+			float _busVolumes[(int)MixerBus::_Count];
+
+			// stats
+			std::atomic<uint64_t> _callbacks{ 0 };
+			std::atomic<uint64_t> _droppedCommands{ 0 };
+			std::atomic<int> _activeVoices{ 0 };
+			std::atomic<double> _lastCallbackMs{ 0 };
+			std::atomic<double> _averageCallbackMs{ 0 };
+			std::atomic<double> _maxCallbackMs{ 0 };
+			std::atomic<double> _averageLoad{ 0 };
+
+			// SDL audio device we drive, if opened
+			uint32_t _device = 0;
+
+			// push command, counting drops
+			bool _PushCommand(const Command& command);
+
+			// apply commands from game thread (audio thread)
+			void _ApplyCommands();
+
+			// mix a slice of up to MaxFramesPerSlice frames (audio thread)
+			void _MixSlice(float* out, int frames);
+
+			// mix a single voice into its bus buffer (audio thread). returns false if voice ended
+			bool _MixVoice(Voice& voice, float* buffer, int frames);
+
+			// apply bus effects and volume in place (audio thread)
+			void _ProcessBus(int index, float* buffer, int frames);
+
+		public:
+			/**
+			 * Create the mixer.
+			 *
+			 * \param frequency Output frequency.
+			 * \param channels Output channels count (1 or 2).
+			 */
+			Mixer(int frequency = 44100, int channels = 2);
+
+			/**
+			 * Close device, if opened.
+			 */
+			~Mixer();
+
+			/**
+			 * Get output frequency.
+			 */
+			int Frequency() const { return _frequency; }
+
+			/**
+			 * Get output channels count.
+			 */
+			int Channels() const { return _channels; }
+
+			/**
+			 * Play a voice.
+			 *
+			 * \param source Audio data to play. Must have the same frequency as the mixer.
+			 * \param bus Bus to play on.
+			 * \param volume Voice volume (0.0 - 1.0).
+			 * \param pan Stereo panning (-1.0 = left, 0.0 = center, 1.0 = right).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \return Voice id, or InvalidMixerVoice if command queue is full or source is invalid.
+			 */
+			MixerVoiceId Play(const MixerSource& source, MixerBus bus, float volume = 1.0f, float pan = 0.0f, int loops = 0);
+
+			/**
+			 * Stop a playing voice.
+			 *
+			 * \param voice Voice id to stop.
+			 */
+			void Stop(MixerVoiceId voice);
+
+			/**
+			 * Stop all playing voices.
+			 */
+			void StopAll();
+
+			/**
+			 * Set volume of a playing voice.
+			 *
+			 * \param voice Voice id.
+			 * \param volume Voice volume (0.0 - 1.0).
+			 */
+			void SetVoiceVolume(MixerVoiceId voice, float volume);
+
+			/**
+			 * Set bus volume.
+			 *
+			 * \param bus Bus to set.
+			 * \param volume Bus volume (0.0 - 1.0, can go above 1.0 to amplify).
+			 */
+			void SetBusVolume(MixerBus bus, float volume);
+
+			/**
+			 * Get bus volume.
+			 *
+			 * \param bus Bus to get volume for.
+			 * \return Bus volume.
+			 */
+			float GetBusVolume(MixerBus bus) const { return _busVolumes[(int)bus]; }
+
+			/**
+			 * Set bus low-pass filter.
+			 *
+			 * \param bus Bus to set.
+			 * \param cutoff Cutoff frequency, in Hz. 0 to disable filter.
+			 */
+			void SetBusLowPass(MixerBus bus, float cutoff);
+
+			/**
+			 * Set bus ducking: lower bus volume while another bus is playing (for example, lower music while voice plays).
+			 *
+			 * \param bus Bus to duck.
+			 * \param trigger Bus that triggers ducking when it has audio.
+			 * \param amount How much to lower volume (0.0 = disable ducking, 1.0 = mute while ducked).
+			 * \param attack How long it takes to duck, in seconds.
+			 * \param release How long it takes to return to full volume, in seconds.
+			 */
+			void SetBusDucking(MixerBus bus, MixerBus trigger, float amount, float attack = 0.05f, float release = 0.5f);
+
+			/**
+			 * Get ids of voices that finished playing since last call.
+			 *
+			 * \param out Output array.
+			 * \param maxCount Max ids to write to output.
+			 * \return How many ids were written.
+			 */
+			int PollFinished(MixerVoiceId* out, int maxCount);
+
+			/**
+			 * Get mixer stats.
+			 */
+			MixerStats GetStats() const;
+
+			/**
+			 * Mix into output buffer. Called from the audio callback, or directly to mix into memory.
+			 *
+			 * \param out Output interleaved float buffer, with room for frames * Channels() samples.
+			 * \param frames How many frames to mix.
+			 */
+			void Mix(float* out, int frames);
+
+			/**
+			 * Open an SDL audio device and start mixing into it from its callback.
+			 *
+			 * \param samples Audio buffer size, in frames.
+			 * \return True if succeed.
+			 */
+			bool OpenDevice(int samples = 1024);
+
+			/**
+			 * Close SDL audio device, if opened.
+			 */
+			void CloseDevice();
+
+			/**
+			 * Get if driving an SDL audio device.
+			 */
+			bool IsDeviceOpen() const { return _device != 0; }
+		};
+	}
+}
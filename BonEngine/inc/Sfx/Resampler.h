@@ -0,0 +1,100 @@
+/*****************************************************************//**
+ * \file   Resampler.h
+ * \brief  Audio resampler, used to play sounds with pitch.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "Defs.h"
+#include <cstdint>
+#include <atomic>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Resample interleaved audio data with fixed-point phase accumulation.
+		 * Position and step are 32.32 fixed-point numbers: upper 32 bits are the source frame index, lower 32 bits are the fraction between frames.
+		 * Linear resampling of 16 bit and float stereo / mono audio uses SSE2 or NEON when available, other cases use scalar code.
+		 * Doesn't require an audio device, so it can be tested and benchmarked on its own.
+		 */
+		class BON_DLLEXPORT Resampler
+		{
+		public:
+			/**
+			 * Get fixed-point step for a given playback speed.
+			 *
+			 * \param speed Playback speed (1.0 = original speed).
+			 * \return Fixed-point step to advance position per output frame.
+			 */
+			static inline uint64_t SpeedToStep(float speed) { return (uint64_t)((double)(speed > 0.0f ? speed : 0.0f) * 4294967296.0); }
+
+			/**
+			 * Get if SIMD code paths were compiled in.
+			 */
+			static bool IsSimdAvailable();
+
+			/**
+			 * Enable or disable SIMD code paths (enabled by default). Useful to compare against scalar code.
+			 *
+			 * \param enable Should we use SIMD code, if available.
+			 */
+			static void EnableSimd(bool enable);
+
+			/**
+			 * Get if using SIMD code paths.
+			 */
+			static inline bool IsSimdEnabled() { return _simdEnabled.load(std::memory_order_relaxed); }
+
+			/**
+			 * Resample interleaved audio.
+			 * When source ends (and not looping) the rest of the output is filled with silence.
+			 *
+			 * \param source Source interleaved samples.
+			 * \param sourceFrames Source length, in frames (samples per channel).
+			 * \param channels Channels count, for both source and output.
+			 * \param loop If true, will wrap around when reaching source end.
+			 * \param out Output buffer, with room for outFrames * channels samples.
+			 * \param outFrames How many frames to write.
+			 * \param position Current source position (fixed-point). Will be advanced.
+			 * \param step Fixed-point step to advance position per output frame.
+			 * \param quality Interpolation quality.
+			 * \return How many frames were resampled before reaching source end.
+			 */
+			static int Resample(const int16_t* source, int sourceFrames, int channels, bool loop, int16_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality = ResamplerQuality::Linear);
+
+			/**
+			 * Resample interleaved audio. See 16 bit version for details.
+			 */
+			static int Resample(const float* source, int sourceFrames, int channels, bool loop, float* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality = ResamplerQuality::Linear);
+
+			/**
+			 * Resample interleaved audio. See 16 bit version for details.
+			 */
+			static int Resample(const uint8_t* source, int sourceFrames, int channels, bool loop, uint8_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality = ResamplerQuality::Linear);
+
+			/**
+			 * Resample interleaved audio. See 16 bit version for details.
+			 */
+			static int Resample(const int8_t* source, int sourceFrames, int channels, bool loop, int8_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality = ResamplerQuality::Linear);
+
+			/**
+			 * Resample interleaved audio. See 16 bit version for details.
+			 */
+			static int Resample(const uint16_t* source, int sourceFrames, int channels, bool loop, uint16_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality = ResamplerQuality::Linear);
+
+			/**
+			 * Resample interleaved audio. See 16 bit version for details.
+			 */
+			static int Resample(const int32_t* source, int sourceFrames, int channels, bool loop, int32_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality = ResamplerQuality::Linear);
+
+		private:
+			// are SIMD code paths enabled
+			static std::atomic<bool> _simdEnabled;
+		};
+	}
+}
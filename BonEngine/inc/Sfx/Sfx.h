@@ -151,10 +151,24 @@ namespace bon
 			 */
 			virtual void StopChannel(SoundChannelId channel) override;
 
+			/**
+			 * Stop all playing instances of a sound.
+			 *
+			 * \param sound Sound to stop.
+			 */
+			virtual void StopSound(assets::SoundAsset sound) override { _Implementor.StopSound(sound); }
+
+			/**
+			 * Get current music position, in seconds.
+			 *
+			 * \return Music position, accurate to one audio buffer.
+			 */
+			virtual float GetMusicPosition() const override { return _Implementor.GetMusicPosition(); }
+
 			/**
 			* Test if a given sound is currently playing on a channel.
 			*
-			* \param channel Channel id to test. If -1, will test all channels (a bit slow - not recommended).
+			* \param channel Channel id to test. If -1, will test all channels.
 			* \param sound Sound to check if playing.
 			* \return If the given sound is currently playing.
 			*/
@@ -169,6 +183,217 @@ namespace bon
 			*/
 			virtual void SetMasterVolume(int soundEffectsVolume, int musicVolume) override;
 
+			/**
+			 * Set resampling quality of sounds played with pitch.
+			 *
+			 * \param quality Resampling quality.
+			 */
+			virtual void SetPitchQuality(ResamplerQuality quality) override { _Implementor.SetPitchQuality(quality); }
+
+			/**
+			 * Get resampling quality of sounds played with pitch.
+			 *
+			 * \return Resampling quality.
+			 */
+			virtual ResamplerQuality GetPitchQuality() const override { return _Implementor.GetPitchQuality(); }
+
+			/**
+			 * Set how many voices to allocate.
+			 *
+			 * \param count Voices count.
+			 */
+			virtual void SetVoicesCount(int count) override { _Implementor.SetVoicesCount(count); }
+
+			/**
+			 * Get how many voices are allocated.
+			 *
+			 * \return Voices count.
+			 */
+			virtual int GetVoicesCount() const override { return _Implementor.GetVoicesCount(); }
+
+			/**
+			 * Set voice stealing policy.
+			 *
+			 * \param policy Voice stealing policy.
+			 */
+			virtual void SetVoiceStealingPolicy(VoiceStealingPolicy policy) override { _Implementor.SetVoiceStealingPolicy(policy); }
+
+			/**
+			 * Get voice stealing policy.
+			 *
+			 * \return Voice stealing policy.
+			 */
+			virtual VoiceStealingPolicy GetVoiceStealingPolicy() const override { return _Implementor.GetVoiceStealingPolicy(); }
+
+			/**
+			 * Limit how many sounds of a given sound group can play at the same time.
+			 *
+			 * \param group Sound group id.
+			 * \param maxVoices Max voices (0 = no limit).
+			 */
+			virtual void SetSoundGroupLimit(int group, int maxVoices) override { _Implementor.SetSoundGroupLimit(group, maxVoices); }
+
+			/**
+			 * Get stats about currently playing streamed sounds.
+			 *
+			 * \return Streaming stats.
+			 */
+			virtual StreamingStats GetStreamingStats() override { return _Implementor.GetStreamingStats(); }
+
+			/**
+			 * Enable or disable the engine mixer.
+			 *
+			 * \param enable Should we enable engine mixer.
+			 */
+			virtual void EnableEngineMixer(bool enable) override { _Implementor.EnableEngineMixer(enable); }
+
+			/**
+			 * Get if engine mixer is enabled.
+			 *
+			 * \return True if engine mixer is enabled.
+			 */
+			virtual bool IsEngineMixerEnabled() const override { return _Implementor.IsEngineMixerEnabled(); }
+
+			/**
+			 * Play a sound on an engine mixer bus.
+			 *
+			 * \param sound Sound asset to play.
+			 * \param bus Bus to play on.
+			 * \param volume Sound volume (0 to 100).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \param pan Stereo panning (-1.0 = left, 0.0 = center, 1.0 = right).
+			 * \return Mixer voice id, or InvalidMixerVoice if failed to play.
+			 */
+			virtual MixerVoiceId PlaySoundOnBus(assets::SoundAsset sound, MixerBus bus, int volume = 100, int loops = 0, float pan = 0.0f) override;
+
+			/**
+			 * Stop a sound playing on engine mixer.
+			 *
+			 * \param voice Mixer voice id.
+			 */
+			virtual void StopMixerVoice(MixerVoiceId voice) override { _Implementor.StopMixerVoice(voice); }
+
+			/**
+			 * Set engine mixer bus volume.
+			 *
+			 * \param bus Bus to set.
+			 * \param volume Bus volume (0.0 - 1.0).
+			 */
+			virtual void SetBusVolume(MixerBus bus, float volume) override { _Implementor.SetBusVolume(bus, volume); }
+
+			/**
+			 * Set engine mixer bus low-pass filter.
+			 *
+			 * \param bus Bus to set.
+			 * \param cutoff Cutoff frequency, in Hz. 0 to disable filter.
+			 */
+			virtual void SetBusLowPass(MixerBus bus, float cutoff) override { _Implementor.SetBusLowPass(bus, cutoff); }
+
+			/**
+			 * Set engine mixer bus ducking.
+			 *
+			 * \param bus Bus to duck.
+			 * \param trigger Bus that triggers ducking.
+			 * \param amount How much to lower volume.
+			 * \param attack How long it takes to duck, in seconds.
+			 * \param release How long it takes to return to full volume, in seconds.
+			 */
+			virtual void SetBusDucking(MixerBus bus, MixerBus trigger, float amount, float attack = 0.05f, float release = 0.5f) override { _Implementor.SetBusDucking(bus, trigger, amount, attack, release); }
+
+			/**
+			 * Get engine mixer stats.
+			 *
+			 * \return Engine mixer stats.
+			 */
+			virtual MixerStats GetMixerStats() const override { return _Implementor.GetMixerStats(); }
+
+			/**
+			 * Set listener position.
+			 *
+			 * \param position Listener position.
+			 */
+			virtual void SetListenerPosition(const framework::PointF& position) override { _Implementor.SetListenerPosition(position); }
+
+			/**
+			 * Get listener position.
+			 *
+			 * \return Listener position.
+			 */
+			virtual const framework::PointF& GetListenerPosition() const override { return _Implementor.GetListenerPosition(); }
+
+			/**
+			 * Set positional sounds settings.
+			 *
+			 * \param settings Spatial settings to set.
+			 */
+			virtual void SetSpatialSettings(const SpatialSettings& settings) override { _Implementor.SetSpatialSettings(settings); }
+
+			/**
+			 * Get positional sounds settings.
+			 *
+			 * \return Spatial settings.
+			 */
+			virtual const SpatialSettings& GetSpatialSettings() const override { return _Implementor.GetSpatialSettings(); }
+
+			/**
+			 * Play a positional sound.
+			 *
+			 * \param sound Sound asset to play.
+			 * \param position Sound position.
+			 * \param volume Sound volume before attenuation (0 to 100).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \param pitch Sound pitch (1 = no pitch).
+			 * \return Emitter id.
+			 */
+			virtual SoundEmitterId PlaySoundAt(assets::SoundAsset sound, const framework::PointF& position, int volume = 100, int loops = 0, float pitch = 1.0f) override;
+
+			/**
+			 * Set positional sound position.
+			 *
+			 * \param emitter Emitter id.
+			 * \param position New sound position.
+			 */
+			virtual void SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position) override { _Implementor.SetEmitterPosition(emitter, position); }
+
+			/**
+			 * Set positional sound volume, before attenuation.
+			 *
+			 * \param emitter Emitter id.
+			 * \param volume Sound volume (0 to 100).
+			 */
+			virtual void SetEmitterVolume(SoundEmitterId emitter, int volume) override { _Implementor.SetEmitterVolume(emitter, (int)((float)volume * _masterVolume)); }
+
+			/**
+			 * Stop a positional sound.
+			 *
+			 * \param emitter Emitter id.
+			 */
+			virtual void StopEmitter(SoundEmitterId emitter) override { _Implementor.StopEmitter(emitter); }
+
+			/**
+			 * Get if a positional sound is still playing.
+			 *
+			 * \param emitter Emitter id.
+			 * \return True if sound is still playing.
+			 */
+			virtual bool IsEmitterPlaying(SoundEmitterId emitter) const override { return _Implementor.IsEmitterPlaying(emitter); }
+
+			/**
+			 * Get if a positional sound is virtual.
+			 *
+			 * \param emitter Emitter id.
+			 * \return True if sound is virtual.
+			 */
+			virtual bool IsEmitterVirtual(SoundEmitterId emitter) const override { return _Implementor.IsEmitterVirtual(emitter); }
+
+			/**
+			 * Get the channel a positional sound is currently playing on.
+			 *
+			 * \param emitter Emitter id.
+			 * \return Channel id, or InvalidSoundChannel.
+			 */
+			virtual SoundChannelId GetEmitterChannel(SoundEmitterId emitter) const override { return _Implementor.GetEmitterChannel(emitter); }
+
 		protected:
 
 			/**
@@ -13,6 +13,13 @@
 #include <Framework/Rectangle.h>
 #include <Framework/Color.h>
 #include <Sfx/Defs.h>
+#include <Sfx/StreamPlayer.h>
+#include <Sfx/Mixer.h>
+#include <Sfx/Spatial.h>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
 
  // forward declare some SDL stuff
 struct SDL_Window;
@@ -33,6 +40,115 @@ namespace bon
 			// was audio init?
 			bool _wasInit = false;
 
+			// resampling quality of sounds played with pitch
+			ResamplerQuality _pitchQuality = ResamplerQuality::Linear;
+
+			// what sound is playing on a voice (mix channel), used to pick voices to steal
+			struct VoiceInfo
+			{
+				void* Chunk = nullptr;
+				int Priority = 0;
+				int Group = -1;
+				int Volume = 0;
+				int Distance = 0;
+				uint64_t StartOrder = 0;
+			};
+
+			// voices pool settings and state
+			int _voicesCount = 32;
+			VoiceStealingPolicy _stealingPolicy = VoiceStealingPolicy::LowestPriority;
+			std::unordered_map<int, int> _groupLimits;
+			std::vector<VoiceInfo> _voices;
+			uint64_t _playOrder = 0;
+
+			// plays streamed sounds
+			StreamPlayer _streams;
+
+			// engine mixer bus settings, kept so we can apply them when mixer is created
+			struct BusSettings
+			{
+				float Volume = 1.0f;
+				float LowPass = 0.0f;
+				MixerBus DuckTrigger = MixerBus::Master;
+				float DuckAmount = 0.0f;
+				float DuckAttack = 0.05f;
+				float DuckRelease = 0.5f;
+			};
+
+			// optional engine mixer, with sounds it plays (to keep them alive while playing)
+			bool _engineMixerEnabled = false;
+			std::unique_ptr<Mixer> _mixer;
+			BusSettings _busSettings[(int)MixerBus::_Count];
+			std::unordered_map<MixerVoiceId, assets::SoundAsset> _mixerSounds;
+
+			// create engine mixer and open its device
+			void _CreateEngineMixer();
+
+			// close engine mixer device and destroy it
+			void _DestroyEngineMixer();
+
+			// get if a voice is currently playing a sound we started
+			bool _IsVoiceActive(int channel) const;
+
+			// pick a voice to play a new sound on, stealing a voice if needed. returns -1 if sound should be dropped
+			int _PickVoice(int priority, int group);
+
+			// find a voice to steal from sounds with same or lower priority (and same group, if group >= 0). returns -1 if none found
+			int _FindVoiceToSteal(int priority, int group) const;
+
+			// start playing a sound chunk on a voice picked with _PickVoice(). chunk may be a part of the sound's chunk
+			SoundChannelId _StartVoice(assets::SoundAsset sound, void* chunk, SoundChannelId channel, int volume, int loops, float pitch, float fadeInTime);
+
+			// a positional sound. while virtual (out of range or no voice available) it has no channel, but keeps track of play time
+			struct Emitter
+			{
+				assets::SoundAsset Sound;
+				framework::PointF Position;
+				int Volume = 100;
+				int Loops = 0;
+				float Pitch = 1.0f;
+				SoundChannelId Channel = -1;
+				uint64_t StartOrder = 0;
+				double Elapsed = 0;
+				double Length = 0;
+				void* TailChunk = nullptr;
+				int AppliedVolume = -1;
+				int AppliedPan = -1;
+			};
+
+			// listener, spatial settings and positional sounds
+			framework::PointF _listenerPosition;
+			SpatialSettings _spatial;
+			std::unordered_map<SoundEmitterId, Emitter> _emitters;
+			SoundEmitterId _nextEmitterId = 0;
+
+			// check if emitter is playing on its channel
+			bool _IsEmitterReal(const Emitter& emitter) const;
+
+			// check if a virtual emitter finished playing
+			bool _IsEmitterExpired(const Emitter& emitter) const;
+
+			// try to start playing a virtual emitter from where it should be now. returns false if there's no voice for it
+			bool _ResumeEmitter(Emitter& emitter, float distance);
+
+			// stop emitter channel and make it virtual
+			void _VirtualizeEmitter(Emitter& emitter);
+
+			// apply emitter volume and panning to its channel
+			void _ApplySpatial(Emitter& emitter, float distance);
+
+			// update positional sounds
+			void _UpdateEmitters(double deltaTime);
+
+			// music position tracking: frames mixed while music played, and output format
+			std::atomic<uint64_t> _musicFrames{ 0 };
+			float _musicLength = -1.0f;
+			int _outputFrequency = 0;
+			int _outputFrameBytes = 0;
+
+			// effect on final mix that counts frames while music plays (audio thread)
+			static void _MusicPositionEffect(int channel, void* stream, int len, void* userData);
+
 		public:
 
 			/**
@@ -89,12 +205,24 @@ namespace bon
 			/**
 			* Test if a given sound is currently playing on a channel.
 			*
-			* \param channel Channel id to test. If -1, will test all channels (a bit slow - not recommended).
+			* \param channel Channel id to test. If -1, will test all channels.
 			* \param sound Sound to check if playing.
 			* \return If the given sound is currently playing.
 			*/
 			bool IsPlaying(assets::SoundAsset sound, SoundChannelId channel = -1) const;
 
+			/**
+			 * Stop all instances of a sound, including positional sounds.
+			 *
+			 * \param sound Sound to stop.
+			 */
+			void StopSound(assets::SoundAsset sound);
+
+			/**
+			 * Get current music position, in seconds.
+			 */
+			float GetMusicPosition() const;
+
 			/**
 			 * Set the volume of a currently playing sound channel, or stop it if volume is 0.
 			 * 
@@ -148,6 +276,151 @@ namespace bon
 			 */
 			void SetChannelDistance(SoundChannelId channel, float distance);
 
+			/**
+			 * Set resampling quality of sounds played with pitch.
+			 */
+			void SetPitchQuality(ResamplerQuality quality) { _pitchQuality = quality; }
+
+			/**
+			 * Get resampling quality of sounds played with pitch.
+			 */
+			ResamplerQuality GetPitchQuality() const { return _pitchQuality; }
+
+			/**
+			 * Set how many voices (mix channels) to allocate.
+			 * If audio was already initialized, will reallocate channels immediately (sounds playing on removed voices will stop).
+			 */
+			void SetVoicesCount(int count);
+
+			/**
+			 * Get how many voices (mix channels) are allocated.
+			 */
+			int GetVoicesCount() const { return _voicesCount; }
+
+			/**
+			 * Set what to do when a sound plays while all voices are busy.
+			 */
+			void SetVoiceStealingPolicy(VoiceStealingPolicy policy) { _stealingPolicy = policy; }
+
+			/**
+			 * Get what to do when a sound plays while all voices are busy.
+			 */
+			VoiceStealingPolicy GetVoiceStealingPolicy() const { return _stealingPolicy; }
+
+			/**
+			 * Set max voices sounds of a given group can use at once (0 = no limit).
+			 */
+			void SetSoundGroupLimit(int group, int maxVoices);
+
+			/**
+			 * Enable or disable engine mixer.
+			 */
+			void EnableEngineMixer(bool enable);
+
+			/**
+			 * Get if engine mixer is enabled.
+			 */
+			bool IsEngineMixerEnabled() const { return _engineMixerEnabled; }
+
+			/**
+			 * Play a sound on engine mixer bus.
+			 *
+			 * \return Mixer voice id, or InvalidMixerVoice if failed.
+			 */
+			MixerVoiceId PlaySoundOnBus(assets::SoundAsset sound, MixerBus bus, int volume, int loops, float pan);
+
+			/**
+			 * Stop a sound playing on engine mixer.
+			 */
+			void StopMixerVoice(MixerVoiceId voice);
+
+			/**
+			 * Set engine mixer bus volume.
+			 */
+			void SetBusVolume(MixerBus bus, float volume);
+
+			/**
+			 * Set engine mixer bus low-pass filter cutoff.
+			 */
+			void SetBusLowPass(MixerBus bus, float cutoff);
+
+			/**
+			 * Set engine mixer bus ducking.
+			 */
+			void SetBusDucking(MixerBus bus, MixerBus trigger, float amount, float attack, float release);
+
+			/**
+			 * Get engine mixer stats.
+			 */
+			MixerStats GetMixerStats() const { return _mixer ? _mixer->GetStats() : MixerStats(); }
+
+			/**
+			 * Set listener position, for positional sounds.
+			 */
+			void SetListenerPosition(const framework::PointF& position) { _listenerPosition = position; }
+
+			/**
+			 * Get listener position.
+			 */
+			const framework::PointF& GetListenerPosition() const { return _listenerPosition; }
+
+			/**
+			 * Set positional sounds settings.
+			 */
+			void SetSpatialSettings(const SpatialSettings& settings) { _spatial = settings; }
+
+			/**
+			 * Get positional sounds settings.
+			 */
+			const SpatialSettings& GetSpatialSettings() const { return _spatial; }
+
+			/**
+			 * Play a positional sound.
+			 *
+			 * \return Emitter id, or InvalidSoundEmitter if failed.
+			 */
+			SoundEmitterId PlaySoundAt(assets::SoundAsset sound, const framework::PointF& position, int volume, int loops, float pitch);
+
+			/**
+			 * Set positional sound position.
+			 */
+			void SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position);
+
+			/**
+			 * Set positional sound volume, before attenuation.
+			 */
+			void SetEmitterVolume(SoundEmitterId emitter, int volume);
+
+			/**
+			 * Stop a positional sound.
+			 */
+			void StopEmitter(SoundEmitterId emitter);
+
+			/**
+			 * Get if a positional sound is still playing (including while virtual).
+			 */
+			bool IsEmitterPlaying(SoundEmitterId emitter) const { return _emitters.find(emitter) != _emitters.end(); }
+
+			/**
+			 * Get if a positional sound is virtual.
+			 */
+			bool IsEmitterVirtual(SoundEmitterId emitter) const;
+
+			/**
+			 * Get channel a positional sound is playing on, or InvalidSoundChannel if virtual or stopped.
+			 */
+			SoundChannelId GetEmitterChannel(SoundEmitterId emitter) const;
+
+			/**
+			 * Do per-frame updates.
+			 */
+			void Update(double deltaTime);
+
+			/**
+			 * Get streaming stats.
+			 */
+			StreamingStats GetStreamingStats() { return _streams.GetStats(); }
+
 			/**
 			 * Dispose sfx implementation.
 			 */
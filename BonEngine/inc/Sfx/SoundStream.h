@@ -0,0 +1,206 @@
+/*****************************************************************//**
+ * \file   SoundStream.h
+ * \brief  Streamed sounds: encoded data sources and incremental decoders.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Encoded audio data to stream from: either a file, or a buffer in memory.
+		 * Not thread safe; every playing stream opens its own source.
+		 */
+		class BON_DLLEXPORT StreamSource
+		{
+		private:
+			// file to read from (if streaming from file)
+			std::ifstream _file;
+
+			// buffer to read from (if streaming from memory)
+			std::shared_ptr<const std::vector<uint8_t>> _buffer;
+
+			// source size and current position, in bytes
+			size_t _size = 0;
+			size_t _position = 0;
+
+		public:
+			/**
+			 * Open a stream source from file.
+			 *
+			 * \param path File path.
+			 * \return Stream source, or nullptr if failed to open file.
+			 */
+			static std::shared_ptr<StreamSource> FromFile(const char* path);
+
+			/**
+			 * Create a stream source from a buffer in memory.
+			 *
+			 * \param buffer Buffer with encoded data. Shared between all sources streaming from it.
+			 * \return Stream source.
+			 */
+			static std::shared_ptr<StreamSource> FromMemory(std::shared_ptr<const std::vector<uint8_t>> buffer);
+
+			/**
+			 * Read bytes from current position.
+			 *
+			 * \param out Buffer to read into.
+			 * \param bytes How many bytes to read.
+			 * \return How many bytes were actually read.
+			 */
+			size_t Read(void* out, size_t bytes);
+
+			/**
+			 * Move to a position in source.
+			 *
+			 * \param position Position, in bytes from source start.
+			 * \return True if succeed.
+			 */
+			bool Seek(size_t position);
+
+			/**
+			 * Get current position, in bytes.
+			 */
+			size_t Tell() const { return _position; }
+
+			/**
+			 * Get source size, in bytes.
+			 */
+			size_t Size() const { return _size; }
+
+			/**
+			 * Get if streaming from memory.
+			 */
+			bool InMemory() const { return _buffer != nullptr; }
+		};
+
+		/**
+		 * Incrementally decode audio from a stream source into signed 16 bit interleaved PCM.
+		 * Implement this to add support for more formats (for example ogg or mp3), and register it with SoundStreams::RegisterDecoder().
+		 * Decoders run on the streaming thread, never on the audio thread.
+		 */
+		class BON_DLLEXPORT IStreamDecoder
+		{
+		public:
+			/**
+			 * Virtual destructor.
+			 */
+			virtual ~IStreamDecoder() {}
+
+			/**
+			 * Get decoded audio frequency.
+			 */
+			virtual int Frequency() const = 0;
+
+			/**
+			 * Get decoded audio channels count.
+			 */
+			virtual int Channels() const = 0;
+
+			/**
+			 * Decode next frames.
+			 *
+			 * \param out Output buffer, with room for frames * Channels() samples.
+			 * \param frames How many frames to decode.
+			 * \return How many frames were decoded. Less than requested means source ended.
+			 */
+			virtual int Read(int16_t* out, int frames) = 0;
+
+			/**
+			 * Go back to start, for looping.
+			 *
+			 * \return True if succeed.
+			 */
+			virtual bool Rewind() = 0;
+
+			/**
+			 * Get total frames count, or -1 if unknown.
+			 */
+			virtual long long TotalFrames() const { return -1; }
+		};
+
+		/**
+		 * Create a decoder for a stream source.
+		 * Should return nullptr if source is not in a format this decoder can handle.
+		 */
+		typedef std::unique_ptr<IStreamDecoder> (*StreamDecoderFactory)(std::shared_ptr<StreamSource> source);
+
+		/**
+		 * Streaming stats, for all currently playing streamed sounds.
+		 */
+		struct BON_DLLEXPORT StreamingStats
+		{
+			/**
+			 * How many streamed sounds are currently playing.
+			 */
+			int ActiveStreams = 0;
+
+			/**
+			 * Total PCM bytes decoded by streams, since engine started.
+			 */
+			uint64_t DecodedBytes = 0;
+
+			/**
+			 * Bytes currently resident in memory for playing streams (PCM ring buffers and decode buffers).
+			 */
+			size_t ResidentBytes = 0;
+
+			/**
+			 * How many times the audio thread needed data that wasn't decoded yet, since engine started.
+			 */
+			uint64_t Underruns = 0;
+		};
+
+		/**
+		 * Registry of stream decoders, by file extension.
+		 * Comes with a built-in decoder for PCM wav files (8, 16, 24 and 32 bit integers and 32 bit floats).
+		 */
+		class BON_DLLEXPORT SoundStreams
+		{
+		public:
+			/**
+			 * Register a stream decoder for a file extension.
+			 *
+			 * \param extension File extension, without dot (for example "ogg"). Case insensitive.
+			 * \param factory Method to create decoder.
+			 */
+			static void RegisterDecoder(const char* extension, StreamDecoderFactory factory);
+
+			/**
+			 * Get if we have a decoder for a file extension.
+			 *
+			 * \param extension File extension, without dot.
+			 */
+			static bool HasDecoder(const char* extension);
+
+			/**
+			 * Create a decoder for a stream source.
+			 *
+			 * \param extension Source format, as file extension without dot.
+			 * \param source Source to decode.
+			 * \return Decoder, or nullptr if no decoder for this extension or source format is invalid.
+			 */
+			static std::unique_ptr<IStreamDecoder> CreateDecoder(const char* extension, std::shared_ptr<StreamSource> source);
+
+			/**
+			 * Get extension from file path, lowercase and without dot.
+			 *
+			 * \param path File path.
+			 * \return Extension, or empty string if path has no extension.
+			 */
+			static std::string GetExtension(const char* path);
+		};
+	}
+}
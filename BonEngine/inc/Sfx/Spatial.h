@@ -0,0 +1,73 @@
+/*****************************************************************//**
+ * \file   Spatial.h
+ * \brief  Settings and math for 2D positional sounds.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "../Framework/PointF.h"
+#include "Defs.h"
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Settings of positional sounds, relative to the listener.
+		 */
+		struct BON_DLLEXPORT SpatialSettings
+		{
+			/**
+			 * How volume drops with distance.
+			 */
+			AttenuationCurve Curve = AttenuationCurve::Inverse;
+
+			/**
+			 * Distance in which sounds play at full volume.
+			 */
+			float MinDistance = 50.0f;
+
+			/**
+			 * Distance beyond which sounds are culled: they become virtual and don't use a channel until they're back in range.
+			 */
+			float MaxDistance = 1000.0f;
+
+			/**
+			 * How fast volume drops (1.0 = default, higher = faster).
+			 */
+			float Rolloff = 1.0f;
+
+			/**
+			 * Horizontal distance from listener in which sounds are panned all the way to one side. 0 to disable panning.
+			 */
+			float PanDistance = 500.0f;
+
+			/**
+			 * Get volume factor for a sound at a given distance from listener.
+			 *
+			 * \param distance Distance from listener.
+			 * \return Volume factor, from 0.0 to 1.0.
+			 */
+			float Attenuation(float distance) const;
+
+			/**
+			 * Get stereo panning for a sound, based on its horizontal offset from listener.
+			 *
+			 * \param offsetX Sound X position minus listener X position.
+			 * \return Panning, from -1.0 (left) to 1.0 (right).
+			 */
+			float Pan(float offsetX) const;
+
+			/**
+			 * Get if a sound at a given distance is within audible range.
+			 *
+			 * \param distance Distance from listener.
+			 * \return True if sound is in range.
+			 */
+			bool InRange(float distance) const { return distance <= MaxDistance; }
+		};
+	}
+}
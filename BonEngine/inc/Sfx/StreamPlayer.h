@@ -0,0 +1,97 @@
+/*****************************************************************//**
+ * \file   StreamPlayer.h
+ * \brief  Play streamed sounds through mixer channels, decoding them on a worker thread.
+ *
+ * \author Ronen Ness
+ * \date   May 2020
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "SoundStream.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// a single playing stream (defined in StreamPlayer.cpp)
+		class _StreamVoice;
+
+		/**
+		 * Play streamed sounds through mixer channels.
+		 * The channel plays a silent looping chunk, and a channel effect replaces its audio with PCM from a small ring buffer.
+		 * A worker thread decodes and converts audio into the rings, and rewinds decoders on loop so loops are seamless.
+		 * Play(), Update() and Stop() must be called from the main thread.
+		 */
+		class StreamPlayer
+		{
+		private:
+			// playing streams
+			std::vector<std::shared_ptr<_StreamVoice>> _voices;
+			std::mutex _mutex;
+
+			// worker thread
+			std::thread _thread;
+			std::condition_variable _wake;
+			bool _running = false;
+
+			// audio chunk size, in frames, used to size ring buffers
+			int _chunkFrames = 4096;
+
+			// stats
+			std::atomic<uint64_t> _decodedBytes{ 0 };
+			std::atomic<uint64_t> _underruns{ 0 };
+
+			// worker thread loop
+			void _WorkerLoop();
+
+			// decode and convert audio into a stream's ring buffer, until its full or source ended
+			void _Fill(_StreamVoice& voice);
+
+			// effect callbacks, called from audio thread
+			static void _StreamEffect(int channel, void* stream, int len, void* userData);
+			static void _StreamEffectDone(int channel, void* userData);
+
+		public:
+			/**
+			 * Start streaming thread.
+			 *
+			 * \param chunkFrames Audio chunk size, in frames.
+			 */
+			void Start(int chunkFrames);
+
+			/**
+			 * Stop streaming thread and release all streams.
+			 * Channels should be halted before calling this.
+			 */
+			void Stop();
+
+			/**
+			 * Start streaming into a channel that just started playing.
+			 *
+			 * \param channel Mix channel, already playing a silent looping chunk.
+			 * \param decoder Decoder to stream from.
+			 * \param loops How many times to repeat the stream (-1 = endless loop).
+			 * \return True if succeed.
+			 */
+			bool Play(int channel, std::unique_ptr<IStreamDecoder> decoder, int loops);
+
+			/**
+			 * Halt channels of streams that ended and release streams that no longer play.
+			 * Should be called every frame.
+			 */
+			void Update();
+
+			/**
+			 * Get streaming stats.
+			 */
+			StreamingStats GetStats();
+		};
+	}
+}
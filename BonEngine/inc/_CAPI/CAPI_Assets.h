@@ -164,6 +164,26 @@ extern "C" {
 	 */
 	BON_DLLEXPORT bool BON_Sound_IsPlaying(bon::SoundAsset* sound);
 
+	/**
+	* Get how many instances of a sound are currently playing.
+	*/
+	BON_DLLEXPORT int BON_Sound_PlayingInstances(bon::SoundAsset* sound);
+
+	/**
+	* Set sound priority, used when all voices are busy.
+	*/
+	BON_DLLEXPORT void BON_Sound_SetPriority(bon::SoundAsset* sound, int priority);
+
+	/**
+	* Set sound group, used to limit concurrent sounds of the same group (-1 = no group).
+	*/
+	BON_DLLEXPORT void BON_Sound_SetGroup(bon::SoundAsset* sound, int group);
+
+	/**
+	* Get how many bytes this sound takes when fully decoded.
+	*/
+	BON_DLLEXPORT int64_t BON_Sound_DecodedSize(bon::SoundAsset* sound);
+
 	/**
 	 * Get font asset native size.
 	 */
@@ -47,6 +47,47 @@ extern "C" {
 		char Text[32];
 	};
 
+	/**
+	* Frame time statistics.
+	*/
+	struct BON_DLLEXPORT BON_FrameTimeStats
+	{
+		int FramesCount;
+		double Min;
+		double Max;
+		double Mean;
+		double P50;
+		double P95;
+		double P99;
+		int FramesOverBudget;
+		int Histogram[20];
+	};
+
+	/**
+	* Streaming stats.
+	*/
+	struct BON_DLLEXPORT BON_StreamingStats
+	{
+		int ActiveStreams;
+		int64_t DecodedBytes;
+		int64_t ResidentBytes;
+		int64_t Underruns;
+	};
+
+	/**
+	* Engine mixer stats.
+	*/
+	struct BON_DLLEXPORT BON_MixerStats
+	{
+		int64_t Callbacks;
+		double LastCallbackMs;
+		double AverageCallbackMs;
+		double MaxCallbackMs;
+		double Load;
+		int ActiveVoices;
+		int64_t DroppedCommands;
+	};
+
 	/**
 	 * CAPI export of text input modes.
 	 */
@@ -97,10 +138,30 @@ extern "C" {
 		BON_Counters_DrawCalls = bon::DiagnosticsCounters::DrawCalls,
 		BON_Counters_PlaySoundCalls = bon::DiagnosticsCounters::PlaySoundCalls,
 		BON_Counters_LoadedAssets = bon::DiagnosticsCounters::LoadedAssets,
+		BON_Counters_TextureBinds = bon::DiagnosticsCounters::TextureBinds,
+		BON_Counters_ShaderSwitches = bon::DiagnosticsCounters::ShaderSwitches,
+		BON_Counters_TextCacheHits = bon::DiagnosticsCounters::TextCacheHits,
+		BON_Counters_TextCacheMisses = bon::DiagnosticsCounters::TextCacheMisses,
+		BON_Counters_AssetLoads = bon::DiagnosticsCounters::AssetLoads,
+		BON_Counters_FrameAllocations = bon::DiagnosticsCounters::FrameAllocations,
+		BON_Counters_FrameAllocatedBytes = bon::DiagnosticsCounters::FrameAllocatedBytes,
+		BON_Counters_SoundsStolen = bon::DiagnosticsCounters::SoundsStolen,
+		BON_Counters_SoundsDropped = bon::DiagnosticsCounters::SoundsDropped,
+		BON_Counters_VirtualVoices = bon::DiagnosticsCounters::VirtualVoices,
 		BON_Counters__BuiltInCounterCount = bon::DiagnosticsCounters::_BuiltInCounterCount,
 		BON_Counters__MaxCounters = bon::DiagnosticsCounters::_MaxCounters,
 	};
 
+	/**
+	 * CAPI export of diagnostic counter types.
+	 */
+	BON_DLLEXPORT enum BON_CounterTypes
+	{
+		BON_CounterTypes_PerFrame = bon::CounterTypes::PerFrame,
+		BON_CounterTypes_Cumulative = bon::CounterTypes::Cumulative,
+		BON_CounterTypes_Gauge = bon::CounterTypes::Gauge,
+	};
+
 	/**
 	 * CAPI export of diagnostic counters.
 	 */
@@ -143,6 +204,28 @@ extern "C" {
 		BON_LogLevel_Crit = bon::LogLevel::Critical,
 	};
 
+	/**
+	* Log categories.
+	*/
+	BON_DLLEXPORT enum BON_LogCategory
+	{
+		BON_LogCategory_General = bon::LogCategory::General,
+		BON_LogCategory_Gfx = bon::LogCategory::Gfx,
+		BON_LogCategory_Assets = bon::LogCategory::Assets,
+		BON_LogCategory_Input = bon::LogCategory::Input,
+		BON_LogCategory_Sfx = bon::LogCategory::Sfx,
+		BON_LogCategory_UI = bon::LogCategory::UI,
+	};
+
+	/**
+	* Async log overflow policies.
+	*/
+	BON_DLLEXPORT enum BON_LogOverflowPolicy
+	{
+		BON_LogOverflowPolicy_Drop = bon::LogOverflowPolicy::Drop,
+		BON_LogOverflowPolicy_Block = bon::LogOverflowPolicy::Block,
+	};
+
 	/**
 	 * CAPI export of diagnostic counters.
 	 */
@@ -156,6 +239,48 @@ extern "C" {
 		BON_AudioFormats_U8 = bon::AudioFormats::U8,
 	};
 
+	/**
+	 * CAPI export of voice stealing policies.
+	 */
+	BON_DLLEXPORT enum BON_VoiceStealingPolicy
+	{
+		BON_VoiceStealingPolicy_None = bon::VoiceStealingPolicy::None,
+		BON_VoiceStealingPolicy_Oldest = bon::VoiceStealingPolicy::Oldest,
+		BON_VoiceStealingPolicy_Quietest = bon::VoiceStealingPolicy::Quietest,
+		BON_VoiceStealingPolicy_LowestPriority = bon::VoiceStealingPolicy::LowestPriority,
+	};
+
+	/**
+	 * CAPI export of engine mixer buses.
+	 */
+	BON_DLLEXPORT enum BON_MixerBus
+	{
+		BON_MixerBus_Master = bon::MixerBus::Master,
+		BON_MixerBus_Music = bon::MixerBus::Music,
+		BON_MixerBus_Sfx = bon::MixerBus::Sfx,
+		BON_MixerBus_UI = bon::MixerBus::UI,
+		BON_MixerBus_Voice = bon::MixerBus::Voice,
+	};
+
+	/**
+	 * CAPI export of attenuation curves.
+	 */
+	BON_DLLEXPORT enum BON_AttenuationCurve
+	{
+		BON_AttenuationCurve_Linear = bon::AttenuationCurve::Linear,
+		BON_AttenuationCurve_Inverse = bon::AttenuationCurve::Inverse,
+		BON_AttenuationCurve_Exponential = bon::AttenuationCurve::Exponential,
+	};
+
+	/**
+	 * CAPI export of resampler quality.
+	 */
+	BON_DLLEXPORT enum BON_ResamplerQuality
+	{
+		BON_ResamplerQuality_Linear = bon::ResamplerQuality::Linear,
+		BON_ResamplerQuality_Cubic = bon::ResamplerQuality::Cubic,
+	};
+
 	/**
 	 * CAPI export of ui element types.
 	 */
@@ -465,6 +590,23 @@ extern "C" {
 		BON_Mouse_Right,
 		BON_Mouse_X1,
 		BON_Mouse_X2,
+		BON_Gamepad_A,
+		BON_Gamepad_B,
+		BON_Gamepad_X,
+		BON_Gamepad_Y,
+		BON_Gamepad_Back,
+		BON_Gamepad_Guide,
+		BON_Gamepad_Start,
+		BON_Gamepad_LeftStick,
+		BON_Gamepad_RightStick,
+		BON_Gamepad_LeftShoulder,
+		BON_Gamepad_RightShoulder,
+		BON_Gamepad_DpadUp,
+		BON_Gamepad_DpadDown,
+		BON_Gamepad_DpadLeft,
+		BON_Gamepad_DpadRight,
+		BON_Gamepad_LeftTrigger,
+		BON_Gamepad_RightTrigger,
 	};
 
 #ifdef __cplusplus
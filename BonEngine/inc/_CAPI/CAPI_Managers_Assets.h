@@ -35,6 +35,16 @@ extern "C" {
 	*/
 	BON_DLLEXPORT bon::SoundAsset* BON_Assets_LoadSound(const char* filename, bool useCache);
 
+	/**
+	* Load and return a streamed sound asset.
+	*/
+	BON_DLLEXPORT bon::SoundAsset* BON_Assets_LoadSoundStream(const char* filename, bool useCache);
+
+	/**
+	* Create a streamed sound asset from encoded data in memory.
+	*/
+	BON_DLLEXPORT bon::SoundAsset* BON_Assets_CreateSoundStream(const void* data, int size, const char* format);
+
 	/**
 	* Load and return a font asset.
 	*/
@@ -60,11 +70,31 @@ extern "C" {
 	*/
 	BON_DLLEXPORT bool BON_Assets_SaveConfig(bon::ConfigAsset* config, const char* filename);
 
+	/**
+	* Compile config into binary config file (if filename is null, will write next to source file with '.bcfg' suffix).
+	*/
+	BON_DLLEXPORT bool BON_Assets_CompileConfig(bon::ConfigAsset* config, const char* filename);
+
 	/**
 	* Clear all assets from cache.
 	*/
 	BON_DLLEXPORT void BON_Assets_ClearCache();
 
+	/**
+	* Set memory budget for cached assets, in bytes (0 = unlimited).
+	*/
+	BON_DLLEXPORT void BON_Assets_SetMemoryBudget(int64_t bytes);
+
+	/**
+	* Get estimated memory currently held by the assets cache, in bytes.
+	*/
+	BON_DLLEXPORT int64_t BON_Assets_CachedMemorySize();
+
+	/**
+	* Enable / disable hot reload of images, configs and effects when their files change.
+	*/
+	BON_DLLEXPORT void BON_Assets_EnableHotReload(bool enable);
+
 	/**
 	* Load and return an effect asset.
 	*/
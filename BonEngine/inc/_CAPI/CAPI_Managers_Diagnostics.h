@@ -28,11 +28,112 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Diagnostics_ResetCounter(int id);
 
+	/**
+	* Set counter value.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_SetCounter(int id, int64_t value);
+
+	/**
+	* Get per-frame counter value from last frame.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetCounterLastFrame(int id);
+
+	/**
+	* Register a named counter, or get its id if already registered.
+	*/
+	BON_DLLEXPORT int BON_Diagnostics_RegisterCounter(const char* name, BON_CounterTypes type);
+
+	/**
+	* Get registered counter id by name, or -1 if not registered.
+	*/
+	BON_DLLEXPORT int BON_Diagnostics_GetCounterId(const char* name);
+
+	/**
+	* Draw top counters on screen.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_DrawCountersOverlay(const bon::assets::FontAsset* font, int topN, float x, float y, int fontSize);
+
 	/**
 	* Get FPS count.
 	*/
 	BON_DLLEXPORT void BON_Diagnostics_FpsCounter();
 
+	/**
+	* Get estimated memory of loaded assets of a given type, in bytes.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetAssetsLoadedBytes(int assetType);
+
+	/**
+	* Get estimated memory of cached assets of a given type, in bytes.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetAssetsCachedBytes(int assetType);
+
+	/**
+	* Get how many assets of a given type were evicted from cache due to memory budget.
+	*/
+	BON_DLLEXPORT long BON_Diagnostics_GetAssetsEvictions(int assetType);
+
+	/**
+	* Start recording profiled scopes.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_StartProfiler();
+
+	/**
+	* Stop recording profiled scopes.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_StopProfiler();
+
+	/**
+	* Export recorded profiled scopes to Chrome trace json file.
+	*/
+	BON_DLLEXPORT bool BON_Diagnostics_ExportProfiler(const char* filename);
+
+	/**
+	* Enable or disable heap allocations tracking.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_EnableAllocationTracker(bool enable);
+
+	/**
+	* Get heap allocations made during last frame.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetFrameAllocations();
+
+	/**
+	* Get heap bytes allocated during last frame.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetFrameAllocatedBytes();
+
+	/**
+	* Write heap allocations per tag to CSV file.
+	*/
+	BON_DLLEXPORT bool BON_Diagnostics_DumpAllocationTags(const char* filename);
+
+	/**
+	* Get frame time statistics of a frame phase.
+	* Returns empty stats if phase is invalid.
+	*/
+	BON_DLLEXPORT BON_FrameTimeStats BON_Diagnostics_GetFrameStats(int phase);
+
+	/**
+	* Set frame stats window size, in frames.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_SetFrameStatsWindow(int frames);
+
+	/**
+	* Set frame time budget, in milliseconds.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_SetFrameBudget(double milliseconds);
+
+	/**
+	* Write frame time stats to CSV file.
+	*/
+	BON_DLLEXPORT bool BON_Diagnostics_DumpFrameStatsCsv(const char* filename);
+
+	/**
+	* Set CSV file to write frame time stats to when engine exits.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_SetFrameStatsCsvOnExit(const char* filename);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
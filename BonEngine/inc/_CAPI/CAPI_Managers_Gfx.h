@@ -134,6 +134,11 @@ extern "C" {
 	 */
 	BON_DLLEXPORT void BON_Gfx_GetTextBoundingBox(const bon::assets::FontAsset* font, const char* text, float x, float y, int fontSize, int maxWidth, float originX, float originY, float rotation, int* outX, int* outY, int* outWidth, int* outHeight);
 
+	/**
+	 * Enable or disable GPU timer queries.
+	 */
+	BON_DLLEXPORT bool BON_Gfx_EnableGpuTimers(bool enable);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
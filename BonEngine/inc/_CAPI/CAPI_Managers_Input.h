@@ -28,6 +28,71 @@ extern "C" {
 	*/
 	BON_DLLEXPORT bool BON_Input_PressedNow(const char* actionId);
 
+	/**
+	* Get action id from action name, to query actions without string lookups.
+	*/
+	BON_DLLEXPORT int BON_Input_GetActionId(const char* actionId);
+
+	/**
+	* Get if a given game action is down, by action id.
+	*/
+	BON_DLLEXPORT bool BON_Input_DownId(int actionId);
+
+	/**
+	* Get if a given game action was released this frame, by action id.
+	*/
+	BON_DLLEXPORT bool BON_Input_ReleasedNowId(int actionId);
+
+	/**
+	* Get if a given game action was pressed this frame, by action id.
+	*/
+	BON_DLLEXPORT bool BON_Input_PressedNowId(int actionId);
+
+	/**
+	* Start recording input into a file.
+	*/
+	BON_DLLEXPORT void BON_Input_StartRecording(const char* filename);
+
+	/**
+	* Stop recording input.
+	*/
+	BON_DLLEXPORT void BON_Input_StopRecording();
+
+	/**
+	* Start replaying recorded input.
+	*/
+	BON_DLLEXPORT void BON_Input_StartReplay(const char* filename, bool exitWhenDone);
+
+	/**
+	* Stop replaying recorded input.
+	*/
+	BON_DLLEXPORT void BON_Input_StopReplay();
+
+	/**
+	* Get if a gamepad is connected for a given player.
+	*/
+	BON_DLLEXPORT bool BON_Input_GamepadConnected(int player);
+
+	/**
+	* Get if a gamepad button is down for a given player.
+	*/
+	BON_DLLEXPORT bool BON_Input_GamepadDown(int player, BON_KeyCodes button);
+
+	/**
+	* Get gamepad axis value for a given player.
+	*/
+	BON_DLLEXPORT float BON_Input_GamepadAxis(int player, int axis);
+
+	/**
+	* Set gamepad dead zones.
+	*/
+	BON_DLLEXPORT void BON_Input_SetGamepadDeadZones(float sticks, float triggers);
+
+	/**
+	* Rumble a player's gamepad.
+	*/
+	BON_DLLEXPORT bool BON_Input_GamepadRumble(int player, float lowFrequency, float highFrequency, unsigned int durationMs);
+
 	/**
 	* Get if a key code is down.
 	*/
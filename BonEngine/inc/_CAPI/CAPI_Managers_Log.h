@@ -38,6 +38,41 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Log_Flush();
 
+	/**
+	* Enable or disable async logging.
+	*/
+	BON_DLLEXPORT void BON_Log_SetAsync(bool async, BON_LogOverflowPolicy overflowPolicy, int capacity);
+
+	/**
+	* Get if async logging is enabled.
+	*/
+	BON_DLLEXPORT bool BON_Log_IsAsync();
+
+	/**
+	* Set log file write buffer size.
+	*/
+	BON_DLLEXPORT void BON_Log_SetFileBufferSize(int bufferSize);
+
+	/**
+	* Set interval between forced log file flushes.
+	*/
+	BON_DLLEXPORT void BON_Log_SetFlushInterval(double seconds);
+
+	/**
+	* Set log file rotation by size.
+	*/
+	BON_DLLEXPORT void BON_Log_SetFileRotation(long long maxFileSize, int maxBackups);
+
+	/**
+	* Set log level of a category.
+	*/
+	BON_DLLEXPORT void BON_Log_SetCategoryLevel(BON_LogCategory category, BON_LogLevel level);
+
+	/**
+	* Get log level of a category.
+	*/
+	BON_DLLEXPORT BON_LogLevel BON_Log_GetCategoryLevel(BON_LogCategory category);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
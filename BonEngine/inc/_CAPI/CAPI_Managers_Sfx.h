@@ -38,6 +38,11 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Sfx_StopMusic();
 
+	/**
+	* Get current music position, in seconds.
+	*/
+	BON_DLLEXPORT float BON_Sfx_GetMusicPosition();
+
 	/**
 	* Play a sound effect.
 	*/
@@ -78,11 +83,126 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Sfx_StopChannel(int channel);
 
+	/**
+	* Stop all playing instances of a sound.
+	*/
+	BON_DLLEXPORT void BON_Sfx_StopSound(bon::assets::SoundAsset* sound);
+
 	/**
 	* Set the master volume of music and sound effects.
 	*/
 	BON_DLLEXPORT void BON_Sfx_SetMasterVolume(int soundEffectsVolume, int musicVolume);
 
+	/**
+	* Set resampling quality of sounds played with pitch.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetPitchQuality(BON_ResamplerQuality quality);
+
+	/**
+	* Set how many voices to allocate.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetVoicesCount(int count);
+
+	/**
+	* Get how many voices are allocated.
+	*/
+	BON_DLLEXPORT int BON_Sfx_GetVoicesCount();
+
+	/**
+	* Set what to do when playing a sound while all voices are busy.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetVoiceStealingPolicy(BON_VoiceStealingPolicy policy);
+
+	/**
+	* Limit how many sounds of a given sound group can play at the same time.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetSoundGroupLimit(int group, int maxVoices);
+
+	/**
+	* Get streaming stats.
+	*/
+	BON_DLLEXPORT BON_StreamingStats BON_Sfx_GetStreamingStats();
+
+	/**
+	* Enable or disable the engine mixer.
+	*/
+	BON_DLLEXPORT void BON_Sfx_EnableEngineMixer(bool enable);
+
+	/**
+	* Get if engine mixer is enabled.
+	*/
+	BON_DLLEXPORT bool BON_Sfx_IsEngineMixerEnabled();
+
+	/**
+	* Play a sound on an engine mixer bus.
+	*/
+	BON_DLLEXPORT int BON_Sfx_PlaySoundOnBus(bon::assets::SoundAsset* sound, BON_MixerBus bus, int volume, int loops, float pan);
+
+	/**
+	* Stop a sound playing on engine mixer.
+	*/
+	BON_DLLEXPORT void BON_Sfx_StopMixerVoice(int voice);
+
+	/**
+	* Set engine mixer bus volume.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetBusVolume(BON_MixerBus bus, float volume);
+
+	/**
+	* Set engine mixer bus low-pass filter.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetBusLowPass(BON_MixerBus bus, float cutoff);
+
+	/**
+	* Set engine mixer bus ducking.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetBusDucking(BON_MixerBus bus, BON_MixerBus trigger, float amount, float attack, float release);
+
+	/**
+	* Get engine mixer stats.
+	*/
+	BON_DLLEXPORT BON_MixerStats BON_Sfx_GetMixerStats();
+
+	/**
+	* Set listener position, for positional sounds.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetListenerPosition(float x, float y);
+
+	/**
+	* Set positional sounds settings.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetSpatialSettings(BON_AttenuationCurve curve, float minDistance, float maxDistance, float rolloff, float panDistance);
+
+	/**
+	* Play a positional sound.
+	*/
+	BON_DLLEXPORT int BON_Sfx_PlaySoundAt(bon::assets::SoundAsset* sound, float x, float y, int volume, int loops, float pitch);
+
+	/**
+	* Set positional sound position.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetEmitterPosition(int emitter, float x, float y);
+
+	/**
+	* Set positional sound volume.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetEmitterVolume(int emitter, int volume);
+
+	/**
+	* Stop a positional sound.
+	*/
+	BON_DLLEXPORT void BON_Sfx_StopEmitter(int emitter);
+
+	/**
+	* Get if a positional sound is still playing.
+	*/
+	BON_DLLEXPORT bool BON_Sfx_IsEmitterPlaying(int emitter);
+
+	/**
+	* Get if a positional sound is virtual.
+	*/
+	BON_DLLEXPORT bool BON_Sfx_IsEmitterVirtual(int emitter);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <Assets/Assets.h>
+#include <Assets/CompiledConfig.h>
 #include <Assets/Types/IAsset.h>
 #include <Framework/Exceptions.h>
 #include <Diagnostics/IDiagnostics.h>
@@ -6,11 +7,29 @@
 #include <BonEngine.h>
 #include <fstream>
 #include <mutex>
+#include <shared_mutex>
+#include <algorithm>
 
-// mutex for cache so we won't accidentally get a broken asset
-std::mutex g_cache_mutex;
+// mutex for cache so we won't accidentally get a broken asset.
+// lookups only take a shared lock, so loading cached assets from multiple threads won't block each other.
+std::shared_mutex g_cache_mutex;
 std::mutex g_delete_queue_mutex;
 
+// mutex for hot reload watch list, since assets might be loaded from other threads
+std::mutex g_hot_reload_mutex;
+
+// how long to wait before trying to enforce memory budget again, if last attempt couldn't fit the budget
+const double BudgetRecheckInterval = 0.5;
+
+// how often to check watched files for changes, when hot reload is enabled
+const double HotReloadCheckInterval = 0.25;
+
+// how long a changed file needs to stay unchanged before we reload it (editors often write files in several steps)
+const double HotReloadSettleTime = 0.2;
+
+// max files to reload per frame, so saving many files at once won't stall a single frame
+const int MaxHotReloadsPerFrame = 4;
+
 // make sure file exists
 inline bool validate_file_exist(const std::string& name) {
 	ifstream f(name.c_str());
@@ -37,36 +56,40 @@ namespace bon
 			 * 
 			 * \param assets Assets manager.
 			 * \param path Asset path.
-			 * \param cacheKey Key to use when putting / getting from cache
+			 * \param cacheVariant Asset variant to use as part of its cache key (for example image filtering mode).
 			 * \param useCache Should we use cache?
 			 * \param extraData Optional extra data to pass to creation.
 			 * \param instanceCreator Optional lambda to create a new instance, if needed. If not provided, will just create using default constructor.
 			 * \return Asset instance.
 			 */
 			template <class AssetType>
-			static shared_ptr<AssetType> LoadAssetT(Assets* assets, const char* path, const char* cacheKey, bool useCache, void* extraData = nullptr, std::function<AssetType*()>&& instanceCreator = nullptr)
+			static shared_ptr<AssetType> LoadAssetT(Assets* assets, const char* path, int cacheVariant, bool useCache, void* extraData = nullptr, std::function<AssetType*()>&& instanceCreator = nullptr)
 			{
+				BON_PROFILE_SCOPE("Assets::Load");
+
 				// make sure path is valid
 				if (path == nullptr || path[0] == '\0') {
 					throw framework::AssetLoadError("Cannot load asset with empty path!");
 				}
 
-				// make sure file exists
-				if (!validate_file_exist(path))
-				{
-					throw framework::AssetLoadError((std::string("File not found! Path: '" + std::string(path)).c_str()));
-				}
-
 				// try to get from cache
+				Assets::CacheKey cacheKey;
 				if (useCache) {
-					std::lock_guard<std::mutex> guard(g_cache_mutex);
+					cacheKey = Assets::MakeCacheKey(path, cacheVariant);
+					std::shared_lock<std::shared_mutex> guard(g_cache_mutex);
 					AssetPtr fromCache = assets->GetFromCache(cacheKey);
 					if (fromCache.get() != nullptr) {
-						BON_DLOG("Retrieved asset from cache: '%s'. Asset address: %x.", cacheKey, fromCache.get());
+						BON_DLOG_CAT(Assets, "Retrieved asset from cache: '%s'. Asset address: %x.", path, fromCache.get());
 						return std::static_pointer_cast<AssetType>(fromCache);
 					}
 				}
 
+				// make sure file exists (only needed when not in cache)
+				if (!validate_file_exist(path))
+				{
+					throw framework::AssetLoadError((std::string("File not found! Path: '" + std::string(path)).c_str()));
+				}
+
 				// if got here it means we need to load.
 				// create asset instance and init it (either use lambda we got, or just create a new instance
 				AssetType* ret; 
@@ -77,6 +100,7 @@ namespace bon
 					ret = new AssetType(path);
 				}
 				assets->InitNewAsset(ret, extraData);
+				_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::AssetLoads);
 
 				// convert to shared ptr with corresponding deleter
 				auto assetPtr = std::shared_ptr<AssetType>(ret, [assets](IAsset* asset) {
@@ -85,12 +109,15 @@ namespace bon
 						_deleteQueue.push_back(asset);
 					}
 				});
-				BON_DLOG("Created new asset with path: '%s'. Asset address: %x. Add to cache: %d", path, assetPtr.get(), useCache);
+				BON_DLOG_CAT(Assets, "Created new asset with path: '%s'. Asset address: %x. Add to cache: %d", path, assetPtr.get(), useCache);
 
-				// add to cache and return
+				// add to cache and hot reload watch list and return
 				if (useCache) {
 					assets->PutInCache(assetPtr, cacheKey);
 				}
+				if (assets->_hotReload) {
+					assets->WatchForHotReload(assetPtr);
+				}
 				return assetPtr;
 			}
 		};
@@ -108,11 +135,28 @@ namespace bon
 		// do updates
 		void Assets::_Update(double deltaTime)
 		{
+			// evict unused cached assets if we exceed memory budget.
+			// if we failed to fit budget (all cached assets are in use) don't retry every frame.
+			_timeToNextBudgetCheck -= deltaTime;
+			if (_memoryBudget > 0 && _cachedBytes > _memoryBudget && _timeToNextBudgetCheck <= 0)
+			{
+				BON_PROFILE_SCOPE("Assets::EnforceMemoryBudget");
+				_timeToNextBudgetCheck = EnforceMemoryBudget() ? 0 : BudgetRecheckInterval;
+			}
+
+			// reload changed files
+			if (_hotReload)
+			{
+				BON_PROFILE_SCOPE("Assets::HotReload");
+				UpdateHotReload(deltaTime);
+			}
+
 			// clear assets on delete list
 			std::lock_guard<std::mutex> guard(g_delete_queue_mutex);
 			if (!_deleteQueue.empty())
 			{
-				BON_DLOG("Got %d assets to destroy. Begin disposing..", _deleteQueue.size());
+				BON_PROFILE_SCOPE("Assets::DisposeQueue");
+				BON_DLOG_CAT(Assets, "Got %d assets to destroy. Begin disposing..", _deleteQueue.size());
 				for (auto asset : _deleteQueue)
 				{
 					if (asset->IsValid())
@@ -120,12 +164,12 @@ namespace bon
 						this->Dispose(asset);
 					}
 				}
-				BON_DLOG("Now delete disposed assets.");
+				BON_DLOG_CAT(Assets, "Now delete disposed assets.");
 				for (int i = 0; i < (int)_deleteQueue.size(); ++i)
 				{
 					delete _deleteQueue[i];
 				}
-				BON_DLOG("Done deleting assets.");
+				BON_DLOG_CAT(Assets, "Done deleting assets.");
 				_deleteQueue.clear();
 			}
 		}
@@ -139,43 +183,62 @@ namespace bon
 		ImageAsset Assets::LoadImage(const char* filename, ImageFilterMode filter, bool useCache)
 		{
 			auto createImageLambda = [filename, filter]() { return new _Image(filename, filter); };
-			std::string tempStringForCache;
-			if (useCache) { tempStringForCache = (std::string(filename) + std::to_string((int)filter)); }
-			const char* cacheKey = useCache ? tempStringForCache.c_str() : nullptr;
-			return AssetsLoaderCode::LoadAssetT<_Image>(this, filename, cacheKey, useCache, nullptr, createImageLambda);
+			return AssetsLoaderCode::LoadAssetT<_Image>(this, filename, (int)filter, useCache, nullptr, createImageLambda);
 		}
 
 		// load a music asset
 		MusicAsset Assets::LoadMusic(const char* filename, bool useCache)
 		{
-			return AssetsLoaderCode::LoadAssetT<_Music>(this, filename, filename, useCache);
+			return AssetsLoaderCode::LoadAssetT<_Music>(this, filename, 0, useCache);
 		}
 		
 		// load a sound effect asset
 		SoundAsset Assets::LoadSound(const char* filename, bool useCache)
 		{
-			return AssetsLoaderCode::LoadAssetT<_Sound>(this, filename, filename, useCache);
+			return AssetsLoaderCode::LoadAssetT<_Sound>(this, filename, 0, useCache);
+		}
+
+		// load a streamed sound asset (different cache variant than fully decoded sounds)
+		SoundAsset Assets::LoadSoundStream(const char* filename, bool useCache)
+		{
+			auto createSoundLambda = [filename]() { return new _Sound(filename, true); };
+			return AssetsLoaderCode::LoadAssetT<_Sound>(this, filename, 1, useCache, nullptr, createSoundLambda);
+		}
+
+		// create a streamed sound asset from memory
+		SoundAsset Assets::CreateSoundStream(const void* data, size_t size, const char* format)
+		{
+			// create streamed sound
+			_Sound* ret = new _Sound(nullptr, true);
+			_SoundStreamData streamData = { data, size, format };
+			InitNewAsset(ret, (void*)&streamData);
+
+			// convert to shared ptr with corresponding deleter
+			auto assetPtr = std::shared_ptr<_Sound>(ret, [this](IAsset* asset) {
+				if (!bon::_GetEngine().Destroyed()) {
+					std::lock_guard<std::mutex> guard(g_delete_queue_mutex);
+					_deleteQueue.push_back(asset);
+				}
+			});
+			return assetPtr;
 		}
 
 		// load a config asset
 		ConfigAsset Assets::LoadConfig(const char* filename, bool useCache)
 		{
-			return AssetsLoaderCode::LoadAssetT<_Config>(this, filename, filename, useCache);
+			return AssetsLoaderCode::LoadAssetT<_Config>(this, filename, 0, useCache);
 		}
 
 		// load a font asset
 		FontAsset Assets::LoadFont(const char* filename, int fontSize, bool useCache)
 		{
-			std::string tempStringForCache;
-			if (useCache) { tempStringForCache = (std::string(filename) + std::to_string(fontSize)); }
-			const char* cacheKey = useCache ? tempStringForCache.c_str() : nullptr;
-			return AssetsLoaderCode::LoadAssetT<_Font>(this, filename, cacheKey, useCache, &fontSize);
+			return AssetsLoaderCode::LoadAssetT<_Font>(this, filename, fontSize, useCache, &fontSize);
 		}
 
 		// load effect asset
 		EffectAsset Assets::LoadEffect(const char* filename, bool useCache)
 		{
-			return AssetsLoaderCode::LoadAssetT<_Effect>(this, filename, filename, useCache);
+			return AssetsLoaderCode::LoadAssetT<_Effect>(this, filename, 0, useCache);
 		}
 
 		// create an effect asset from handle instance
@@ -218,26 +281,398 @@ namespace bon
 			return assetPtr;
 		}
 		
+		// build cache key from path and variant
+		Assets::CacheKey Assets::MakeCacheKey(const char* path, int variant)
+		{
+			// FNV-1a over path, then variant
+			const unsigned long long prime = 1099511628211ULL;
+			unsigned long long hash = 14695981039346656037ULL;
+			for (const char* c = path; *c != '\0'; ++c)
+			{
+				hash ^= (unsigned char)(*c);
+				hash *= prime;
+			}
+			hash ^= (unsigned int)variant;
+			hash *= prime;
+
+			CacheKey ret;
+			ret.Hash = hash;
+			ret.Path = path;
+			ret.Variant = variant;
+			return ret;
+		}
+
+		// get the variant an asset is cached with
+		int Assets::GetCacheVariant(const IAsset* asset)
+		{
+			switch (asset->AssetType())
+			{
+			case AssetTypes::Image:
+				return (int)static_cast<const _Image*>(asset)->FilteringMode();
+			case AssetTypes::Font:
+				return static_cast<const _Font*>(asset)->FontSize();
+			default:
+				return 0;
+			}
+		}
+
 		// add asset to cache
-		void Assets::PutInCache(AssetPtr asset, const char* key)
+		void Assets::PutInCache(AssetPtr asset, const CacheKey& key)
 		{
-			BON_DLOG("Add asset '%s' to cache (key = '%s').", asset->Path(), key);
-			std::lock_guard<std::mutex> guard(g_cache_mutex);
-			(_cache)[std::move(key)] = asset;
+			BON_DLOG_CAT(Assets, "Add asset '%s' to cache (variant = %d).", key.Path, key.Variant);
+			size_t memorySize = asset->MemorySize();
+			auto& stats = _GetEngine().Diagnostics()._GetAssetsResidency(asset->AssetType());
+
+			std::unique_lock<std::shared_mutex> guard(g_cache_mutex);
+			auto found = _cache.find(key.Hash);
+
+			// key already in cache? replace the cached asset
+			if (found != _cache.end())
+			{
+				CachedAsset& entry = found->second;
+
+				// different asset with same hash? don't cache, to not break the one already cached
+				if (entry.Variant != key.Variant || entry.Path != key.Path)
+				{
+					BON_WLOG_CAT(Assets, "Cache key collision between assets '%s' and '%s'. Asset will not be cached.", entry.Path.c_str(), key.Path);
+					return;
+				}
+
+				auto& prevStats = _GetEngine().Diagnostics()._GetAssetsResidency(entry.Asset->AssetType());
+				prevStats.CachedCount--;
+				prevStats.CachedBytes -= entry.MemorySize;
+				_cachedBytes -= entry.MemorySize;
+				entry.Asset = asset;
+				entry.MemorySize = memorySize;
+				entry.LastAccess = ++_accessCounter;
+			}
+			// new key - add to cache
+			else
+			{
+				CachedAsset& entry = _cache[key.Hash];
+				entry.Asset = asset;
+				entry.Path = key.Path;
+				entry.Variant = key.Variant;
+				entry.MemorySize = memorySize;
+				entry.LastAccess = ++_accessCounter;
+			}
+
+			// update memory counters
+			_cachedBytes += memorySize;
+			stats.CachedCount++;
+			stats.CachedBytes += memorySize;
 		}
 
 		// get from cache
-		AssetPtr Assets::GetFromCache(const char* cacheId)
+		AssetPtr Assets::GetFromCache(const CacheKey& key)
+		{
+			auto found = _cache.find(key.Hash);
+			if (found == _cache.end())
+			{
+				return nullptr;
+			}
+
+			// make sure its not a hash collision (comparing to const char* won't allocate)
+			CachedAsset& entry = found->second;
+			if (entry.Variant != key.Variant || entry.Path != key.Path)
+			{
+				return nullptr;
+			}
+
+			// mark as most recently used
+			entry.LastAccess.store(++_accessCounter, std::memory_order_relaxed);
+			return entry.Asset;
+		}
+
+		// evict unused assets until we fit memory budget
+		bool Assets::EnforceMemoryBudget()
+		{
+			// assets we evict are released only after we leave the cache lock
+			std::vector<AssetPtr> evicted;
+			bool fitsBudget;
+			{
+				std::unique_lock<std::shared_mutex> guard(g_cache_mutex);
+
+				// collect assets that are only held by the cache, and sort them from least recently used
+				std::vector<std::pair<unsigned long long, unsigned long long>> candidates;
+				for (auto& it : _cache)
+				{
+					if (it.second.Asset.use_count() == 1)
+					{
+						candidates.emplace_back(it.second.LastAccess.load(std::memory_order_relaxed), it.first);
+					}
+				}
+				std::sort(candidates.begin(), candidates.end());
+
+				// evict until we fit budget
+				for (auto& candidate : candidates)
+				{
+					if (_cachedBytes <= _memoryBudget)
+					{
+						break;
+					}
+
+					// update counters
+					auto found = _cache.find(candidate.second);
+					CachedAsset& entry = found->second;
+					auto& stats = _GetEngine().Diagnostics()._GetAssetsResidency(entry.Asset->AssetType());
+					stats.CachedCount--;
+					stats.CachedBytes -= entry.MemorySize;
+					stats.Evictions++;
+					stats.EvictedBytes += entry.MemorySize;
+					_cachedBytes -= entry.MemorySize;
+
+					// remove from cache
+					evicted.push_back(std::move(entry.Asset));
+					_cache.erase(found);
+				}
+				fitsBudget = _cachedBytes <= _memoryBudget;
+			}
+
+			BON_DLOG_CAT(Assets, "Evicted %zu assets from cache to fit memory budget. Cached memory: %zu bytes.", evicted.size(), (size_t)_cachedBytes);
+			return fitsBudget;
+		}
+
+		// set memory budget
+		void Assets::SetMemoryBudget(size_t bytes)
+		{
+			BON_DLOG_CAT(Assets, "Set assets memory budget: %zu bytes.", bytes);
+			_memoryBudget = bytes;
+		}
+
+		// get memory budget
+		size_t Assets::MemoryBudget() const
+		{
+			return _memoryBudget;
+		}
+
+		// get cached assets memory size
+		size_t Assets::CachedMemorySize() const
+		{
+			return _cachedBytes;
+		}
+
+		// enable / disable hot reload
+		void Assets::EnableHotReload(bool enable)
+		{
+			BON_DLOG_CAT(Assets, "Set assets hot reload: %d.", enable);
+			std::lock_guard<std::mutex> guard(g_hot_reload_mutex);
+			_hotReload = enable;
+			if (!enable)
+			{
+				_fileWatcher.Clear();
+				_hotReloadAssets.clear();
+				_pendingReloads.clear();
+			}
+		}
+
+		// get if hot reload is enabled
+		bool Assets::HotReloadEnabled() const
 		{
-			return (_cache)[std::move(cacheId)];
+			return _hotReload;
+		}
+
+		// watch asset files for hot reload
+		void Assets::WatchForHotReload(const AssetPtr& asset)
+		{
+			// only some asset types can be reloaded safely
+			// (sounds and music might be playing, fonts textures are cached by font pointer)
+			AssetTypes type = asset->AssetType();
+			if (type != AssetTypes::Image && type != AssetTypes::Config && type != AssetTypes::Effect) 
+			{
+				return;
+			}
+
+			// get files to watch - asset path, and for effects also the shader files
+			std::vector<std::string> paths;
+			paths.push_back(asset->Path());
+			if (type == AssetTypes::Effect)
+			{
+				const _EffectHandle* handle = static_cast<_Effect*>(asset.get())->Handle();
+				if (handle->FragmentShaderPath()) { paths.push_back(handle->FragmentShaderPath()); }
+				if (handle->VertexShaderPath()) { paths.push_back(handle->VertexShaderPath()); }
+			}
+
+			// add to watch list
+			std::lock_guard<std::mutex> guard(g_hot_reload_mutex);
+			for (auto& path : paths)
+			{
+				std::string normalized = FileWatcher::NormalizePath(path);
+				auto& watched = _hotReloadAssets[normalized];
+				bool alreadyWatched = false;
+				for (auto& ptr : watched)
+				{
+					if (ptr.lock() == asset) { alreadyWatched = true; break; }
+				}
+				if (!alreadyWatched)
+				{
+					watched.push_back(asset);
+					_fileWatcher.Watch(normalized);
+				}
+			}
+		}
+
+		// check for changed files and reload their assets
+		void Assets::UpdateHotReload(double deltaTime)
+		{
+			// assets to reload this frame.
+			// we collect them while locked, but reload after releasing lock, since loaders may load other assets.
+			std::vector<AssetPtr> toReload;
+			{
+				std::lock_guard<std::mutex> guard(g_hot_reload_mutex);
+
+				// check for changed files, and (re)start their settle time
+				_timeToNextFilesCheck -= deltaTime;
+				if (_timeToNextFilesCheck <= 0)
+				{
+					_timeToNextFilesCheck = HotReloadCheckInterval;
+					std::vector<std::string> changed;
+					_fileWatcher.Poll(changed);
+					for (auto& path : changed)
+					{
+						_pendingReloads[path] = HotReloadSettleTime;
+					}
+				}
+
+				// nothing to do?
+				if (_pendingReloads.empty())
+				{
+					return;
+				}
+
+				// collect assets of files that are ready, up to max files per frame
+				int filesCount = 0;
+				for (auto it = _pendingReloads.begin(); it != _pendingReloads.end(); )
+				{
+					it->second -= deltaTime;
+					if (it->second > 0 || filesCount >= MaxHotReloadsPerFrame)
+					{
+						++it;
+						continue;
+					}
+					filesCount++;
+
+					// get assets that are still alive
+					auto watched = _hotReloadAssets.find(it->first);
+					if (watched != _hotReloadAssets.end())
+					{
+						auto& list = watched->second;
+						for (auto ptr = list.begin(); ptr != list.end(); )
+						{
+							AssetPtr asset = ptr->lock();
+							if (asset) 
+							{ 
+								if (std::find(toReload.begin(), toReload.end(), asset) == toReload.end()) { toReload.push_back(asset); }
+								++ptr; 
+							}
+							else { ptr = list.erase(ptr); }
+						}
+
+						// no assets left for this file? stop watching it
+						if (list.empty())
+						{
+							_fileWatcher.Unwatch(it->first);
+							_hotReloadAssets.erase(watched);
+						}
+					}
+					it = _pendingReloads.erase(it);
+				}
+			}
+
+			// reload configs first, since other assets (like effects) may be built from them
+			std::stable_sort(toReload.begin(), toReload.end(), [](const AssetPtr& a, const AssetPtr& b) {
+				return (a->AssetType() == AssetTypes::Config) && (b->AssetType() != AssetTypes::Config);
+			});
+			for (auto& asset : toReload)
+			{
+				if (ReloadAsset(asset.get()))
+				{
+					// effects might now use different shader files
+					if (asset->AssetType() == AssetTypes::Effect)
+					{
+						WatchForHotReload(asset);
+					}
+				}
+			}
+		}
+
+		// reload an asset and replace its handle
+		bool Assets::ReloadAsset(IAsset* asset)
+		{
+			// sanity
+			if (!asset->IsValid())
+			{
+				return false;
+			}
+
+			BON_ILOG_CAT(Assets, "Hot reload asset '%s'.", asset->Path());
+			auto handlers = _initializers[(int)asset->AssetType()];
+			if (!handlers.InitializerFunc)
+			{
+				return false;
+			}
+
+			// detach previous handle and load a new one
+			void* prevHandle = asset->_GetHandle();
+			size_t prevMemorySize = asset->MemorySize();
+			asset->_SetHandle(nullptr);
+			try
+			{
+				handlers.InitializerFunc(asset, handlers.Context, nullptr);
+			}
+			catch (std::exception& e)
+			{
+				BON_ELOG_CAT(Assets, "Failed to hot reload asset '%s', keeping previous version. Error: %s", asset->Path(), e.what());
+			}
+
+			// failed to load? restore previous handle
+			if (!asset->IsValid())
+			{
+				if (asset->_GetHandle() != nullptr && handlers.DisposerFunc) { handlers.DisposerFunc(asset, handlers.Context); }
+				asset->_SetHandle(prevHandle);
+				return false;
+			}
+
+			// dispose previous handle (disposers work on the asset, so temporarily put back the previous handle)
+			void* newHandle = asset->_GetHandle();
+			asset->_SetHandle(prevHandle);
+			if (handlers.DisposerFunc) { handlers.DisposerFunc(asset, handlers.Context); }
+			asset->_SetHandle(newHandle);
+			asset->_MarkReloaded();
+
+			// update memory counters
+			size_t memorySize = asset->MemorySize();
+			auto& stats = _GetEngine().Diagnostics()._GetAssetsResidency(asset->AssetType());
+			stats.LoadedBytes += (long long)memorySize - (long long)prevMemorySize;
+			{
+				CacheKey key = MakeCacheKey(asset->Path(), GetCacheVariant(asset));
+				std::unique_lock<std::shared_mutex> guard(g_cache_mutex);
+				auto found = _cache.find(key.Hash);
+				if (found != _cache.end() && found->second.Asset.get() == asset)
+				{
+					_cachedBytes -= found->second.MemorySize;
+					stats.CachedBytes -= found->second.MemorySize;
+					found->second.MemorySize = memorySize;
+					_cachedBytes += memorySize;
+					stats.CachedBytes += memorySize;
+				}
+			}
+			return true;
 		}
 
 		// clear cache
 		void Assets::ClearCache()
 		{
-			BON_DLOG("Clear assets cache.");
-			std::lock_guard<std::mutex> guard(g_cache_mutex);
+			BON_DLOG_CAT(Assets, "Clear assets cache.");
+			std::unique_lock<std::shared_mutex> guard(g_cache_mutex);
+			for (int i = 0; i < (int)AssetTypes::_Count; ++i)
+			{
+				auto& stats = _GetEngine().Diagnostics()._GetAssetsResidency((AssetTypes)i);
+				stats.CachedCount = 0;
+				stats.CachedBytes = 0;
+			}
 			_cache.clear();
+			_cachedBytes = 0;
 		}
 
 		// register initializer to handle asset type
@@ -278,7 +713,7 @@ namespace bon
 		{
 			// log
 			const char* temp = asset->Path();
-			BON_DLOG("Init new asset with path '%s' and address %x.", temp, asset);
+			BON_DLOG_CAT(Assets, "Init new asset with path '%s' and address %x.", temp, asset);
 
 			// should not be, but already initialized? error
 			if (!assetAlreadyValid && asset->IsValid()) {
@@ -301,6 +736,9 @@ namespace bon
 			// update counters
 			_counts[(int)asset->AssetType()]++;
 			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::LoadedAssets, 1);
+			auto& stats = _GetEngine().Diagnostics()._GetAssetsResidency(asset->AssetType());
+			stats.LoadedCount++;
+			stats.LoadedBytes += asset->MemorySize();
 		}
 
 		// save config file
@@ -309,17 +747,47 @@ namespace bon
 			return config->_SaveToFile(filename);
 		}
 
+		// compile config file
+		bool Assets::CompileConfig(ConfigAsset config, const char* filename)
+		{
+			std::string compiledPath = filename ? filename : (std::string(config->Path()) + CompiledConfigSuffix);
+			return CompiledConfigHandle::Compile(*config, compiledPath.c_str());
+		}
+
 		// dispose an asset
 		void Assets::Dispose(IAsset* asset)
 		{
 			// log
-			BON_DLOG("Dispose asset with path '%s' and address %x.", asset->Path(), asset);
+			BON_DLOG_CAT(Assets, "Dispose asset with path '%s' and address %x.", asset->Path(), asset);
 
 			// already disposed? error
 			if (!asset->IsValid()) {
 				throw InvalidState("Asset to dispose is not valid!");
 			}
 
+			// update residency stats (must happen while handle is still valid)
+			auto& stats = _GetEngine().Diagnostics()._GetAssetsResidency(asset->AssetType());
+			stats.LoadedCount--;
+			stats.LoadedBytes -= asset->MemorySize();
+
+			// sanity - if asset is somehow in cache, remove it.
+			// we find it by its cache key, so we need to do it while handle is still valid.
+			const char* path = asset->Path();
+			if (path != nullptr && path[0] != '\0')
+			{
+				CacheKey key = MakeCacheKey(path, GetCacheVariant(asset));
+				std::unique_lock<std::shared_mutex> guard(g_cache_mutex);
+				auto found = _cache.find(key.Hash);
+				if (found != _cache.end() && found->second.Asset.get() == asset)
+				{
+					BON_ELOG_CAT(Assets, "Warning! Disposed asset while its still in cache! Path: '%s', Address: %x.", path, asset);
+					_cachedBytes -= found->second.MemorySize;
+					stats.CachedCount--;
+					stats.CachedBytes -= found->second.MemorySize;
+					_cache.erase(found);
+				}
+			}
+
 			// call custom disposer
 			auto initializerData = _initializers[(int)asset->AssetType()];
 			if (initializerData.DisposerFunc) {
@@ -332,17 +800,6 @@ namespace bon
 
 			// clear handle
 			asset->_SetHandle(nullptr);
-			// sanity - if asset is somehow in cache, remove it
-			for (auto it = _cache.begin(); it != _cache.end(); )
-			{
-				if (it->second.get() == asset) 
-				{ 
-					std::lock_guard<std::mutex> guard(g_cache_mutex);
-					BON_ELOG("Warning! Disposed asset while its still in cache! Path: '%s', Address: %x.", asset->Path(), asset);
-					_cache.erase(it++); 
-				}
-				else { ++it; }
-			}
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include <Assets/CompiledConfig.h>
+#include <Framework/Exceptions.h>
+#include <Framework/PointF.h>
+#include <Framework/RectangleF.h>
+#include <Framework/Color.h>
+#include <BonEngine.h>
+#include <unordered_set>
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+
+
+namespace bon
+{
+	namespace assets
+	{
+		// compiled config magic
+		const char CompiledConfigMagic[4] = { 'B', 'C', 'F', 'G' };
+
+		// max displacement to try when building perfect hash table, before giving up
+		const uint32_t MaxHashDisplacement = 1 << 20;
+
+		// convert char to lower case (ascii only, same as keys in ini reader)
+		inline char ToLowerChar(char c)
+		{
+			return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+		}
+
+		// hash lowercase 'section=name' key without building it
+		inline uint64_t HashKey(const char* section, const char* name, uint64_t seed)
+		{
+			return ConfigKey::Hash(section, name, seed);
+		}
+
+		// load compiled config file
+		CompiledConfigHandle::CompiledConfigHandle(const char* path)
+		{
+			// read file
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file.good())
+			{
+				BON_ELOG_CAT(Assets, "Failed to open compiled config file '%s'.", path);
+				return;
+			}
+			size_t size = (size_t)file.tellg();
+			file.seekg(0);
+			_data.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+			file.read((char*)_data.data(), size);
+
+			// validate header and tables bounds
+			const char* raw = (const char*)_data.data();
+			const CompiledConfigHeader* header = (const CompiledConfigHeader*)raw;
+			if (size < sizeof(CompiledConfigHeader) || memcmp(header->Magic, CompiledConfigMagic, sizeof(CompiledConfigMagic)) != 0)
+			{
+				BON_ELOG_CAT(Assets, "Invalid compiled config file '%s': bad header.", path);
+				return;
+			}
+			if (header->Version != CompiledConfigVersion)
+			{
+				BON_ELOG_CAT(Assets, "Invalid compiled config file '%s': unsupported version %d (expected %d).", path, header->Version, CompiledConfigVersion);
+				return;
+			}
+			if (sizeof(CompiledConfigHeader) + (size_t)header->BucketsCount * sizeof(int32_t) > header->EntriesOffset ||
+				header->EntriesOffset % sizeof(uint64_t) != 0 ||
+				(size_t)header->EntriesOffset + (size_t)header->EntriesCount * sizeof(CompiledConfigEntry) > header->StringsOffset ||
+				(size_t)header->StringsOffset + header->StringsSize > size ||
+				(header->EntriesCount > 0 && (header->BucketsCount == 0 || header->StringsSize == 0 || raw[header->StringsOffset + header->StringsSize - 1] != '\0')))
+			{
+				BON_ELOG_CAT(Assets, "Invalid compiled config file '%s': corrupted tables.", path);
+				return;
+			}
+
+			// set pointers
+			_displacements = (const int32_t*)(raw + sizeof(CompiledConfigHeader));
+			_entries = (const CompiledConfigEntry*)(raw + header->EntriesOffset);
+			_strings = raw + header->StringsOffset;
+
+			// build sections and keys sets
+			for (uint32_t i = 0; i < header->EntriesCount; ++i)
+			{
+				const CompiledConfigEntry& entry = _entries[i];
+				if (entry.KeyOffset >= header->StringsSize || entry.SectionOffset >= header->StringsSize ||
+					entry.NameOffset >= header->StringsSize || entry.ValueOffset >= header->StringsSize)
+				{
+					BON_ELOG_CAT(Assets, "Invalid compiled config file '%s': corrupted entry %d.", path, i);
+					_sections.clear();
+					_keys.clear();
+					return;
+				}
+				_sections.insert(_strings + entry.SectionOffset);
+				_keys[_strings + entry.SectionOffset].insert(_strings + entry.NameOffset);
+			}
+
+			// valid!
+			_header = header;
+		}
+
+		// check if a file is a compiled config
+		bool CompiledConfigHandle::IsCompiledConfig(const char* path)
+		{
+			std::ifstream file(path, std::ios::binary);
+			char magic[sizeof(CompiledConfigMagic)];
+			if (!file.read(magic, sizeof(magic))) { return false; }
+			return memcmp(magic, CompiledConfigMagic, sizeof(CompiledConfigMagic)) == 0;
+		}
+
+		// find entry
+		const CompiledConfigEntry* CompiledConfigHandle::Find(const char* section, const char* name) const
+		{
+			if (_header == nullptr || _header->EntriesCount == 0 || section == nullptr || name == nullptr)
+			{
+				return nullptr;
+			}
+
+			// get bucket displacement and from it the entry slot
+			uint64_t hash = HashKey(section, name, 0);
+			int32_t displacement = _displacements[hash % _header->BucketsCount];
+			uint32_t slot;
+			if (displacement == 0) { return nullptr; }
+			else if (displacement < 0) { slot = (uint32_t)(-displacement - 1); }
+			else { slot = (uint32_t)(HashKey(section, name, (uint64_t)displacement) % _header->EntriesCount); }
+			if (slot >= _header->EntriesCount) { return nullptr; }
+
+			// perfect hash only guarantee no collisions between existing keys, so make sure its really our key
+			const CompiledConfigEntry* entry = &_entries[slot];
+			if (entry->KeyHash != hash || !ConfigKey::Matches(_strings + entry->KeyOffset, section, name))
+			{
+				return nullptr;
+			}
+			return entry;
+		}
+
+		// get string value
+		const char* CompiledConfigHandle::GetStr(const char* section, const char* name, const char* defaultVal) const
+		{
+			const CompiledConfigEntry* entry = Find(section, name);
+			return entry ? _strings + entry->ValueOffset : defaultVal;
+		}
+
+		// get bool value
+		bool CompiledConfigHandle::GetBool(const char* section, const char* name, bool defaultVal) const
+		{
+			const CompiledConfigEntry* entry = Find(section, name);
+			return (entry && (entry->Flags & HasBool)) ? (entry->BoolValue != 0) : defaultVal;
+		}
+
+		// get int value
+		long CompiledConfigHandle::GetInt(const char* section, const char* name, int defaultVal) const
+		{
+			const CompiledConfigEntry* entry = Find(section, name);
+			return (entry && (entry->Flags & HasInt)) ? entry->IntValue : defaultVal;
+		}
+
+		// get float value
+		float CompiledConfigHandle::GetFloat(const char* section, const char* name, float defaultVal) const
+		{
+			const CompiledConfigEntry* entry = Find(section, name);
+			return (entry && (entry->Flags & HasFloat)) ? entry->FloatValue : defaultVal;
+		}
+
+		// get pre-parsed value
+		bool CompiledConfigHandle::_GetParsedValue(const char* section, const char* name, ConfigValueFormat format, float* out) const
+		{
+			const CompiledConfigEntry* entry = Find(section, name);
+			if (!entry) { return false; }
+			switch (format)
+			{
+			case ConfigValueFormat::Point:
+				if (!(entry->Flags & HasPoint)) { return false; }
+				memcpy(out, entry->PointValue, sizeof(entry->PointValue));
+				return true;
+			case ConfigValueFormat::Color:
+				if (!(entry->Flags & HasColor)) { return false; }
+				memcpy(out, entry->ColorValue, sizeof(entry->ColorValue));
+				return true;
+			case ConfigValueFormat::Rectangle:
+				if (!(entry->Flags & HasRectangle)) { return false; }
+				memcpy(out, entry->RectangleValue, sizeof(entry->RectangleValue));
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		// get keys in section
+		const std::set<std::string>& CompiledConfigHandle::Keys(const char* section) const
+		{
+			static const std::set<std::string> empty;
+			auto found = _keys.find(section);
+			return found != _keys.end() ? found->second : empty;
+		}
+
+		// compiled configs are read-only
+		void CompiledConfigHandle::UpdateValue(const char* section, const char* key, const char* value)
+		{
+			throw framework::InvalidState("Can't update values in compiled config files!");
+		}
+
+		// compiled configs are read-only
+		void CompiledConfigHandle::RemoveKey(const char* section, const char* key)
+		{
+			throw framework::InvalidState("Can't remove keys from compiled config files!");
+		}
+
+		// save config as ini
+		bool CompiledConfigHandle::SaveConfig(const char* filename) const
+		{
+			std::ofstream file(filename);
+			if (!file.good()) { return false; }
+			for (auto& section : _sections)
+			{
+				file << "\n[" << section << "]\n";
+				for (auto& key : Keys(section.c_str()))
+				{
+					file << key << " = " << GetStr(section.c_str(), key.c_str(), "") << "\n";
+				}
+			}
+			return file.good();
+		}
+
+		// compile config into compiled config file
+		bool CompiledConfigHandle::Compile(const _Config& config, const char* filename)
+		{
+			// a single value to compile
+			struct SourceEntry
+			{
+				std::string Key;
+				std::string Section;
+				std::string Name;
+				std::string Value;
+				CompiledConfigEntry Entry;
+			};
+
+			// collect entries and pre-parse values.
+			// we parse using the config getters, so compiled values will behave exactly like the source config.
+			std::vector<SourceEntry> sources;
+			std::unordered_set<std::string> addedKeys;
+			for (auto& section : config.Sections())
+			{
+				const char* sectionStr = section.c_str();
+				for (auto& name : config.Keys(sectionStr))
+				{
+					const char* nameStr = name.c_str();
+					const char* value = config.GetStr(sectionStr, nameStr, nullptr);
+					if (value == nullptr) { continue; }
+
+					// keys are case insensitive
+					SourceEntry source;
+					source.Key = section + "=" + name;
+					std::transform(source.Key.begin(), source.Key.end(), source.Key.begin(), ToLowerChar);
+					if (!addedKeys.insert(source.Key).second) { continue; }
+					source.Section = section;
+					source.Name = name;
+					source.Value = value;
+
+					// pre-parse values (getters with two different defaults tell us if value parsed or not)
+					CompiledConfigEntry& entry = source.Entry;
+					memset(&entry, 0, sizeof(entry));
+					entry.KeyHash = HashKey(sectionStr, nameStr, 0);
+					long asInt = config.GetInt(sectionStr, nameStr, 0);
+					if (asInt == config.GetInt(sectionStr, nameStr, 1)) { entry.Flags |= HasInt; entry.IntValue = (int32_t)asInt; }
+					float asFloat = config.GetFloat(sectionStr, nameStr, 0.0f);
+					if (asFloat == config.GetFloat(sectionStr, nameStr, 1.0f)) { entry.Flags |= HasFloat; entry.FloatValue = asFloat; }
+					bool asBool = config.GetBool(sectionStr, nameStr, false);
+					if (asBool == config.GetBool(sectionStr, nameStr, true)) { entry.Flags |= HasBool; entry.BoolValue = asBool ? 1 : 0; }
+					size_t partsCount = std::count(source.Value.begin(), source.Value.end(), ',') + 1;
+					try
+					{
+						framework::PointF point = config.GetPointF(sectionStr, nameStr, framework::PointF::Zero);
+						entry.PointValue[0] = point.X; entry.PointValue[1] = point.Y;
+						entry.Flags |= HasPoint;
+					}
+					catch (const std::exception&) {}
+					if (partsCount >= 3)
+					{
+						try
+						{
+							framework::Color color = config.GetColor(sectionStr, nameStr, framework::Color::White);
+							entry.ColorValue[0] = color.R; entry.ColorValue[1] = color.G; entry.ColorValue[2] = color.B; entry.ColorValue[3] = color.A;
+							entry.Flags |= HasColor;
+						}
+						catch (const std::exception&) {}
+					}
+					if (partsCount >= 4)
+					{
+						try
+						{
+							framework::RectangleF rect = config.GetRectangleF(sectionStr, nameStr, framework::RectangleF::Zero);
+							entry.RectangleValue[0] = rect.X; entry.RectangleValue[1] = rect.Y; entry.RectangleValue[2] = rect.Width; entry.RectangleValue[3] = rect.Height;
+							entry.Flags |= HasRectangle;
+						}
+						catch (const std::exception&) {}
+					}
+					sources.push_back(std::move(source));
+				}
+			}
+
+			// build perfect hash table (hash and displace):
+			// keys are grouped into buckets by their hash, and for every bucket we find a hash seed that puts all its keys in free slots.
+			uint32_t count = (uint32_t)sources.size();
+			uint32_t bucketsCount = count > 0 ? count : 1;
+			std::vector<std::vector<uint32_t>> buckets(bucketsCount);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				buckets[sources[i].Entry.KeyHash % bucketsCount].push_back(i);
+			}
+			std::vector<uint32_t> bucketsOrder(bucketsCount);
+			for (uint32_t i = 0; i < bucketsCount; ++i) { bucketsOrder[i] = i; }
+			std::stable_sort(bucketsOrder.begin(), bucketsOrder.end(), [&buckets](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+			std::vector<int32_t> displacements(bucketsCount, 0);
+			std::vector<int32_t> slots(count, -1);
+			std::vector<uint32_t> bucketSlots;
+			uint32_t nextFreeSlot = 0;
+			for (uint32_t bucketIndex : bucketsOrder)
+			{
+				auto& bucket = buckets[bucketIndex];
+				if (bucket.empty()) { break; }
+
+				// single key buckets go directly to a free slot
+				if (bucket.size() == 1)
+				{
+					while (slots[nextFreeSlot] != -1) { nextFreeSlot++; }
+					slots[nextFreeSlot] = (int32_t)bucket[0];
+					displacements[bucketIndex] = -(int32_t)nextFreeSlot - 1;
+					continue;
+				}
+
+				// find displacement that puts all keys in free and different slots
+				bool found = false;
+				for (uint32_t displacement = 1; displacement < MaxHashDisplacement && !found; ++displacement)
+				{
+					bucketSlots.clear();
+					found = true;
+					for (uint32_t sourceIndex : bucket)
+					{
+						auto& source = sources[sourceIndex];
+						uint32_t slot = (uint32_t)(HashKey(source.Section.c_str(), source.Name.c_str(), displacement) % count);
+						if (slots[slot] != -1 || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+						{
+							found = false;
+							break;
+						}
+						bucketSlots.push_back(slot);
+					}
+					if (found)
+					{
+						for (size_t i = 0; i < bucket.size(); ++i) { slots[bucketSlots[i]] = (int32_t)bucket[i]; }
+						displacements[bucketIndex] = (int32_t)displacement;
+					}
+				}
+				if (!found)
+				{
+					BON_ELOG_CAT(Assets, "Failed to build perfect hash table for compiled config '%s'.", filename);
+					return false;
+				}
+			}
+
+			// build strings block and entries table
+			std::string strings;
+			auto addString = [&strings](const std::string& str) {
+				uint32_t offset = (uint32_t)strings.size();
+				strings.append(str);
+				strings.push_back('\0');
+				return offset;
+			};
+			std::vector<CompiledConfigEntry> entries(count);
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				auto& source = sources[slots[slot]];
+				source.Entry.KeyOffset = addString(source.Key);
+				source.Entry.SectionOffset = addString(source.Section);
+				source.Entry.NameOffset = addString(source.Name);
+				source.Entry.ValueOffset = addString(source.Value);
+				entries[slot] = source.Entry;
+			}
+
+			// build header
+			CompiledConfigHeader header;
+			memset(&header, 0, sizeof(header));
+			memcpy(header.Magic, CompiledConfigMagic, sizeof(CompiledConfigMagic));
+			header.Version = CompiledConfigVersion;
+			header.EntriesCount = count;
+			header.BucketsCount = bucketsCount;
+			uint32_t displacementsEnd = (uint32_t)(sizeof(CompiledConfigHeader) + bucketsCount * sizeof(int32_t));
+			header.EntriesOffset = (displacementsEnd + 7) & ~7u;
+			header.StringsOffset = header.EntriesOffset + count * (uint32_t)sizeof(CompiledConfigEntry);
+			header.StringsSize = (uint32_t)strings.size();
+
+			// write file
+			std::ofstream file(filename, std::ios::binary);
+			if (!file.good())
+			{
+				BON_ELOG_CAT(Assets, "Failed to open '%s' for writing compiled config.", filename);
+				return false;
+			}
+			const char padding[8] = { 0 };
+			file.write((const char*)&header, sizeof(header));
+			file.write((const char*)displacements.data(), displacements.size() * sizeof(int32_t));
+			file.write(padding, header.EntriesOffset - displacementsEnd);
+			file.write((const char*)entries.data(), entries.size() * sizeof(CompiledConfigEntry));
+			file.write(strings.data(), strings.size());
+			BON_DLOG_CAT(Assets, "Compiled config '%s' with %d entries.", filename, count);
+			return file.good();
+		}
+	}
+}
@@ -3,6 +3,8 @@
 #include <Framework/Exceptions.h>
 #include <string>
 #include <list>
+#include <cstring>
+#include <algorithm>
 using namespace bon::framework;
 
 namespace bon
@@ -38,22 +40,206 @@ namespace bon
 			outList.push_back(s.substr(last));
 		}
 
-		// get pointf from config
-		framework::PointF _Config::GetPointF(const char* section, const char* name, const framework::PointF& defaultVal) const
+		// convert char to lower case (ascii only, same as keys in ini reader)
+		inline char ToLowerChar(char c)
+		{
+			return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+		}
+
+		// add lowercase chars to FNV-1a hash
+		inline uint64_t HashChars(uint64_t hash, const char* str)
+		{
+			for (const char* c = str; *c != '\0'; ++c)
+			{
+				hash ^= (unsigned char)ToLowerChar(*c);
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		// flags of which typed values were converted in cache
+		enum CachedValueFlags : unsigned int
+		{
+			CachedInt = 1 << 0,
+			CachedFloat = 1 << 1,
+			CachedBool = 1 << 2,
+			CachedPoint = 1 << 3,
+			CachedColor = 1 << 4,
+			CachedRectangle = 1 << 5,
+		};
+
+		// hash lowercase 'section=name' key without building it
+		uint64_t ConfigKey::Hash(const char* section, const char* name, uint64_t seed)
+		{
+			uint64_t hash = HashChars(14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL), section);
+			hash ^= (unsigned char)'=';
+			hash *= 1099511628211ULL;
+			return HashChars(hash, name);
+		}
+
+		// compare lowercase key to section and name
+		bool ConfigKey::Matches(const char* key, const char* section, const char* name)
+		{
+			for (; *section != '\0'; ++section, ++key)
+			{
+				if (*key != ToLowerChar(*section)) { return false; }
+			}
+			if (*key++ != '=') { return false; }
+			for (; *name != '\0'; ++name, ++key)
+			{
+				if (*key != ToLowerChar(*name)) { return false; }
+			}
+			return *key == '\0';
+		}
+
+		// set handle and clear values cache
+		void _Config::_SetHandle(void* handle)
+		{
+			ClearCache();
+			IAsset::_SetHandle(handle);
+		}
+
+		// clear values cache
+		void _Config::ClearCache()
+		{
+			std::unique_lock<std::shared_mutex> guard(_cacheMutex);
+			_cache.clear();
+			_sectionsIndex.clear();
+			_sectionsIndexed = false;
+		}
+
+		// get cached value
+		const _Config::CachedValue* _Config::FindCached(const char* section, const char* name, uint64_t hash) const
+		{
+			auto found = _cache.find(hash);
+			if (found == _cache.end()) { return nullptr; }
+			return ConfigKey::Matches(found->second.Key.c_str(), section, name) ? &found->second : nullptr;
+		}
+
+		// get cached value, or add it to cache
+		_Config::CachedValue* _Config::GetCached(const char* section, const char* name, uint64_t hash) const
+		{
+			// find in cache
+			auto found = _cache.find(hash);
+			if (found != _cache.end())
+			{
+				return ConfigKey::Matches(found->second.Key.c_str(), section, name) ? &found->second : nullptr;
+			}
+
+			// not found? add to cache, but only if key exists (so lookups of missing keys won't grow cache)
+			const char* str = Handle()->GetStr(section, name, nullptr);
+			if (str == nullptr) { return nullptr; }
+			CachedValue& value = _cache[hash];
+			value.Key = std::string(section) + "=" + name;
+			std::transform(value.Key.begin(), value.Key.end(), value.Key.begin(), ToLowerChar);
+			value.Str = str;
+			return &value;
+		}
+
+		// read cached value, and convert it first if needed
+		template <typename Convert, typename Read>
+		bool _Config::ReadCached(const char* section, const char* name, uint64_t hash, unsigned int flag, Convert convert, Read read) const
+		{
+			// already cached and converted? read under shared lock
+			{
+				std::shared_lock<std::shared_mutex> guard(_cacheMutex);
+				const CachedValue* cached = FindCached(section, name, hash);
+				if (cached != nullptr && (cached->Converted & flag) == flag)
+				{
+					read(*cached);
+					return true;
+				}
+			}
+
+			// add to cache and / or convert under exclusive lock.
+			// note: if converting throws, nothing is marked as converted and next call will throw again
+			std::unique_lock<std::shared_mutex> guard(_cacheMutex);
+			CachedValue* cached = GetCached(section, name, hash);
+			if (cached == nullptr) { return false; }
+			if ((cached->Converted & flag) != flag)
+			{
+				convert(*cached);
+				cached->Converted |= flag;
+			}
+			read(*cached);
+			return true;
+		}
+
+		// get string from config
+		const char* _Config::GetStr(const char* section, const char* name, uint64_t hash, const char* defaultVal) const
+		{
+			const char* ret = defaultVal;
+			if (ReadCached(section, name, hash, 0, 
+				[](CachedValue&) {}, 
+				[&](const CachedValue& value) { ret = value.Str; })) { return ret; }
+			return Handle()->GetStr(section, name, defaultVal);
+		}
+
+		// get bool from config
+		bool _Config::GetBool(const char* section, const char* name, uint64_t hash, bool defaultVal) const
+		{
+			bool ret = defaultVal;
+			if (ReadCached(section, name, hash, CachedBool,
+				[&](CachedValue& value) {
+					// get with two different defaults, to know if value is valid without depending on caller's default
+					value.Bool = Handle()->GetBool(section, name, false);
+					if (value.Bool || !Handle()->GetBool(section, name, true)) { value.Valid |= CachedBool; }
+				},
+				[&](const CachedValue& value) { if (value.Valid & CachedBool) { ret = value.Bool; } })) { return ret; }
+			return Handle()->GetBool(section, name, defaultVal);
+		}
+
+		// get int from config
+		long _Config::GetInt(const char* section, const char* name, uint64_t hash, int defaultVal) const
+		{
+			long ret = defaultVal;
+			if (ReadCached(section, name, hash, CachedInt,
+				[&](CachedValue& value) {
+					value.Int = Handle()->GetInt(section, name, 0);
+					if (value.Int != 0 || Handle()->GetInt(section, name, 1) == 0) { value.Valid |= CachedInt; }
+				},
+				[&](const CachedValue& value) { if (value.Valid & CachedInt) { ret = value.Int; } })) { return ret; }
+			return Handle()->GetInt(section, name, defaultVal);
+		}
+
+		// get float from config
+		float _Config::GetFloat(const char* section, const char* name, uint64_t hash, float defaultVal) const
+		{
+			float ret = defaultVal;
+			if (ReadCached(section, name, hash, CachedFloat,
+				[&](CachedValue& value) {
+					value.Float = Handle()->GetFloat(section, name, 0.0f);
+					if (value.Float != 0.0f || Handle()->GetFloat(section, name, 1.0f) == 0.0f) { value.Valid |= CachedFloat; }
+				},
+				[&](const CachedValue& value) { if (value.Valid & CachedFloat) { ret = value.Float; } })) { return ret; }
+			return Handle()->GetFloat(section, name, defaultVal);
+		}
+
+		// parse point from config value
+		framework::PointF ParsePoint(const _ConfigHandle* handle, const char* section, const char* name, const char* asStr)
 		{
+			// try to get pre-parsed value
+			float parsed[2];
+			if (handle->_GetParsedValue(section, name, ConfigValueFormat::Point, parsed)) 
+			{ 
+				return PointF(parsed[0], parsed[1]); 
+			}
+
+			// parse from string
 			PointF ret;
-			const char* asStr = GetStr(section, name, nullptr);
-			if (asStr == nullptr) { return defaultVal; }
 			SplitPointStr(asStr, ret.X, ret.Y);
 			return ret;
 		}
 
-		// get color from config
-		framework::Color _Config::GetColor(const char* section, const char* name, const framework::Color& defaultVal) const
+		// parse color from config value
+		framework::Color ParseColor(const _ConfigHandle* handle, const char* section, const char* name, const char* asStr)
 		{
-			// get string and return default if not set
-			const char* asStr = GetStr(section, name, nullptr);
-			if (asStr == nullptr) { return defaultVal; }
+			// try to get pre-parsed value
+			float parsed[4];
+			if (handle->_GetParsedValue(section, name, ConfigValueFormat::Color, parsed))
+			{
+				return Color(parsed[0], parsed[1], parsed[2], parsed[3]);
+			}
 
 			// break and parse
 			std::list<std::string> parts;
@@ -67,12 +253,15 @@ namespace bon
 			return ret;
 		}
 
-		// get rect from config
-		framework::RectangleF _Config::GetRectangleF(const char* section, const char* name, const framework::RectangleF& defaultVal) const
+		// parse rectangle from config value
+		framework::RectangleF ParseRectangle(const _ConfigHandle* handle, const char* section, const char* name, const char* asStr)
 		{
-			// get string and return default if not set
-			const char* asStr = GetStr(section, name, nullptr);
-			if (asStr == nullptr) { return defaultVal; }
+			// try to get pre-parsed value
+			float parsed[4];
+			if (handle->_GetParsedValue(section, name, ConfigValueFormat::Rectangle, parsed))
+			{
+				return framework::RectangleF(parsed[0], parsed[1], parsed[2], parsed[3]);
+			}
 
 			// break and parse
 			std::list<std::string> parts;
@@ -86,6 +275,39 @@ namespace bon
 			return ret;
 		}
 
+		// get pointf from config
+		framework::PointF _Config::GetPointF(const char* section, const char* name, uint64_t hash, const framework::PointF& defaultVal) const
+		{
+			framework::PointF ret;
+			if (ReadCached(section, name, hash, CachedPoint,
+				[&](CachedValue& value) { value.Point = ParsePoint(Handle(), section, name, value.Str); },
+				[&](const CachedValue& value) { ret = value.Point; })) { return ret; }
+			const char* asStr = Handle()->GetStr(section, name, nullptr);
+			return asStr ? ParsePoint(Handle(), section, name, asStr) : defaultVal;
+		}
+
+		// get color from config
+		framework::Color _Config::GetColor(const char* section, const char* name, uint64_t hash, const framework::Color& defaultVal) const
+		{
+			framework::Color ret;
+			if (ReadCached(section, name, hash, CachedColor,
+				[&](CachedValue& value) { value.Color = ParseColor(Handle(), section, name, value.Str); },
+				[&](const CachedValue& value) { ret = value.Color; })) { return ret; }
+			const char* asStr = Handle()->GetStr(section, name, nullptr);
+			return asStr ? ParseColor(Handle(), section, name, asStr) : defaultVal;
+		}
+
+		// get rect from config
+		framework::RectangleF _Config::GetRectangleF(const char* section, const char* name, uint64_t hash, const framework::RectangleF& defaultVal) const
+		{
+			framework::RectangleF ret;
+			if (ReadCached(section, name, hash, CachedRectangle,
+				[&](CachedValue& value) { value.Rectangle = ParseRectangle(Handle(), section, name, value.Str); },
+				[&](const CachedValue& value) { ret = value.Rectangle; })) { return ret; }
+			const char* asStr = Handle()->GetStr(section, name, nullptr);
+			return asStr ? ParseRectangle(Handle(), section, name, asStr) : defaultVal;
+		}
+
 		// get option index from config
 		int _Config::GetOption(const char* section, const char* name, const char* options[], int optionsCount, int defaultVal) const
 		{
@@ -108,8 +330,36 @@ namespace bon
 		// return if a section exists
 		bool _Config::Exists(const char* section) const
 		{
-			auto sections = Sections();
-			return sections.find(section) != sections.end();
+			// find section by its hash, without allocating a string for the section name.
+			// section hash is the key hash with an empty name, and like section names its case insensitive
+			uint64_t hash = ConfigKey::Hash(section, "");
+			auto findInIndex = [this, hash, section]()
+			{
+				auto range = _sectionsIndex.equal_range(hash);
+				for (auto it = range.first; it != range.second; ++it)
+				{
+					if (strcmp(it->second->c_str(), section) == 0) { return true; }
+				}
+				return false;
+			};
+
+			// index already built? search under shared lock
+			{
+				std::shared_lock<std::shared_mutex> guard(_cacheMutex);
+				if (_sectionsIndexed) { return findInIndex(); }
+			}
+
+			// build sections index on first lookup
+			std::unique_lock<std::shared_mutex> guard(_cacheMutex);
+			if (!_sectionsIndexed)
+			{
+				for (const auto& curr : Sections())
+				{
+					_sectionsIndex.emplace(ConfigKey::Hash(curr.c_str(), ""), &curr);
+				}
+				_sectionsIndexed = true;
+			}
+			return findInIndex();
 		}
 
 		// return if a key exists under a given section
@@ -117,5 +367,11 @@ namespace bon
 		{
 			return GetStr(section, key, NULL) != NULL;
 		}
+
+		// return if a key exists
+		bool _Config::Exists(const ConfigKey& key) const
+		{
+			return GetStr(key, NULL) != NULL;
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <Assets/FileWatcher.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#endif
+
+
+namespace bon
+{
+	namespace assets
+	{
+		// create the file watcher
+		FileWatcher::FileWatcher()
+		{
+#if defined(__linux__)
+			_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if (_inotifyFd < 0)
+			{
+				BON_WLOG_CAT(Assets, "Failed to init inotify (errno = %d), fallback to polling files for hot reload.", errno);
+			}
+#endif
+		}
+
+		// destroy the file watcher
+		FileWatcher::~FileWatcher()
+		{
+			Clear();
+#if defined(__linux__)
+			if (_inotifyFd >= 0)
+			{
+				close(_inotifyFd);
+				_inotifyFd = -1;
+			}
+#endif
+		}
+
+		// get file last modification time
+		std::filesystem::file_time_type FileWatcher::GetModifyTime(const std::string& path)
+		{
+			std::error_code error;
+			auto ret = std::filesystem::last_write_time(path, error);
+			return error ? std::filesystem::file_time_type() : ret;
+		}
+
+		// check if file modification time changed
+		bool FileWatcher::CheckModifyTime(const std::string& path, std::filesystem::file_time_type& lastModifyTime)
+		{
+			auto modifyTime = GetModifyTime(path);
+			if (modifyTime == lastModifyTime) {
+				return false;
+			}
+			lastModifyTime = modifyTime;
+			return true;
+		}
+
+		// normalize file path
+		std::string FileWatcher::NormalizePath(const std::string& path)
+		{
+			return std::filesystem::path(path).lexically_normal().generic_string();
+		}
+
+		// start watching a file
+		void FileWatcher::Watch(const std::string& path)
+		{
+			// normalize path so it will match the paths we build from inotify events
+			std::string normalized = NormalizePath(path);
+			if (_files.find(normalized) != _files.end())
+			{
+				return;
+			}
+			_files[normalized] = GetModifyTime(normalized);
+
+#if defined(__linux__)
+			// watch parent folder rather than the file itself, since many editors save by replacing the file
+			if (_inotifyFd >= 0)
+			{
+				std::string folder = std::filesystem::path(normalized).parent_path().generic_string();
+				if (folder.empty()) { folder = "."; }
+				if (_foldersWatch.find(folder) == _foldersWatch.end() && _pollFolders.find(folder) == _pollFolders.end())
+				{
+					int wd = inotify_add_watch(_inotifyFd, folder.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+					if (wd >= 0)
+					{
+						_folders[wd] = folder;
+						_foldersWatch[folder] = wd;
+					}
+					else
+					{
+						// can't watch this folder (for example, reached inotify watches limit) - poll its files instead
+						BON_WLOG_CAT(Assets, "Failed to watch folder '%s' for changes (errno = %d), fallback to polling its files.", folder.c_str(), errno);
+						_pollFolders.insert(folder);
+					}
+				}
+				if (_pollFolders.find(folder) != _pollFolders.end())
+				{
+					_pollFiles.insert(normalized);
+				}
+			}
+#endif
+		}
+
+		// stop watching a file
+		void FileWatcher::Unwatch(const std::string& path)
+		{
+			// note: we keep watching the folder, its cheap and other files in it are likely to be watched again
+			std::string normalized = NormalizePath(path);
+			_files.erase(normalized);
+#if defined(__linux__)
+			_pollFiles.erase(normalized);
+#endif
+		}
+
+		// stop watching all files
+		void FileWatcher::Clear()
+		{
+			_files.clear();
+#if defined(__linux__)
+			if (_inotifyFd >= 0)
+			{
+				for (auto& folder : _folders)
+				{
+					inotify_rm_watch(_inotifyFd, folder.first);
+				}
+			}
+			_folders.clear();
+			_foldersWatch.clear();
+			_pollFolders.clear();
+			_pollFiles.clear();
+#endif
+		}
+
+		// check for changed files
+		void FileWatcher::Poll(std::vector<std::string>& outChanged)
+		{
+#if defined(__linux__)
+			if (_inotifyFd >= 0)
+			{
+				// read all pending events (fd is non blocking, so read returns -1 when there's nothing left)
+				alignas(struct inotify_event) char buffer[4096];
+				ssize_t length;
+				while ((length = read(_inotifyFd, buffer, sizeof(buffer))) > 0)
+				{
+					for (char* ptr = buffer; ptr < buffer + length; )
+					{
+						const struct inotify_event* event = (const struct inotify_event*)ptr;
+						ptr += sizeof(struct inotify_event) + event->len;
+
+						// get full path and check if its a file we care about
+						auto folder = _folders.find(event->wd);
+						if (folder == _folders.end() || event->len == 0) { continue; }
+						std::string path = (folder->second == ".") ?
+							std::string(event->name) :
+							(std::filesystem::path(folder->second) / event->name).generic_string();
+						if (_files.find(path) != _files.end() && _pollFiles.find(path) == _pollFiles.end())
+						{
+							outChanged.push_back(path);
+						}
+					}
+				}
+
+				// poll files in folders we failed to watch
+				for (auto& path : _pollFiles)
+				{
+					auto file = _files.find(path);
+					if (file != _files.end() && CheckModifyTime(file->first, file->second))
+					{
+						outChanged.push_back(file->first);
+					}
+				}
+				return;
+			}
+#endif
+
+			// polling fallback - compare modification time of all watched files
+			for (auto& file : _files)
+			{
+				if (CheckModifyTime(file.first, file.second))
+				{
+					outChanged.push_back(file.first);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,332 @@
+#include <Diagnostics/AllocationTracker.h>
+#include <Framework/Exceptions.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <SDL2-2.0.12/include/SDL.h>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+
+
+namespace bon
+{
+	namespace diagnostics
+	{
+		// allocations of a single thread.
+		// must remain trivial, so creating it for a new thread won't allocate.
+		struct ThreadAllocations
+		{
+			uint64_t Allocations;
+			uint64_t Frees;
+			uint64_t Bytes;
+			const char* Tag;
+			int NoAllocationsDepth;
+			uint64_t NoAllocationsStart;
+			const char* FirstNoAllocationsTag;
+		};
+
+		// current thread's allocations
+		thread_local ThreadAllocations _threadAllocations;
+
+		// allocations of all threads
+		static std::atomic<uint64_t> _totalAllocations{ 0 };
+		static std::atomic<uint64_t> _totalFrees{ 0 };
+		static std::atomic<uint64_t> _totalBytes{ 0 };
+
+		// allocations per tag, in open addressing table keyed by tag pointer
+		struct AllocationTagEntry
+		{
+			std::atomic<const char*> Tag;
+			std::atomic<uint64_t> Allocations;
+			std::atomic<uint64_t> Bytes;
+		};
+		static AllocationTagEntry _tags[AllocationTracker::MaxTags];
+
+		// tag used for allocations outside any tagged scope
+		static const char* const UntaggedAllocations = "untagged";
+
+		// is tracker currently enabled
+		std::atomic<bool> AllocationTracker::_enabled{ false };
+
+		// add allocation to its tag entry
+		static void RecordTag(const char* tag, size_t size)
+		{
+			size_t index = (size_t)(((uintptr_t)tag >> 3) * 2654435761u) % AllocationTracker::MaxTags;
+			for (int probe = 0; probe < AllocationTracker::MaxTags; ++probe)
+			{
+				AllocationTagEntry& entry = _tags[(index + probe) % AllocationTracker::MaxTags];
+				const char* current = entry.Tag.load(std::memory_order_acquire);
+				if (current == nullptr)
+				{
+					entry.Tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel);
+					if (current == nullptr) { current = tag; }
+				}
+				if (current == tag)
+				{
+					entry.Allocations.fetch_add(1, std::memory_order_relaxed);
+					entry.Bytes.fetch_add(size, std::memory_order_relaxed);
+					return;
+				}
+			}
+		}
+
+		// get if hooks were compiled in
+		bool AllocationTracker::IsAvailable()
+		{
+#ifndef BON_DISABLE_ALLOCATION_TRACKER
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		// enable / disable tracker
+		void AllocationTracker::Enable(bool enable)
+		{
+			if (enable && !IsAvailable())
+			{
+				BON_WLOG("Can't enable allocation tracker, engine was compiled with BON_DISABLE_ALLOCATION_TRACKER.");
+				return;
+			}
+			_enabled.store(enable);
+			BON_DLOG("Allocation tracker %s.", enable ? "enabled" : "disabled");
+		}
+
+		// get all threads totals
+		AllocationStats AllocationTracker::GetTotals()
+		{
+			AllocationStats ret;
+			ret.Allocations = _totalAllocations.load(std::memory_order_relaxed);
+			ret.Frees = _totalFrees.load(std::memory_order_relaxed);
+			ret.Bytes = _totalBytes.load(std::memory_order_relaxed);
+			return ret;
+		}
+
+		// get current thread totals
+		AllocationStats AllocationTracker::GetThreadTotals()
+		{
+			AllocationStats ret;
+			ret.Allocations = _threadAllocations.Allocations;
+			ret.Frees = _threadAllocations.Frees;
+			ret.Bytes = _threadAllocations.Bytes;
+			return ret;
+		}
+
+		// get allocations per tag
+		int AllocationTracker::GetTags(AllocationTagStats* out, int maxCount)
+		{
+			int count = 0;
+			for (int i = 0; i < MaxTags && count < maxCount; ++i)
+			{
+				const char* tag = _tags[i].Tag.load(std::memory_order_acquire);
+				if (tag == nullptr) { continue; }
+				out[count].Tag = tag;
+				out[count].Allocations = _tags[i].Allocations.load(std::memory_order_relaxed);
+				out[count].Bytes = _tags[i].Bytes.load(std::memory_order_relaxed);
+				count++;
+			}
+			return count;
+		}
+
+		// write allocations per tag to csv
+		bool AllocationTracker::DumpTags(const char* filename)
+		{
+			std::ofstream file(filename, std::ios::trunc);
+			if (!file.is_open())
+			{
+				BON_WLOG("Failed to open allocation tags file '%s'.", filename);
+				return false;
+			}
+
+			// get tags, biggest allocators first
+			std::vector<AllocationTagStats> tags(MaxTags);
+			tags.resize(GetTags(tags.data(), MaxTags));
+			std::sort(tags.begin(), tags.end(), [](const AllocationTagStats& a, const AllocationTagStats& b) { return a.Allocations > b.Allocations; });
+
+			// write them
+			file << "tag,allocations,bytes\n";
+			for (auto& tag : tags)
+			{
+				file << "\"" << tag.Tag << "\"," << tag.Allocations << "," << tag.Bytes << "\n";
+			}
+			return file.good();
+		}
+
+		// start zero-allocations region
+		void AllocationTracker::BeginNoAllocations()
+		{
+			if (!IsEnabled())
+			{
+				throw framework::InvalidState("Allocation tracker must be enabled to use zero-allocations regions!");
+			}
+			if (_threadAllocations.NoAllocationsDepth++ == 0)
+			{
+				_threadAllocations.NoAllocationsStart = _threadAllocations.Allocations;
+				_threadAllocations.FirstNoAllocationsTag = nullptr;
+			}
+		}
+
+		// end zero-allocations region
+		uint64_t AllocationTracker::EndNoAllocations(bool throwIfAllocated)
+		{
+			if (_threadAllocations.NoAllocationsDepth == 0)
+			{
+				throw framework::InvalidState("Called EndNoAllocations() without matching BeginNoAllocations()!");
+			}
+			uint64_t allocations = _threadAllocations.Allocations - _threadAllocations.NoAllocationsStart;
+			if (--_threadAllocations.NoAllocationsDepth == 0 && allocations > 0 && throwIfAllocated)
+			{
+				const char* tag = _threadAllocations.FirstNoAllocationsTag;
+				BON_ELOG("%d allocations were made in zero-allocations region! First allocation tag: '%s'.", (int)allocations, tag ? tag : UntaggedAllocations);
+				throw framework::InvalidState("Allocations were made in zero-allocations region!");
+			}
+			return allocations;
+		}
+
+		// set current thread's tag
+		const char* AllocationTracker::_SetTag(const char* tag)
+		{
+			const char* prev = _threadAllocations.Tag;
+			_threadAllocations.Tag = tag;
+			return prev;
+		}
+
+		// report allocation
+		void AllocationTracker::_OnAllocate(size_t size)
+		{
+			if (!IsEnabled()) { return; }
+
+			// count in thread and totals
+			ThreadAllocations& thread = _threadAllocations;
+			thread.Allocations++;
+			thread.Bytes += size;
+			_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+			_totalBytes.fetch_add(size, std::memory_order_relaxed);
+
+			// remember first allocation in zero-allocations region
+			if (thread.NoAllocationsDepth > 0 && thread.FirstNoAllocationsTag == nullptr)
+			{
+				thread.FirstNoAllocationsTag = thread.Tag ? thread.Tag : UntaggedAllocations;
+			}
+
+			// attribute to tag
+#ifdef _DEBUG
+			RecordTag(thread.Tag ? thread.Tag : UntaggedAllocations, size);
+#endif
+		}
+
+		// report free
+		void AllocationTracker::_OnFree()
+		{
+			if (!IsEnabled()) { return; }
+			_threadAllocations.Frees++;
+			_totalFrees.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// original SDL memory functions
+		static SDL_malloc_func _sdlMalloc = nullptr;
+		static SDL_calloc_func _sdlCalloc = nullptr;
+		static SDL_realloc_func _sdlRealloc = nullptr;
+		static SDL_free_func _sdlFree = nullptr;
+
+		// SDL memory hooks
+		static void* SDLCALL TrackedSdlMalloc(size_t size)
+		{
+			AllocationTracker::_OnAllocate(size);
+			return _sdlMalloc(size);
+		}
+		static void* SDLCALL TrackedSdlCalloc(size_t nmemb, size_t size)
+		{
+			AllocationTracker::_OnAllocate(nmemb * size);
+			return _sdlCalloc(nmemb, size);
+		}
+		static void* SDLCALL TrackedSdlRealloc(void* mem, size_t size)
+		{
+			if (mem) { AllocationTracker::_OnFree(); }
+			AllocationTracker::_OnAllocate(size);
+			return _sdlRealloc(mem, size);
+		}
+		static void SDLCALL TrackedSdlFree(void* mem)
+		{
+			if (mem) { AllocationTracker::_OnFree(); }
+			_sdlFree(mem);
+		}
+
+		// hook SDL memory functions
+		void AllocationTracker::_InstallSdlHooks()
+		{
+#ifndef BON_DISABLE_ALLOCATION_TRACKER
+			if (_sdlMalloc != nullptr) { return; }
+			SDL_GetMemoryFunctions(&_sdlMalloc, &_sdlCalloc, &_sdlRealloc, &_sdlFree);
+			if (SDL_SetMemoryFunctions(TrackedSdlMalloc, TrackedSdlCalloc, TrackedSdlRealloc, TrackedSdlFree) != 0)
+			{
+				_sdlMalloc = nullptr;
+			}
+#endif
+		}
+	}
+}
+
+#ifndef BON_DISABLE_ALLOCATION_TRACKER
+
+// global operator new / delete hooks.
+// note: aligned new / delete overloads are left to the default implementation and are not tracked.
+void* operator new(std::size_t size)
+{
+	bon::diagnostics::AllocationTracker::_OnAllocate(size);
+	void* ret = std::malloc(size ? size : 1);
+	if (ret == nullptr) { throw std::bad_alloc(); }
+	return ret;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	bon::diagnostics::AllocationTracker::_OnAllocate(size);
+	return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if (ptr == nullptr) { return; }
+	bon::diagnostics::AllocationTracker::_OnFree();
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	operator delete(ptr);
+}
+
+#endif
@@ -1,18 +1,195 @@
 #include <Diagnostics/Diagnostics.h>
 #include <BonEngine.h>
 #include <Engine/Engine.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <cstdio>
 
 
 namespace bon
 {
 	namespace diagnostics
 	{
+		// frame phases names, for csv
+		const char* FramePhasesNames[(int)FramePhases::_Count] = { "frame", "update", "fixed_update", "draw", "present", 
+			"gpu_frame", "gpu_clear", "gpu_draw", "gpu_effects", "gpu_render_to_texture", "gpu_present" };
+
+		// smallest frame time histogram bucket upper bound, in milliseconds
+		const double FrameTimeHistogramFirstBound = 0.5;
+
+		// get histogram bucket upper bound
+		double FrameTimeHistogramUpperBound(int bucket)
+		{
+			return FrameTimeHistogramFirstBound * std::pow(2.0, bucket * 0.5);
+		}
+
+		// get histogram bucket of a frame time
+		static int GetFrameTimeHistogramBucket(double milliseconds)
+		{
+			if (milliseconds <= FrameTimeHistogramFirstBound) { return 0; }
+			int bucket = (int)std::ceil(2.0 * std::log2(milliseconds / FrameTimeHistogramFirstBound));
+			return std::min(bucket, FrameTimeHistogramBuckets - 1);
+		}
+
+		// built-in counters names and types, by built-in counter id
+		const struct { const char* Name; CounterTypes Type; } BuiltInCounters[(int)DiagnosticsCounters::_BuiltInCounterCount] = {
+			{ "DrawCalls", CounterTypes::PerFrame },
+			{ "PlaySoundCalls", CounterTypes::PerFrame },
+			{ "LoadedAssets", CounterTypes::Gauge },
+			{ "TextureBinds", CounterTypes::PerFrame },
+			{ "ShaderSwitches", CounterTypes::PerFrame },
+			{ "TextCacheHits", CounterTypes::PerFrame },
+			{ "TextCacheMisses", CounterTypes::PerFrame },
+			{ "AssetLoads", CounterTypes::Cumulative },
+			{ "FrameAllocations", CounterTypes::Gauge },
+			{ "FrameAllocatedBytes", CounterTypes::Gauge },
+			{ "SoundsStolen", CounterTypes::Cumulative },
+			{ "SoundsDropped", CounterTypes::Cumulative },
+			{ "VirtualVoices", CounterTypes::Gauge },
+		};
+
+		// create diagnostics manager
+		Diagnostics::Diagnostics()
+		{
+			for (auto& counter : BuiltInCounters)
+			{
+				RegisterCounter(counter.Name, counter.Type);
+			}
+		}
+
+		// init diagnostics manager
+		void Diagnostics::_Initialize()
+		{
+			SetFrameStatsWindow(_frameTimesWindow);
+		}
+
+		// dispose diagnostics manager
+		void Diagnostics::_Dispose()
+		{
+			if (!_frameStatsCsvOnExit.empty())
+			{
+				DumpFrameStatsCsv(_frameStatsCsvOnExit.c_str());
+			}
+		}
+
+		// set frame stats window
+		void Diagnostics::SetFrameStatsWindow(int frames)
+		{
+			_frameTimesWindow = std::max(frames, 1);
+			for (int i = 0; i < (int)FramePhases::_Count; ++i) 
+			{
+				_frameTimes[i].assign(_frameTimesWindow, 0.0f);
+			}
+			_frameStatsScratch.reserve(_frameTimesWindow);
+			_frameTimesCount = _frameTimesIndex = 0;
+		}
+
+		// end frame and store its phases times
+		void Diagnostics::_EndFrame(double frameMilliseconds)
+		{
+			_currFramePhases[(int)FramePhases::Frame] = frameMilliseconds;
+			for (int i = 0; i < (int)FramePhases::_Count; ++i)
+			{
+				_frameTimes[i][_frameTimesIndex] = (float)_currFramePhases[i];
+				_currFramePhases[i] = 0;
+			}
+			_frameTimesIndex = (_frameTimesIndex + 1) % _frameTimesWindow;
+			_frameTimesCount = std::min(_frameTimesCount + 1, _frameTimesWindow);
+
+			// calculate allocations made during frame
+			AllocationStats allocations = AllocationTracker::GetTotals();
+			_frameAllocations.Allocations = allocations.Allocations - _lastAllocationTotals.Allocations;
+			_frameAllocations.Frees = allocations.Frees - _lastAllocationTotals.Frees;
+			_frameAllocations.Bytes = allocations.Bytes - _lastAllocationTotals.Bytes;
+			_lastAllocationTotals = allocations;
+			_SetCounter((int)DiagnosticsCounters::FrameAllocations, (long)_frameAllocations.Allocations);
+			_SetCounter((int)DiagnosticsCounters::FrameAllocatedBytes, (long)_frameAllocations.Bytes);
+		}
+
+		// calculate frame stats
+		FrameTimeStats Diagnostics::GetFrameStats(FramePhases phase) const
+		{
+			if ((int)phase < 0 || (int)phase >= (int)FramePhases::_Count)
+			{
+				throw framework::InvalidValue("Invalid frame phase!");
+			}
+			FrameTimeStats ret;
+			if (_frameTimesCount == 0) { return ret; }
+
+			// get frame times, and calculate min, max, mean, budget and histogram
+			const std::vector<float>& times = _frameTimes[(int)phase];
+			_frameStatsScratch.assign(times.begin(), times.begin() + _frameTimesCount);
+			double sum = 0;
+			ret.FramesCount = _frameTimesCount;
+			ret.Min = ret.Max = _frameStatsScratch[0];
+			for (float time : _frameStatsScratch)
+			{
+				sum += time;
+				ret.Min = std::min(ret.Min, (double)time);
+				ret.Max = std::max(ret.Max, (double)time);
+				if (time > _frameBudget) { ret.FramesOverBudget++; }
+				ret.Histogram[GetFrameTimeHistogramBucket(time)]++;
+			}
+			ret.Mean = sum / _frameTimesCount;
+
+			// calculate percentiles (nearest rank)
+			std::sort(_frameStatsScratch.begin(), _frameStatsScratch.end());
+			auto percentile = [this](double p) { 
+				int rank = (int)std::ceil(p * _frameTimesCount);
+				return (double)_frameStatsScratch[std::max(rank, 1) - 1];
+			};
+			ret.P50 = percentile(0.50);
+			ret.P95 = percentile(0.95);
+			ret.P99 = percentile(0.99);
+			return ret;
+		}
+
+		// write frame stats to csv
+		bool Diagnostics::DumpFrameStatsCsv(const char* filename) const
+		{
+			std::ofstream file(filename, std::ios::trunc);
+			if (!file.is_open())
+			{
+				BON_WLOG("Failed to open frame stats file '%s'.", filename);
+				return false;
+			}
+
+			// header
+			file << "phase,frames,min_ms,max_ms,mean_ms,p50_ms,p95_ms,p99_ms,over_budget";
+			for (int i = 0; i < FrameTimeHistogramBuckets; ++i)
+			{
+				file << ",hist_" << ((i == FrameTimeHistogramBuckets - 1) ? "over_" : "upto_") << FrameTimeHistogramUpperBound(i - ((i == FrameTimeHistogramBuckets - 1) ? 1 : 0)) << "ms";
+			}
+			file << "\n";
+
+			// row per phase
+			for (int phase = 0; phase < (int)FramePhases::_Count; ++phase)
+			{
+				FrameTimeStats stats = GetFrameStats((FramePhases)phase);
+				file << FramePhasesNames[phase] << "," << stats.FramesCount << "," << stats.Min << "," << stats.Max << "," << stats.Mean << "," << 
+					stats.P50 << "," << stats.P95 << "," << stats.P99 << "," << stats.FramesOverBudget;
+				for (int i = 0; i < FrameTimeHistogramBuckets; ++i) 
+				{
+					file << "," << stats.Histogram[i];
+				}
+				file << "\n";
+			}
+			return file.good();
+		}
+
 		// do updates
 		void Diagnostics::_Update(double deltaTime)
 		{
-			// reset counters
-			ResetCounter(DiagnosticsCounters::DrawCalls);
-			ResetCounter(DiagnosticsCounters::PlaySoundCalls);
+			// store and reset per-frame counters
+			int countersCount = RegisteredCountersCount();
+			for (int i = 0; i < countersCount; ++i)
+			{
+				if (_countersTypes[i] == CounterTypes::PerFrame)
+				{
+					_countersLastFrame[i] = _counters[i].exchange(0, std::memory_order_relaxed);
+				}
+			}
 
 			// to count seconds
 			static double secondsCount = 0.0;
@@ -25,24 +202,154 @@ namespace bon
 				_currFpsCount = 0;
 				secondsCount = 0.0;
 			}
+
+			// toggle profiler with hotkey
+			if (_profilerHotkey != input::KeyCodes::KeyUnknown)
+			{
+				bool hotkeyDown = _GetEngine().Input().Down(_profilerHotkey);
+				if (hotkeyDown && !_profilerHotkeyWasDown)
+				{
+					if (Profiler::IsRunning()) 
+					{
+						Profiler::Stop();
+						Profiler::Export(_profilerExportFilename.c_str());
+					}
+					else 
+					{
+						Profiler::Start();
+					}
+				}
+				_profilerHotkeyWasDown = hotkeyDown;
+			}
+		}
+
+		// set profiler hotkey
+		void Diagnostics::SetProfilerHotkey(input::KeyCodes key, const char* exportFilename)
+		{
+			_profilerHotkey = key;
+			_profilerExportFilename = exportFilename ? exportFilename : "profile.json";
+			_profilerHotkeyWasDown = false;
+		}
+
+		// enable / disable allocation tracker
+		void Diagnostics::EnableAllocationTracker(bool enable)
+		{
+			AllocationTracker::Enable(enable);
+			_lastAllocationTotals = AllocationTracker::GetTotals();
 		}
 
 		// get counter value
 		long Diagnostics::_GetCounter(int counterId) const
 		{
-			return _counters[counterId];
+			return _counters[counterId].load(std::memory_order_relaxed);
 		}
 
 		// increase counter value
 		void Diagnostics::_IncreaseCounter(int counterId, long increaseBy)
 		{
-			_counters[counterId] += increaseBy;
+			_counters[counterId].fetch_add(increaseBy, std::memory_order_relaxed);
 		}
 
 		// reset counter value
 		void Diagnostics::_ResetCounter(int counterId)
 		{
-			_counters[counterId] = 0;
+			_counters[counterId].store(0, std::memory_order_relaxed);
+		}
+
+		// set counter value
+		void Diagnostics::_SetCounter(int counterId, long value)
+		{
+			_counters[counterId].store(value, std::memory_order_relaxed);
+		}
+
+		// register a named counter
+		int Diagnostics::RegisterCounter(const char* name, CounterTypes type)
+		{
+			std::lock_guard<std::mutex> lock(_countersMutex);
+
+			// already registered? return its id
+			auto found = _countersIds.find(name);
+			if (found != _countersIds.end()) 
+			{
+				return found->second;
+			}
+
+			// make sure we have room
+			int id = _registeredCountersCount.load(std::memory_order_relaxed);
+			if (id >= (int)DiagnosticsCounters::_MaxCounters)
+			{
+				throw framework::InvalidState("Can't register counter, reached max counters count!");
+			}
+
+			// add counter and publish it
+			_countersNames[id] = name;
+			_countersTypes[id] = type;
+			_countersIds[name] = id;
+			_registeredCountersCount.store(id + 1, std::memory_order_release);
+			return id;
+		}
+
+		// get registered counter id
+		int Diagnostics::GetCounterId(const char* name) const
+		{
+			std::lock_guard<std::mutex> lock(_countersMutex);
+			auto found = _countersIds.find(name);
+			return (found != _countersIds.end()) ? found->second : -1;
+		}
+
+		// get registered counter name
+		const char* Diagnostics::GetCounterName(int counterId) const
+		{
+			if (counterId < 0 || counterId >= RegisteredCountersCount()) { return nullptr; }
+			return _countersNames[counterId].c_str();
+		}
+
+		// get assets residency stats snapshot
+		AssetsResidencyStats Diagnostics::GetAssetsResidency(assets::AssetTypes type) const
+		{
+			if ((int)type < 0 || (int)type >= (int)assets::AssetTypes::_Count)
+			{
+				throw framework::InvalidValue("Invalid asset type!");
+			}
+			return _assetsResidency[(int)type].Snapshot();
+		}
+
+		// get registered counter type
+		CounterTypes Diagnostics::GetCounterType(int counterId) const
+		{
+			if (counterId < 0 || counterId >= RegisteredCountersCount()) 
+			{ 
+				throw framework::InvalidValue("Counter id is not registered!");
+			}
+			return _countersTypes[counterId];
+		}
+
+		// draw top counters on screen
+		void Diagnostics::DrawCountersOverlay(const assets::FontAsset& font, int topN, const framework::PointF& position, int fontSize)
+		{
+			// collect counters values and sort them, biggest first
+			int countersCount = RegisteredCountersCount();
+			_overlayScratch.clear();
+			for (int i = 0; i < countersCount; ++i)
+			{
+				long value = (_countersTypes[i] == CounterTypes::PerFrame) ? _countersLastFrame[i] : _GetCounter(i);
+				_overlayScratch.push_back(std::make_pair(value, i));
+			}
+			topN = std::max(0, std::min(topN, countersCount));
+			std::partial_sort(_overlayScratch.begin(), _overlayScratch.begin() + topN, _overlayScratch.end(), 
+				[](const std::pair<long, int>& a, const std::pair<long, int>& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+			// draw them
+			static const Color textColor(1, 1, 1, 1);
+			static const Color outlineColor(0, 0, 0, 1);
+			int lineHeight = fontSize ? fontSize : font->FontSize();
+			char line[128];
+			for (int i = 0; i < topN; ++i)
+			{
+				snprintf(line, sizeof(line), "%s: %ld", _countersNames[_overlayScratch[i].second].c_str(), _overlayScratch[i].first);
+				PointF linePosition(position.X, position.Y + (float)(lineHeight * i));
+				_GetEngine().Gfx().DrawText(font, line, linePosition, &textColor, fontSize, 0, BlendModes::AlphaBlend, nullptr, 0.0f, 1, &outlineColor);
+			}
 		}
 	}
 }
\ No newline at end of file
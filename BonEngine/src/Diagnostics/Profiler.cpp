@@ -0,0 +1,215 @@
+#include <Diagnostics/Profiler.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+
+
+namespace bon
+{
+	namespace diagnostics
+	{
+		// a single recorded scope
+		struct ProfilerEvent
+		{
+			const char* Name;
+			uint64_t Start;
+			uint64_t End;
+			uint64_t Allocations;
+			uint64_t AllocatedBytes;
+		};
+
+		// ring buffer of events recorded by a single thread.
+		// only the owning thread writes, count is published with release order so exporter can read events safely.
+		struct ProfilerThreadEvents
+		{
+			uint32_t ThreadId = 0;
+			std::atomic<uint64_t> Count{ 0 };
+			bool Exited = false;
+			ProfilerEvent Events[Profiler::MaxEventsPerThread];
+		};
+
+		// all threads ring buffers.
+		// buffers of exited threads are kept until their events are exported or discarded, then reused by new threads.
+		// registry itself is never freed, since threads may keep recording until process exits.
+		struct ProfilerRegistry
+		{
+			std::mutex Mutex;
+			std::vector<ProfilerThreadEvents*> Threads;
+			std::vector<ProfilerThreadEvents*> FreeBuffers;
+			uint32_t NextThreadId = 1;
+			std::atomic<uint64_t> SessionStart{ 0 };
+		};
+
+		// get threads registry
+		static ProfilerRegistry& GetRegistry()
+		{
+			static ProfilerRegistry* registry = new ProfilerRegistry();
+			return *registry;
+		}
+
+		// move buffers of exited threads to free list. must be called with registry mutex locked
+		static void RecycleExitedThreads(ProfilerRegistry& registry)
+		{
+			auto exited = std::partition(registry.Threads.begin(), registry.Threads.end(), [](ProfilerThreadEvents* thread) { return !thread->Exited; });
+			registry.FreeBuffers.insert(registry.FreeBuffers.end(), exited, registry.Threads.end());
+			registry.Threads.erase(exited, registry.Threads.end());
+		}
+
+		// owns current thread's events buffer, and returns it to registry when thread exits
+		struct ProfilerThreadEventsOwner
+		{
+			ProfilerThreadEvents* Events = nullptr;
+			~ProfilerThreadEventsOwner()
+			{
+				if (Events == nullptr) { return; }
+				auto& registry = GetRegistry();
+				std::lock_guard<std::mutex> lock(registry.Mutex);
+				Events->Exited = true;
+
+				// no events to export? can reuse buffer right away
+				if (Events->Count.load(std::memory_order_relaxed) == 0) {
+					RecycleExitedThreads(registry);
+				}
+			}
+		};
+
+		// current thread's events
+		thread_local ProfilerThreadEventsOwner _threadEvents;
+
+		// is profiler running
+		std::atomic<bool> Profiler::_running{ false };
+
+		// start profiling
+		void Profiler::Start()
+		{
+			// instead of clearing buffers (which other threads write to) we ignore events from before session start.
+			// exited threads events are discarded, so we can reuse their buffers
+			auto& registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			registry.SessionStart.store(_Now());
+			RecycleExitedThreads(registry);
+			_running.store(true);
+			BON_DLOG("Profiler started.");
+		}
+
+		// stop profiling
+		void Profiler::Stop()
+		{
+			_running.store(false);
+			BON_DLOG("Profiler stopped.");
+		}
+
+		// get current time in nanoseconds
+		uint64_t Profiler::_Now()
+		{
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		// record event
+		void Profiler::_Record(const char* name, uint64_t start, uint64_t end, uint64_t allocations, uint64_t allocatedBytes)
+		{
+			// first event in this thread? get a buffer from exited threads, or create a new one
+			ProfilerThreadEvents* threadEvents = _threadEvents.Events;
+			if (threadEvents == nullptr)
+			{
+				auto& registry = GetRegistry();
+				std::lock_guard<std::mutex> lock(registry.Mutex);
+				if (!registry.FreeBuffers.empty())
+				{
+					threadEvents = registry.FreeBuffers.back();
+					registry.FreeBuffers.pop_back();
+					threadEvents->Count.store(0, std::memory_order_relaxed);
+					threadEvents->Exited = false;
+				}
+				else
+				{
+					threadEvents = new ProfilerThreadEvents();
+				}
+				threadEvents->ThreadId = registry.NextThreadId++;
+				registry.Threads.push_back(threadEvents);
+				_threadEvents.Events = threadEvents;
+			}
+
+			// write event and publish it
+			uint64_t index = threadEvents->Count.load(std::memory_order_relaxed);
+			ProfilerEvent& event = threadEvents->Events[index & (MaxEventsPerThread - 1)];
+			event.Name = name;
+			event.Start = start;
+			event.End = end;
+			event.Allocations = allocations;
+			event.AllocatedBytes = allocatedBytes;
+			threadEvents->Count.store(index + 1, std::memory_order_release);
+		}
+
+		// write json string with escaping
+		static void WriteJsonString(std::ofstream& file, const char* str)
+		{
+			file << '"';
+			for (; *str; ++str)
+			{
+				if (*str == '"' || *str == '\\') { file << '\\'; }
+				if ((unsigned char)*str >= 0x20) { file << *str; }
+			}
+			file << '"';
+		}
+
+		// export to chrome trace format
+		bool Profiler::Export(const char* filename)
+		{
+			std::ofstream file(filename, std::ios::trunc);
+			if (!file.is_open())
+			{
+				BON_WLOG("Failed to open profiler export file '%s'.", filename);
+				return false;
+			}
+
+			// write header
+			auto& registry = GetRegistry();
+			uint64_t sessionStart = registry.SessionStart.load();
+			file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+			file.precision(3);
+			file.setf(std::ios::fixed);
+
+			// write all threads events
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			bool first = true;
+			size_t eventsCount = 0;
+			for (auto thread : registry.Threads)
+			{
+				// thread name
+				file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->ThreadId << ",\"args\":{\"name\":\"Thread " << thread->ThreadId << "\"}}";
+				first = false;
+
+				// events, from oldest still in ring buffer
+				uint64_t count = thread->Count.load(std::memory_order_acquire);
+				uint64_t begin = (count > MaxEventsPerThread) ? (count - MaxEventsPerThread) : 0;
+				for (uint64_t i = begin; i < count; ++i)
+				{
+					const ProfilerEvent& event = thread->Events[i & (MaxEventsPerThread - 1)];
+					if (event.Start < sessionStart) { continue; }
+					file << ",\n{\"name\":";
+					WriteJsonString(file, event.Name);
+					file << ",\"cat\":\"bon\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->ThreadId;
+					file << ",\"ts\":" << (double)(event.Start - sessionStart) / 1000.0 << ",\"dur\":" << (double)(event.End - event.Start) / 1000.0;
+					if (event.Allocations > 0)
+					{
+						file << ",\"args\":{\"allocations\":" << event.Allocations << ",\"allocated_bytes\":" << event.AllocatedBytes << "}";
+					}
+					file << "}";
+					eventsCount++;
+				}
+			}
+			file << "\n]}\n";
+
+			// exited threads events are exported, reuse their buffers
+			RecycleExitedThreads(registry);
+
+			BON_ILOG("Exported %d profiler events to '%s'.", (int)eventsCount, filename);
+			return file.good();
+		}
+	}
+}
@@ -31,6 +31,9 @@ namespace bon
 			// update state to init
 			_state = EngineStates::Initialize;
 
+			// track SDL allocations, must happen before SDL allocates anything
+			diagnostics::AllocationTracker::_InstallSdlHooks();
+
 			// get features
 			auto features = bon::Features();
 			
@@ -178,6 +181,12 @@ namespace bon
 			return nullptr;
 		}
 
+		// get milliseconds passed since a given profiler timestamp
+		static double ElapsedMilliseconds(uint64_t since)
+		{
+			return (double)(diagnostics::Profiler::_Now() - since) / 1000000.0;
+		}
+
 		// start engine main loop
 		void Engine::StartMainLoop()
 		{
@@ -217,6 +226,8 @@ namespace bon
 				// main loop
 				while (_isRunning)
 				{
+					BON_PROFILE_SCOPE("Frame");
+
 					// if we have a scene to switch to, do the switching
 					if (_nextScene) {
 						_state = EngineStates::SwitchScene;
@@ -236,27 +247,37 @@ namespace bon
 					NOW = SDL_GetPerformanceCounter();
 					deltaTime = ((double)((NOW - LAST) * 1000 / (double)SDL_GetPerformanceFrequency())) / 1000.0;
 
+					// report previous frame time to diagnostics
+					_diagnosticsManager->_EndFrame(deltaTime * 1000.0);
+
+					// when replaying recorded input, use recorded delta time
+					_inputManager->_OverrideDeltaTime(deltaTime);
+
 					// update all managers
 					_state = EngineStates::InternalUpdate;
 					for (size_t i = 0; i < _managers.size(); ++i) {
+						BON_PROFILE_SCOPE((_managers)[i]->_GetId());
 						(_managers)[i]->_Update(deltaTime);
 					}
 					_state = EngineStates::MainLoopInBetweens;
 
 					// handle events on queue
 					_state = EngineStates::HandleEvents;
-					while (SDL_PollEvent(&e) != 0)
 					{
-						// user requests quit
-						if (e.type == SDL_QUIT)
+						BON_PROFILE_SCOPE("HandleEvents");
+						while (SDL_PollEvent(&e) != 0)
 						{
-							_isRunning = false;
-							break;
-						}
+							// user requests quit
+							if (e.type == SDL_QUIT)
+							{
+								_isRunning = false;
+								break;
+							}
 
-						// send event to all managers
-						for (size_t i = 0; i < _managers.size(); ++i) {
-							(_managers)[i]->_HandleEvent(e);
+							// send event to all managers
+							for (size_t i = 0; i < _managers.size(); ++i) {
+								(_managers)[i]->_HandleEvent(e);
+							}
 						}
 					}
 					_state = EngineStates::MainLoopInBetweens;
@@ -272,7 +293,10 @@ namespace bon
 							while (timeForNextFixedUpdate > FixedUpdatesInterval)
 							{
 								// do fixed update
+								BON_PROFILE_SCOPE("FixedUpdate");
+								uint64_t phaseStart = diagnostics::Profiler::_Now();
 								_activeScene->_FixedUpdate(FixedUpdatesInterval);
+								_diagnosticsManager->_ReportFramePhase(diagnostics::FramePhases::FixedUpdate, ElapsedMilliseconds(phaseStart));
 
 								// if need to switch scene skip here
 								if (_nextScene) {
@@ -293,7 +317,12 @@ namespace bon
 
 						// do per-frame update, unless need to switch scene
 						_state = EngineStates::Update;
-						_activeScene->_Update(deltaTime);
+						{
+							BON_PROFILE_SCOPE("Update");
+							uint64_t phaseStart = diagnostics::Profiler::_Now();
+							_activeScene->_Update(deltaTime);
+							_diagnosticsManager->_ReportFramePhase(diagnostics::FramePhases::Update, ElapsedMilliseconds(phaseStart));
+						}
 						_state = EngineStates::MainLoopInBetweens;
 
 						// increase updates count
@@ -307,7 +336,12 @@ namespace bon
 
 					// draw scene
 					_state = EngineStates::Draw;
-					_activeScene->_Draw();
+					{
+						BON_PROFILE_SCOPE("Draw");
+						uint64_t phaseStart = diagnostics::Profiler::_Now();
+						_activeScene->_Draw();
+						_diagnosticsManager->_ReportFramePhase(diagnostics::FramePhases::Draw, ElapsedMilliseconds(phaseStart));
+					}
 					_state = EngineStates::MainLoopInBetweens;
 				}
 
@@ -1,6 +1,7 @@
 #include <Game/Game.h>
 #include <BonEngine.h>
 #include <Engine/Engine.h>
+#include <Assets/CompiledConfig.h>
 #include <../3rdparty/INIReader/INIReader.h>
 
 
@@ -73,6 +74,17 @@ namespace bon
 				bon::_GetEngine().Log().SetLevel((bon::log::LogLevel)logLevel);
 			}
 
+			// initialize assets
+			if (config->Exists("assets"))
+			{
+				int memoryBudgetMb = config->GetInt("assets", "memory_budget_mb", 0);
+				BON_DLOG("Assets config: memory_budget_mb = %d", memoryBudgetMb);
+				_GetEngine().Assets().SetMemoryBudget((size_t)memoryBudgetMb * 1024 * 1024);
+				bool hotReload = config->GetBool("assets", "hot_reload", false);
+				BON_DLOG("Assets config: hot_reload = %d", hotReload);
+				_GetEngine().Assets().EnableHotReload(hotReload);
+			}
+
 			// initialize graphics
 			if (config->Exists("gfx"))
 			{
@@ -98,6 +110,20 @@ namespace bon
 				BON_DLOG("Sfx config: frequency = %d, format = %s, stereo = %d, audio_chunk_size = %d",
 					frequency, FormatOptions[format], stereo, audio_chunk_size);
 				_GetEngine().Sfx().SetAudioProperties(frequency, (AudioFormats)format, stereo, audio_chunk_size);
+
+				// voices pool
+				static const char* VoiceStealingOptions[] = { "none", "oldest", "quietest", "lowest_priority" };
+				int voices = config->GetInt("sfx", "voices", 32);
+				int stealing = config->GetOption("sfx", "voice_stealing", VoiceStealingOptions, 3);
+				if (stealing == -1) { stealing = (int)VoiceStealingPolicy::LowestPriority; }
+				BON_DLOG("Sfx voices config: voices = %d, voice_stealing = %s", voices, VoiceStealingOptions[stealing]);
+				_GetEngine().Sfx().SetVoicesCount(voices);
+				_GetEngine().Sfx().SetVoiceStealingPolicy((VoiceStealingPolicy)stealing);
+
+				// engine mixer
+				bool engineMixer = config->GetBool("sfx", "engine_mixer", false);
+				BON_DLOG("Sfx engine mixer config: engine_mixer = %d", engineMixer);
+				_GetEngine().Sfx().EnableEngineMixer(engineMixer);
 			}
 
 			// initialize controls
@@ -223,14 +249,30 @@ namespace bon
 		void ConfigLoader(bon::assets::IAsset* asset, void* context, void* extraData)
 		{
 			const char* path = asset->Path();
-			ConfigIniHandle* handle = path != nullptr ? new ConfigIniHandle(path) : new ConfigIniHandle();
-			asset->_SetHandle(handle);
+
+			// empty config
+			if (path == nullptr || path[0] == '\0')
+			{
+				asset->_SetHandle(new ConfigIniHandle());
+				return;
+			}
+
+			// load compiled config, only if path explicitly points to a compiled config file.
+			// we never replace an ini with its compiled version implicitly, since compiled configs are read-only and may be out of date.
+			if (assets::CompiledConfigHandle::IsCompiledConfig(path))
+			{
+				asset->_SetHandle(new assets::CompiledConfigHandle(path));
+				return;
+			}
+
+			// load ini file
+			asset->_SetHandle(new ConfigIniHandle(path));
 		}
 
 		// images disposer we set in the assets manager during asset disposal
 		void ConfigDisposer(bon::assets::IAsset* asset, void* context)
 		{
-			asset->_DestroyHandle<ConfigIniHandle>();
+			asset->_DestroyHandle<_ConfigHandle>();
 		}
 	}
 }
\ No newline at end of file
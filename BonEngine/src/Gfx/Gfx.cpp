@@ -24,7 +24,12 @@ namespace bon
 		void Gfx::_Update(double deltaTime)
 		{
 			// on update start, display previous frame
-			_Implementor.UpdateWindow();
+			{
+				BON_PROFILE_SCOPE("Gfx::Present");
+				uint64_t presentStart = Profiler::_Now();
+				_Implementor.UpdateWindow();
+				_GetEngine().Diagnostics()._ReportFramePhase(FramePhases::Present, (double)(Profiler::_Now() - presentStart) / 1000000.0);
+			}
 
 			// reset effect
 			UseEffect(nullptr);
@@ -94,6 +99,7 @@ namespace bon
 			static Color defaultColor(1, 1, 1, 1);
 			static Color defaultOutlineColor(0, 0, 0, 1);
 			static PointF defaultOrigin(0, 0);
+			BON_PROFILE_SCOPE("Gfx::DrawText");
 
 			// draw text outline
 			if (outlineWidth > 0)
@@ -170,6 +176,12 @@ namespace bon
 		}
 
 
+		// enable / disable gpu timers
+		bool Gfx::EnableGpuTimers(bool enable)
+		{
+			return _Implementor.EnableGpuTimers(enable);
+		}
+
 		// create image asset from screen
 		assets::ImageAsset Gfx::CreateImageFromScreen() const
 		{
@@ -66,6 +66,27 @@ PFNGLBLENDEQUATIONEXTPROC glBlendEquationEXT;
 PFNGLBLENDEQUATIONSEPARATEEXTPROC glBlendEquationSeparateEXT;
 //PFNGLCLEARTEXIMAGEPROC glClearTexImage;
 
+// timer queries, loaded only when gpu timers are enabled
+PFNGLGENQUERIESPROC glGenQueries;
+PFNGLBEGINQUERYPROC glBeginQuery;
+PFNGLENDQUERYPROC glEndQuery;
+PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+
+// load GL timer queries methods
+bool initGLTimerQueries()
+{
+	if (!SDL_GL_ExtensionSupported("GL_ARB_timer_query")) {
+		return false;
+	}
+	glGenQueries = (PFNGLGENQUERIESPROC)SDL_GL_GetProcAddress("glGenQueries");
+	glBeginQuery = (PFNGLBEGINQUERYPROC)SDL_GL_GetProcAddress("glBeginQuery");
+	glEndQuery = (PFNGLENDQUERYPROC)SDL_GL_GetProcAddress("glEndQuery");
+	glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)SDL_GL_GetProcAddress("glGetQueryObjectiv");
+	glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)SDL_GL_GetProcAddress("glGetQueryObjectui64v");
+	return glGenQueries && glBeginQuery && glEndQuery && glGetQueryObjectiv && glGetQueryObjectui64v;
+}
+
 // load GL extension methods
 bool initGLExtensions()
 {
@@ -117,7 +138,7 @@ namespace bon
 		 */
 		GLuint compileShader(const char* source, GLuint shaderType)
 		{
-			BON_DLOG("Compile shader: %s", source);
+			BON_DLOG_CAT(Gfx, "Compile shader: %s", source);
 
 			// create ID for shader
 			GLuint result = glCreateShader(shaderType);
@@ -133,14 +154,14 @@ namespace bon
 			glGetShaderiv(result, GL_COMPILE_STATUS, &shaderCompiled);
 			if (shaderCompiled != GL_TRUE)
 			{
-				BON_ELOG("Error compiling shader: %d!", result);
+				BON_ELOG_CAT(Gfx, "Error compiling shader: %d!", result);
 				GLint logLength;
 				glGetShaderiv(result, GL_INFO_LOG_LENGTH, &logLength);
 				if (logLength > 0)
 				{
 					GLchar* log = (GLchar*)malloc(logLength);
 					glGetShaderInfoLog(result, logLength, &logLength, log);
-					BON_ELOG("Shader compile log: %s", log);
+					BON_ELOG_CAT(Gfx, "Shader compile log: %s", log);
 					free(log);
 				}
 				throw bon::framework::AssetLoadError("Failed to build shader!");
@@ -191,7 +212,7 @@ namespace bon
 
 					// show any errors as appropriate
 					glGetProgramInfoLog(programId, logLen, &logLen, log);
-					BON_DLOG("Compiling shaders prog info log:\n%s", log);
+					BON_DLOG_CAT(Gfx, "Compiling shaders prog info log:\n%s", log);
 					free(log);
 				}
 			}
@@ -226,10 +247,10 @@ namespace bon
 
 			// init shaders
 			if (!strncmp(rendererInfo.name, "opengl", 6)) {
-				BON_DLOG("Initialize OpenGL extensions.");
+				BON_DLOG_CAT(Gfx, "Initialize OpenGL extensions.");
 #ifndef __APPLE__
 				if (!initGLExtensions()) {
-					BON_ELOG("Couldn't init GL extensions!");
+					BON_ELOG_CAT(Gfx, "Couldn't init GL extensions!");
 					SDL_Quit();
 					exit(-1);
 				}
@@ -237,6 +258,146 @@ namespace bon
 			}
 		}
 
+		// gpu timers: how many frames we wait before reading queries results, and max queries per frame
+		const int GpuTimersFramesInFlight = 4;
+		const int GpuTimersMaxQueriesPerFrame = 64;
+
+		// gpu timer queries of a single frame
+		struct GpuTimersFrame
+		{
+			GLuint Queries[GpuTimersMaxQueriesPerFrame];
+			diagnostics::FramePhases Phases[GpuTimersMaxQueriesPerFrame];
+			int Count = 0;
+		};
+
+		// gpu timers state
+		bool _gpuTimersEnabled = false;
+		bool _gpuTimersHaveQueries = false;
+		GpuTimersFrame _gpuTimersFrames[GpuTimersFramesInFlight];
+		int _gpuTimersCurrFrame = 0;
+		diagnostics::FramePhases _gpuTimersCurrPhase = diagnostics::FramePhases::_Count;
+
+		/**
+		 * Enable / disable gpu timers.
+		 */
+		bool GfxOpenGL::EnableGpuTimers(bool enable)
+		{
+			// disable
+			if (!enable)
+			{
+				SetGpuTimerPhase(diagnostics::FramePhases::_Count);
+				_gpuTimersEnabled = false;
+				return true;
+			}
+
+			// already enabled?
+			if (_gpuTimersEnabled) { return true; }
+
+			// load methods and create queries pool
+#ifndef __APPLE__
+			if (!_gpuTimersHaveQueries)
+			{
+				if (!_wasInit || !initGLTimerQueries())
+				{
+					BON_WLOG_CAT(Gfx, "GPU timers are not supported (requires OpenGL renderer with GL_ARB_timer_query).");
+					return false;
+				}
+				ResetGpuTimers();
+			}
+			_gpuTimersEnabled = true;
+			return true;
+#else
+			BON_WLOG_CAT(Gfx, "GPU timers are not supported on this platform.");
+			return false;
+#endif
+		}
+
+		/**
+		 * Get if gpu timers are enabled.
+		 */
+		bool GfxOpenGL::GpuTimersEnabled()
+		{
+			return _gpuTimersEnabled;
+		}
+
+		/**
+		 * Recreate gpu timers queries pool.
+		 */
+		void GfxOpenGL::ResetGpuTimers()
+		{
+#ifndef __APPLE__
+			// skip if gpu timers were never enabled
+			if (glGenQueries == nullptr) { return; }
+
+			// queries belong to the gl context, so old ones are gone if context was recreated
+			for (int i = 0; i < GpuTimersFramesInFlight; ++i)
+			{
+				glGenQueries(GpuTimersMaxQueriesPerFrame, _gpuTimersFrames[i].Queries);
+				_gpuTimersFrames[i].Count = 0;
+			}
+			_gpuTimersHaveQueries = true;
+			_gpuTimersCurrPhase = diagnostics::FramePhases::_Count;
+#endif
+		}
+
+		/**
+		 * Set the frame phase gpu timers measure.
+		 */
+		void GfxOpenGL::SetGpuTimerPhase(diagnostics::FramePhases phase)
+		{
+#ifndef __APPLE__
+			// skip if disabled or phase didn't change
+			if (!_gpuTimersEnabled || phase == _gpuTimersCurrPhase) { return; }
+
+			// end previous phase query (timer queries can't be nested)
+			if (_gpuTimersCurrPhase != diagnostics::FramePhases::_Count)
+			{
+				glEndQuery(GL_TIME_ELAPSED);
+				_gpuTimersCurrPhase = diagnostics::FramePhases::_Count;
+			}
+
+			// start new phase query, unless we ran out of queries for this frame
+			GpuTimersFrame& frame = _gpuTimersFrames[_gpuTimersCurrFrame];
+			if (phase != diagnostics::FramePhases::_Count && frame.Count < GpuTimersMaxQueriesPerFrame)
+			{
+				frame.Phases[frame.Count] = phase;
+				glBeginQuery(GL_TIME_ELAPSED, frame.Queries[frame.Count++]);
+				_gpuTimersCurrPhase = phase;
+			}
+#endif
+		}
+
+		/**
+		 * End gpu timers frame and collect results from a few frames ago.
+		 */
+		bool GfxOpenGL::EndGpuTimersFrame(double* outPhasesMs)
+		{
+			bool ret = false;
+#ifndef __APPLE__
+			if (!_gpuTimersEnabled) { return false; }
+			SetGpuTimerPhase(diagnostics::FramePhases::_Count);
+
+			// move to next frame, which is the oldest one, and collect its results.
+			// if a result is still not ready we drop it rather than stall.
+			_gpuTimersCurrFrame = (_gpuTimersCurrFrame + 1) % GpuTimersFramesInFlight;
+			GpuTimersFrame& frame = _gpuTimersFrames[_gpuTimersCurrFrame];
+			for (int i = 0; i < frame.Count; ++i)
+			{
+				GLint available = 0;
+				glGetQueryObjectiv(frame.Queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+				if (!available) { continue; }
+				GLuint64 elapsed = 0;
+				glGetQueryObjectui64v(frame.Queries[i], GL_QUERY_RESULT, &elapsed);
+				double ms = (double)elapsed / 1000000.0;
+				outPhasesMs[(int)frame.Phases[i]] += ms;
+				outPhasesMs[(int)diagnostics::FramePhases::GpuFrame] += ms;
+				ret = true;
+			}
+			frame.Count = 0;
+#endif
+			return ret;
+		}
+
 		/**
 		 * Set current shader program.
 		 */
@@ -256,6 +417,7 @@ namespace bon
 			float w;
 			float h;
 			SDL_GL_BindTexture(texture, &w, &h);
+			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::TextureBinds);
 			std::vector<GLubyte> emptyData((size_t)width * (size_t)height * 4, 0);
 			SDL_UpdateTexture(texture, NULL, &emptyData[0], width * 4);
 		}
@@ -426,6 +588,10 @@ namespace bon
 				glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_COLOR);
 				glEnable(GL_BLEND);
 				break;
+
+			// not a real blend mode (only used as 'no blend mode set yet')
+			case BlendModes::_Count:
+				break;
 			}
 		}
 
@@ -438,6 +604,7 @@ namespace bon
 			if (_lastTexture == texture) { return; }
 			_lastTexture = texture;
 			SDL_GL_BindTexture(texture, NULL, NULL);
+			if (texture) { _GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::TextureBinds); }
 		}
 
 		/**
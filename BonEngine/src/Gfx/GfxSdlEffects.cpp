@@ -109,9 +109,9 @@ namespace bon
 				auto effectFolder = std::filesystem::path(config->Path()).parent_path().u8string();
 				_vertexPath = std::filesystem::path(effectFolder).append(config->GetStr("shaders", "vertex", "shader.vertex")).u8string();
 				_fragmentPath = std::filesystem::path(effectFolder).append(config->GetStr("shaders", "fragment", "shader.fragment")).u8string();
-				BON_DLOG("Load effect '%s' shaders. Fragment: %s, Vertex: %s.", config->Path(), _fragmentPath.c_str(), _vertexPath.c_str());
+				BON_DLOG_CAT(Gfx, "Load effect '%s' shaders. Fragment: %s, Vertex: %s.", config->Path(), _fragmentPath.c_str(), _vertexPath.c_str());
 				_programId = GfxOpenGL::CompileProgramFromFiles(_vertexPath.c_str(), _fragmentPath.c_str());
-				BON_DLOG("Created effect program with id: %d", _programId);
+				BON_DLOG_CAT(Gfx, "Created effect program with id: %d", _programId);
 
 				// load general params
 				_flipCoordsV = config->GetBool("general", "flip_texture_v", true);
@@ -131,9 +131,9 @@ namespace bon
 				_flipCoordsV = flipTextureY;
 
 				// build program
-				BON_DLOG("Create effect program from given params.");
+				BON_DLOG_CAT(Gfx, "Create effect program from given params.");
 				_programId = GfxOpenGL::CompileProgram(vertex, frag);
-				BON_DLOG("Created effect program with id: %d", _programId);
+				BON_DLOG_CAT(Gfx, "Created effect program with id: %d", _programId);
 
 				// set as valid!
 				_isValid = true;
@@ -229,7 +229,7 @@ namespace bon
 			if (path != nullptr && path[0] != '\0') 
 			{
 				// load image and make sure succeed
-				BON_DLOG("Load image from file: %s.", path);
+				BON_DLOG_CAT(Gfx, "Load image from file: %s.", path);
 				SDL_Surface* surface = nullptr;
 				surface = IMG_Load(path);
 				if (surface == nullptr)
@@ -251,14 +251,14 @@ namespace bon
 				path = "<New Texture>";
 				if (!extraData) 
 				{
-					BON_ELOG("Tried to create an empty texture, but the extra data, which supposed to hold the desired size, was null! This might happen if you try to load a texture with empty path.");
+					BON_ELOG_CAT(Gfx, "Tried to create an empty texture, but the extra data, which supposed to hold the desired size, was null! This might happen if you try to load a texture with empty path.");
 					throw AssetLoadError(path);
 				}
 				framework::PointI* size = (framework::PointI*)extraData;
 				width = size->X;
 				height = size->Y;
 				haveAlpha = true;
-				BON_DLOG("Create new empty image with size %dx%d.", width, height);
+				BON_DLOG_CAT(Gfx, "Create new empty image with size %dx%d.", width, height);
 				texture = SDL_CreateTexture(((GfxSdlWrapper*)context)->GetRenderer(), SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
 			}
 
@@ -285,16 +285,18 @@ namespace bon
 		{
 		private:
 			int _fontSize;
+			size_t _memorySize;
 
 		public:
 
 			/**
 			 * Create SDL image surface.
 			 */
-			SDL_FontHandle(TTF_Font* font, int size)
+			SDL_FontHandle(TTF_Font* font, int size, size_t memorySize)
 			{
 				Font = font;
 				_fontSize = size;
+				_memorySize = memorySize;
 			}
 
 			/**
@@ -312,6 +314,11 @@ namespace bon
 			 * Get loaded font native size.
 			 */
 			virtual int FontSize() const { return _fontSize; }
+
+			/**
+			 * Get estimated font memory (font file size, which freetype keeps accessible while font is open).
+			 */
+			virtual size_t MemorySize() const override { return _memorySize; }
 		};
 
 		// fonts loader we set in the assets manager during initialize
@@ -319,7 +326,7 @@ namespace bon
 		{
 			// get path and log
 			const char* path = asset->Path();
-			BON_DLOG("Load font from file: %s.", path);
+			BON_DLOG_CAT(Gfx, "Load font from file: %s.", path);
 
 			// load font
 			int fontSize = extraData ? *((int*)extraData) : 32;
@@ -332,8 +339,18 @@ namespace bon
 				throw AssetLoadError(path);
 			}
 
+			// get font file size to estimate its memory
+			size_t memorySize = 0;
+			SDL_RWops* rw = SDL_RWFromFile(path, "rb");
+			if (rw)
+			{
+				Sint64 fileSize = SDL_RWsize(rw);
+				memorySize = fileSize > 0 ? (size_t)fileSize : 0;
+				SDL_RWclose(rw);
+			}
+
 			// set handle
-			SDL_FontHandle* handle = new SDL_FontHandle(font, fontSize);
+			SDL_FontHandle* handle = new SDL_FontHandle(font, fontSize, memorySize);
 			asset->_SetHandle(handle);
 		}
 
@@ -358,6 +375,7 @@ namespace bon
 			}
 
 			RestoreDefaultStates();
+			UpdateGpuTimerPhase();
 		}
 
 		// cache for drawing texts
@@ -376,7 +394,7 @@ namespace bon
 			int flags = (SDL_INIT_VIDEO | SDL_VIDEO_OPENGL);
 			if (SDL_Init(flags) < 0)
 			{
-				BON_ELOG("SDL could not initialize! SDL_Error: %s\n", SDL_GetError());
+				BON_ELOG_CAT(Gfx, "SDL could not initialize! SDL_Error: %s\n", SDL_GetError());
 				throw InitializeError("Failed to initialize SDL video drivers.");
 			}
 
@@ -386,7 +404,7 @@ namespace bon
 			// init fonts
 			if (TTF_Init() < 0)
 			{
-				BON_ELOG("SDL TTF Fonts could not initialize! SDL_Error: %s\n", SDL_GetError());
+				BON_ELOG_CAT(Gfx, "SDL TTF Fonts could not initialize! SDL_Error: %s\n", SDL_GetError());
 				throw InitializeError("Failed to initialize SDL fonts.");
 			}
 
@@ -562,7 +580,11 @@ namespace bon
 		{
 			auto col = color;
 			col.A = 1;
+			_clearing = true;
+			UpdateGpuTimerPhase();
 			DrawRectangle(clearRect, col, true, BlendModes::Opaque, PointF::Zero, 0);
+			_clearing = false;
+			UpdateGpuTimerPhase();
 		}
 
 		// clear an image to transparent
@@ -574,6 +596,8 @@ namespace bon
 			SDL_Texture* prevTarget = SDL_GetRenderTarget(_renderer);
 			SDL_BlendMode prevBlend;
 			SDL_GetTextureBlendMode(texture, &prevBlend);
+			_clearing = true;
+			UpdateGpuTimerPhase();
 
 			// set drawing color
 			UseDefaultShapesEffect(true);
@@ -597,6 +621,8 @@ namespace bon
 			// restore previous state
 			SDL_SetRenderTarget(_renderer, prevTarget);
 			SDL_SetTextureBlendMode(texture, prevBlend);
+			_clearing = false;
+			UpdateGpuTimerPhase();
 
 			//GfxOpenGL::ClearTexture(texture, width, height);
 		}
@@ -634,13 +660,13 @@ namespace bon
 		{
 			// sanity - make sure there are no loaded images
 			if (bon::_GetEngine().Assets()._GetLoadedAssetsCount(bon::assets::AssetTypes::Image) > 0) {
-				BON_ELOG("Warning! Changed window properties while there are still loaded texture assets!");
+				BON_ELOG_CAT(Gfx, "Warning! Changed window properties while there are still loaded texture assets!");
 			}
 
 			// set default sizes
 			if (width == 0 || height == 0)
 			{
-				BON_DLOG("Window width or height was set to 0 - query desktop size to retrieve default window size.");
+				BON_DLOG_CAT(Gfx, "Window width or height was set to 0 - query desktop size to retrieve default window size.");
 				SDL_DisplayMode dm;
 				SDL_GetCurrentDisplayMode(0, &dm);
 				if (width == 0) {
@@ -674,7 +700,7 @@ namespace bon
 			_window = SDL_CreateWindow(title, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, width, height, flags);
 			if (_window == NULL)
 			{
-				BON_ELOG("Window could not be created! SDL_Error: %s\n", SDL_GetError());
+				BON_ELOG_CAT(Gfx, "Window could not be created! SDL_Error: %s\n", SDL_GetError());
 				throw InitializeError("Failed to create SDL window.");
 			}
 
@@ -701,6 +727,36 @@ namespace bon
 
 			// use default effect
 			RestoreDefaultEffect();
+
+			// gpu timer queries belong to the old context
+			GfxOpenGL::ResetGpuTimers();
+			UpdateGpuTimerPhase();
+		}
+
+		// enable / disable gpu timers
+		bool GfxSdlWrapper::EnableGpuTimers(bool enable)
+		{
+			bool ret = GfxOpenGL::EnableGpuTimers(enable);
+			UpdateGpuTimerPhase();
+			return ret;
+		}
+
+		// set gpu timers phase from current state
+		void GfxSdlWrapper::UpdateGpuTimerPhase()
+		{
+			if (!GfxOpenGL::GpuTimersEnabled()) { return; }
+			if (_clearing) { 
+				GfxOpenGL::SetGpuTimerPhase(diagnostics::FramePhases::GpuClear); 
+			}
+			else if (_renderer && SDL_GetRenderTarget(_renderer) != nullptr) { 
+				GfxOpenGL::SetGpuTimerPhase(diagnostics::FramePhases::GpuRenderToTexture); 
+			}
+			else if (_currentEffect != _defaultEffect && _currentEffect != _defaultEffectShapes) { 
+				GfxOpenGL::SetGpuTimerPhase(diagnostics::FramePhases::GpuEffects); 
+			}
+			else { 
+				GfxOpenGL::SetGpuTimerPhase(diagnostics::FramePhases::GpuDraw); 
+			}
 		}
 
 		// set currently active effect, or null to remove effects.
@@ -782,8 +838,10 @@ namespace bon
 				lastAnchor.Set((float)-9999999999, (float)-9999999999);
 				GLuint program = *((GLuint*)effect->Handle()->GetProgramHandle());
 				GfxOpenGL::SetShaderProgram(program);
+				bon::_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::ShaderSwitches);
 				_currentEffect = effect;
 				RestoreDefaultStates();
+				UpdateGpuTimerPhase();
 			}
 		}
 
@@ -798,8 +856,23 @@ namespace bon
 		void GfxSdlWrapper::UpdateWindow()
 		{
 			// render screen
+			GfxOpenGL::SetGpuTimerPhase(diagnostics::FramePhases::GpuPresent);
 			SDL_RenderPresent(_renderer);
 
+			// collect gpu timers results and report them
+			if (GfxOpenGL::GpuTimersEnabled())
+			{
+				double phasesMs[(int)diagnostics::FramePhases::_Count] = { 0 };
+				if (GfxOpenGL::EndGpuTimersFrame(phasesMs))
+				{
+					auto& diagnosticsManager = bon::_GetEngine().Diagnostics();
+					for (int phase = (int)diagnostics::FramePhases::GpuFrame; phase < (int)diagnostics::FramePhases::_Count; ++phase) {
+						diagnosticsManager._ReportFramePhase((diagnostics::FramePhases)phase, phasesMs[phase]);
+					}
+				}
+				UpdateGpuTimerPhase();
+			}
+
 			// update effects
 			RestoreDefaultEffect();
 
@@ -827,6 +900,7 @@ namespace bon
 			CachedTexture& fromCache = fontsTextureCache.GetFromCache(font, asString);
 			
 			// not found in cache? generate it!
+			bon::_GetEngine().Diagnostics().IncreaseCounter(fromCache.Texture ? DiagnosticsCounters::TextCacheHits : DiagnosticsCounters::TextCacheMisses);
 			if (!fromCache.Texture) {
 				static SDL_Color white = { 255,255,255,255 };
 				SDL_Surface* tempSurface = nullptr;
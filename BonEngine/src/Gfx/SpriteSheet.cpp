@@ -3,7 +3,10 @@
 #include <string>
 #include <algorithm>
 #include <iterator>
+#include <fstream>
+#include <cstring>
 #include <Framework/Exceptions.h>
+#include <BonEngine.h>
 
 namespace bon
 {
@@ -23,6 +26,9 @@ namespace bon
 			cont.push_back(str.substr(previous, current - previous));
 		}
 
+		// baked spritesheet magic
+		const char BakedSpriteSheetMagic[4] = { 'B', 'S', 'H', 'T' };
+
 		// create the spritesheet from config file.
 		SpriteSheet::SpriteSheet(assets::ConfigAsset config)
 		{
@@ -32,8 +38,18 @@ namespace bon
 		// load from config file
 		void SpriteSheet::LoadFromConfig(assets::ConfigAsset config)
 		{
+			// keep config to rebuild when hot-reloaded
+			if (bon::_GetEngine().Assets().HotReloadEnabled())
+			{
+				_config = config;
+				_configReloadCount = config->ReloadCount();
+			}
+
 			// clear animations
 			_animations.clear();
+			_animationHandles.clear();
+			_animationsByHandle.clear();
+			_framesDirty = true;
 
 			// get sprites count in spritesheet
 			SpritesCount = config->GetPointF("general", "sprites_count", framework::PointF::One);
@@ -50,23 +66,291 @@ namespace bon
 				for (auto animName : animsList)
 				{
 					SpriteAnimationPtr curr(new SpriteAnimation(animName.c_str(), config));
-					_animations[animName] = curr;
+					AddAnimation(curr);
 				}
 			}
 
 			// get bookmarks
-			auto bookmarks = config->Keys("bookmarks");
-			for (auto bookid : bookmarks)
+			const auto& bookmarks = config->Keys("bookmarks");
+			for (const auto& bookid : bookmarks)
 			{
 				framework::PointI index = config->GetPointF("bookmarks", bookid.c_str(), framework::PointF::Zero);
 				AddBookmark(bookid.c_str(), index);
 			}
 		}
 
+		// load from baked file
+		void SpriteSheet::LoadFromBaked(const char* filename)
+		{
+			if (!TryLoadFromBaked(filename))
+			{
+				throw framework::AssetLoadError((std::string("Failed to load baked spritesheet file '") + filename + "'.").c_str());
+			}
+		}
+
+		// try to load from baked file
+		bool SpriteSheet::TryLoadFromBaked(const char* filename)
+		{
+			// read file
+			std::ifstream file(filename, std::ios::binary | std::ios::ate);
+			if (!file.good())
+			{
+				BON_ELOG_CAT(Gfx, "Failed to open baked spritesheet file '%s'.", filename);
+				return false;
+			}
+			size_t size = (size_t)file.tellg();
+			file.seekg(0);
+			std::vector<uint64_t> data((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+			file.read((char*)data.data(), size);
+
+			// validate header
+			const char* raw = (const char*)data.data();
+			const BakedSpriteSheetHeader* header = (const BakedSpriteSheetHeader*)raw;
+			if (size < sizeof(BakedSpriteSheetHeader) || memcmp(header->Magic, BakedSpriteSheetMagic, sizeof(BakedSpriteSheetMagic)) != 0)
+			{
+				BON_ELOG_CAT(Gfx, "Invalid baked spritesheet file '%s': bad header.", filename);
+				return false;
+			}
+			if (header->Version != BakedSpriteSheetVersion)
+			{
+				BON_ELOG_CAT(Gfx, "Invalid baked spritesheet file '%s': unsupported version %d (expected %d).", filename, header->Version, BakedSpriteSheetVersion);
+				return false;
+			}
+
+			// validate tables size
+			uint64_t expectedSize = sizeof(BakedSpriteSheetHeader) +
+				(uint64_t)header->AnimationsCount * sizeof(BakedSpriteSheetAnimation) +
+				(uint64_t)header->FramesCount * sizeof(BakedSpriteSheetFrame) +
+				(uint64_t)header->BookmarksCount * sizeof(BakedSpriteSheetBookmark) +
+				header->StringsSize;
+			if (expectedSize != size || header->SpritesCountX <= 0 || header->SpritesCountY <= 0 ||
+				(header->StringsSize > 0 && raw[size - 1] != '\0'))
+			{
+				BON_ELOG_CAT(Gfx, "Invalid baked spritesheet file '%s': corrupted tables.", filename);
+				return false;
+			}
+
+			// get tables
+			const BakedSpriteSheetAnimation* animations = (const BakedSpriteSheetAnimation*)(raw + sizeof(BakedSpriteSheetHeader));
+			const BakedSpriteSheetFrame* frames = (const BakedSpriteSheetFrame*)(animations + header->AnimationsCount);
+			const BakedSpriteSheetBookmark* bookmarks = (const BakedSpriteSheetBookmark*)(frames + header->FramesCount);
+			const char* strings = (const char*)(bookmarks + header->BookmarksCount);
+
+			// validate entries (animations without steps are valid and have no frames)
+			for (uint32_t i = 0; i < header->AnimationsCount; ++i)
+			{
+				const BakedSpriteSheetAnimation& animation = animations[i];
+				if (animation.NameOffset >= header->StringsSize ||
+					(uint64_t)animation.FirstFrame + animation.FramesCount > header->FramesCount)
+				{
+					BON_ELOG_CAT(Gfx, "Invalid baked spritesheet file '%s': corrupted animation %d.", filename, i);
+					return false;
+				}
+			}
+			for (uint32_t i = 0; i < header->BookmarksCount; ++i)
+			{
+				if (bookmarks[i].NameOffset >= header->StringsSize)
+				{
+					BON_ELOG_CAT(Gfx, "Invalid baked spritesheet file '%s': corrupted bookmark %d.", filename, i);
+					return false;
+				}
+			}
+
+			// valid! set sprites count and clear previous animations and bookmarks
+			SpritesCount.Set(header->SpritesCountX, header->SpritesCountY);
+			_animations.clear();
+			_animationHandles.clear();
+			_animationsByHandle.clear();
+			_bookmarks.clear();
+
+			// copy frames directly into flat frames arrays
+			_frameIndices.resize(header->FramesCount);
+			_frameDurations.resize(header->FramesCount);
+			for (uint32_t i = 0; i < header->FramesCount; ++i)
+			{
+				_frameIndices[i].Set(frames[i].IndexX, frames[i].IndexY);
+				_frameDurations[i] = frames[i].Duration;
+			}
+
+			// create animations
+			_animationFrames.resize(header->AnimationsCount);
+			for (uint32_t i = 0; i < header->AnimationsCount; ++i)
+			{
+				const BakedSpriteSheetAnimation& baked = animations[i];
+				const char* name = strings + baked.NameOffset;
+				SpriteAnimationPtr animation(new SpriteAnimation(name));
+				animation->Repeats = baked.Repeats != 0;
+				for (uint32_t j = baked.FirstFrame; j < baked.FirstFrame + baked.FramesCount; ++j)
+				{
+					SpriteAnimationStep step;
+					step.Duration = frames[j].Duration;
+					step.Index.Set(frames[j].IndexX, frames[j].IndexY);
+					animation->AddStep(step);
+				}
+				_animations[name] = animation;
+				_animationHandles[name] = (AnimationHandle)i;
+				_animationsByHandle.push_back(animation);
+				_animationFrames[i] = { (int)baked.FirstFrame, (int)baked.FramesCount, animation->Repeats };
+			}
+			_frameRects.clear();
+			_frameRectsImageSize.Set(-1, -1);
+			_framesDirty = false;
+
+			// add bookmarks
+			for (uint32_t i = 0; i < header->BookmarksCount; ++i)
+			{
+				AddBookmark(strings + bookmarks[i].NameOffset, framework::PointI(bookmarks[i].IndexX, bookmarks[i].IndexY));
+			}
+
+			BON_DLOG_CAT(Gfx, "Loaded baked spritesheet '%s' (%d animations, %d frames, %d bookmarks).", filename, header->AnimationsCount, header->FramesCount, header->BookmarksCount);
+			return true;
+		}
+
+		// bake spritesheet into binary file
+		bool SpriteSheet::Bake(const char* filename) const
+		{
+			// make sure frames are up to date
+			RefreshIfReloaded();
+			if (_framesDirty) { BuildFrames(); }
+
+			// build strings block
+			std::vector<char> strings;
+			auto addString = [&strings](const std::string& str) {
+				uint32_t offset = (uint32_t)strings.size();
+				strings.insert(strings.end(), str.c_str(), str.c_str() + str.size() + 1);
+				return offset;
+			};
+
+			// build animations and frames tables
+			std::vector<BakedSpriteSheetAnimation> animations;
+			for (size_t i = 0; i < _animationsByHandle.size(); ++i)
+			{
+				BakedSpriteSheetAnimation animation;
+				animation.NameOffset = addString(_animationsByHandle[i]->Identifier());
+				animation.FirstFrame = (uint32_t)_animationFrames[i].First;
+				animation.FramesCount = (uint32_t)_animationFrames[i].Count;
+				animation.Repeats = _animationFrames[i].Repeats ? 1 : 0;
+				animations.push_back(animation);
+			}
+			std::vector<BakedSpriteSheetFrame> frames(_frameIndices.size());
+			for (size_t i = 0; i < _frameIndices.size(); ++i)
+			{
+				frames[i].IndexX = _frameIndices[i].X;
+				frames[i].IndexY = _frameIndices[i].Y;
+				frames[i].Duration = _frameDurations[i];
+			}
+
+			// build bookmarks table
+			std::vector<BakedSpriteSheetBookmark> bookmarks;
+			for (auto& bookmark : _bookmarks)
+			{
+				BakedSpriteSheetBookmark baked;
+				baked.NameOffset = addString(bookmark.first);
+				baked.IndexX = bookmark.second.X;
+				baked.IndexY = bookmark.second.Y;
+				bookmarks.push_back(baked);
+			}
+
+			// build header
+			BakedSpriteSheetHeader header;
+			memcpy(header.Magic, BakedSpriteSheetMagic, sizeof(BakedSpriteSheetMagic));
+			header.Version = BakedSpriteSheetVersion;
+			header.SpritesCountX = SpritesCount.X;
+			header.SpritesCountY = SpritesCount.Y;
+			header.AnimationsCount = (uint32_t)animations.size();
+			header.FramesCount = (uint32_t)frames.size();
+			header.BookmarksCount = (uint32_t)bookmarks.size();
+			header.StringsSize = (uint32_t)strings.size();
+
+			// write file
+			std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+			if (!file.good())
+			{
+				BON_ELOG_CAT(Gfx, "Failed to open file '%s' to write baked spritesheet.", filename);
+				return false;
+			}
+			file.write((const char*)&header, sizeof(header));
+			file.write((const char*)animations.data(), animations.size() * sizeof(BakedSpriteSheetAnimation));
+			file.write((const char*)frames.data(), frames.size() * sizeof(BakedSpriteSheetFrame));
+			file.write((const char*)bookmarks.data(), bookmarks.size() * sizeof(BakedSpriteSheetBookmark));
+			file.write(strings.data(), strings.size());
+			BON_DLOG_CAT(Gfx, "Baked spritesheet to '%s'.", filename);
+			return file.good();
+		}
+
 		// add animation to spritesheet
 		void SpriteSheet::AddAnimation(SpriteAnimationPtr animation) 
 		{ 
+			// add animation, or replace existing animation with same id (replaced animation keeps its handle)
 			_animations[animation->Identifier()] = animation;
+			auto handle = _animationHandles.find(animation->Identifier());
+			if (handle != _animationHandles.end())
+			{
+				_animationsByHandle[handle->second] = animation;
+			}
+			else
+			{
+				_animationHandles[animation->Identifier()] = (AnimationHandle)_animationsByHandle.size();
+				_animationsByHandle.push_back(animation);
+			}
+			_framesDirty = true;
+		}
+
+		// get animation handle
+		AnimationHandle SpriteSheet::GetAnimationHandle(const char* animationId) const
+		{
+			RefreshIfReloaded();
+
+			// same animation as last lookup? skip building a string key and searching the map
+			AnimationHandle lastFound = _lastFoundAnimation.Value.load(std::memory_order_relaxed);
+			if (lastFound >= 0 && lastFound < (AnimationHandle)_animationsByHandle.size() &&
+				strcmp(_animationsByHandle[lastFound]->Identifier(), animationId) == 0)
+			{
+				return lastFound;
+			}
+
+			auto found = _animationHandles.find(animationId);
+			if (found == _animationHandles.end()) { return InvalidAnimationHandle; }
+			_lastFoundAnimation.Value.store(found->second, std::memory_order_relaxed);
+			return found->second;
+		}
+
+		// build flat frames arrays from animations
+		void SpriteSheet::BuildFrames() const
+		{
+			_animationFrames.clear();
+			_frameIndices.clear();
+			_frameDurations.clear();
+			for (auto& animation : _animationsByHandle)
+			{
+				AnimationFrames frames;
+				frames.First = (int)_frameIndices.size();
+				frames.Count = animation->StepsCount();
+				frames.Repeats = animation->Repeats;
+				_animationFrames.push_back(frames);
+				for (auto& step : animation->Steps())
+				{
+					_frameIndices.push_back(step.Index);
+					_frameDurations.push_back(step.Duration);
+				}
+			}
+
+			// force rebuilding rects
+			_frameRects.clear();
+			_frameRectsImageSize.Set(-1, -1);
+			_framesDirty = false;
+		}
+
+		// build frames source rects
+		void SpriteSheet::BuildFrameRects(const framework::PointI& imageSize) const
+		{
+			_frameRectsImageSize = imageSize;
+			_frameSize.Set(imageSize.X / SpritesCount.X, imageSize.Y / SpritesCount.Y);
+			_frameRects.resize(_frameIndices.size());
+			for (size_t i = 0; i < _frameIndices.size(); ++i)
+			{
+				_frameRects[i].Set(_frameIndices[i].X * _frameSize.X, _frameIndices[i].Y * _frameSize.Y, _frameSize.X, _frameSize.Y);
+			}
 		}
 
 		// create animation from config
@@ -106,6 +390,8 @@ namespace bon
 		// set sprite from sprite sheet
 		void SpriteSheet::SetSprite(Sprite& sprite, framework::PointI indexInSheet, float sizeFactor) const
 		{
+			RefreshIfReloaded();
+
 			// get size in texture
 			framework::PointI sizeInTexture(sprite.Image->Width() / SpritesCount.X, sprite.Image->Height() / SpritesCount.Y);
 
@@ -122,6 +408,7 @@ namespace bon
 		// set a sprite's source rectangle from index in spritesheet.
 		void SpriteSheet::SetSprite(Sprite& sprite, const char* bookmarkId, float sizeFactor) const
 		{
+			RefreshIfReloaded();
 			framework::PointI index = _bookmarks.at(std::string(bookmarkId));
 			SetSprite(sprite, index, sizeFactor);
 		}
@@ -185,8 +472,13 @@ namespace bon
 		// animate sprite
 		void SpriteSheet::Animate(Sprite& sprite, const char* animationId, double& progress, double deltaTime, int* currStep, bool* didFinish, float sizeFactor) const
 		{
-			// get animation
-			SpriteAnimationPtr animation = _animations.at(std::move(animationId));
+			// get animation by handle
+			AnimationHandle handle = GetAnimationHandle(animationId);
+			if (handle == InvalidAnimationHandle)
+			{
+				throw std::out_of_range("Animation not found in spritesheet!");
+			}
+			const SpriteAnimationPtr& animation = _animationsByHandle[handle];
 
 			// animate
 			framework::PointI index;
@@ -196,9 +488,63 @@ namespace bon
 			SetSprite(sprite, index, sizeFactor);
 		}
 
+		// animate sprite using handle and state
+		bool SpriteSheet::Animate(Sprite& sprite, AnimationState& state, double deltaTime, float sizeFactor) const
+		{
+			// rebuild frames data if animations changed
+			RefreshIfReloaded();
+			if (_framesDirty) { BuildFrames(); }
+
+			// get animation frames
+			if (state.Animation < 0 || state.Animation >= (AnimationHandle)_animationFrames.size())
+			{
+				throw framework::InvalidValue("Invalid animation handle!");
+			}
+			const AnimationFrames& frames = _animationFrames[state.Animation];
+			if (frames.Count == 0)
+			{
+				throw framework::InvalidValue("Can't animate sprite using an animation without steps!");
+			}
+			if (state.Frame >= frames.Count) { state.Frame = frames.Count - 1; }
+
+			// advance animation
+			bool didFinish = false;
+			state.Elapsed += (float)deltaTime;
+			while (state.Elapsed >= _frameDurations[frames.First + state.Frame])
+			{
+				// last frame?
+				if (state.Frame == frames.Count - 1)
+				{
+					didFinish = true;
+					if (!frames.Repeats) { state.Elapsed = _frameDurations[frames.First + state.Frame]; break; }
+					state.Elapsed -= _frameDurations[frames.First + state.Frame];
+					state.Frame = 0;
+					if (_frameDurations[frames.First] <= 0.0f) { break; }
+					continue;
+				}
+
+				// next frame
+				state.Elapsed -= _frameDurations[frames.First + state.Frame];
+				state.Frame++;
+			}
+
+			// update frame rects if image size changed
+			framework::PointI imageSize(sprite.Image->Width(), sprite.Image->Height());
+			if (imageSize.X != _frameRectsImageSize.X || imageSize.Y != _frameRectsImageSize.Y) { BuildFrameRects(imageSize); }
+
+			// set source rect and size
+			sprite.SourceRect = _frameRects[frames.First + state.Frame];
+			if (sizeFactor != 0.0f)
+			{
+				sprite.Size.Set((int)(_frameSize.X * sizeFactor), (int)(_frameSize.Y * sizeFactor));
+			}
+			return didFinish;
+		}
+
 		// get animation by identifier
 		SpriteAnimationPtr SpriteSheet::GetAnimation(const char* identifier)
 		{
+			RefreshIfReloaded();
 			return (_animations)[identifier];
 		}
 
@@ -211,19 +557,33 @@ namespace bon
 		// get bookmark value
 		framework::PointI SpriteSheet::GetBookmark(const char* bookmarkId) const
 		{
+			RefreshIfReloaded();
 			return _bookmarks.at(bookmarkId);
 		}
 
 		// get if animation id exists.
 		bool SpriteSheet::ContainsAnimation(const char* animationId) const
 		{
+			RefreshIfReloaded();
 			return _animations.find(animationId) != _animations.end();
 		}
 
 		// get if bookmark id exists.
 		bool SpriteSheet::ContainsBookmark(const char* bookmarkId) const
 		{
+			RefreshIfReloaded();
 			return _bookmarks.find(bookmarkId) != _bookmarks.end();
 		}
+
+		// reload if config was hot-reloaded
+		void SpriteSheet::RefreshIfReloaded() const
+		{
+			if (_config && _config->ReloadCount() != _configReloadCount)
+			{
+				SpriteSheet* self = const_cast<SpriteSheet*>(this);
+				self->_bookmarks.clear();
+				self->LoadFromConfig(_config);
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -1,266 +1,383 @@
-#include <unordered_map>
-#include <string>
 #include <Input/Defs.h>
+#include <cstdint>
 
 namespace bon
 {
 	namespace input
 	{
+		// a key code and its name
+		struct KeyCodeName
+		{
+			KeyCodes Code;
+			const char* Name;
+		};
+
+		// all key codes names, by key code value
+#define BON_KEY_NAME(name) { KeyCodes::name, #name }
+		constexpr KeyCodeName KeyCodesNames[] = 
+		{
+			BON_KEY_NAME(KeyUnknown),
+			BON_KEY_NAME(KeyReturn),
+			BON_KEY_NAME(KeyEscape),
+			BON_KEY_NAME(KeyBackspace),
+			BON_KEY_NAME(KeyTab),
+			BON_KEY_NAME(KeySpace),
+			BON_KEY_NAME(KeyExclaim),
+			BON_KEY_NAME(KeyQuotedbl),
+			BON_KEY_NAME(KeyHash),
+			BON_KEY_NAME(KeyPercent),
+			BON_KEY_NAME(KeyDollar),
+			BON_KEY_NAME(KeyAmpersand),
+			BON_KEY_NAME(KeyQuote),
+			BON_KEY_NAME(KeyLeftparen),
+			BON_KEY_NAME(KeyRightparen),
+			BON_KEY_NAME(KeyAsterisk),
+			BON_KEY_NAME(KeyPlus),
+			BON_KEY_NAME(KeyComma),
+			BON_KEY_NAME(KeyMinus),
+			BON_KEY_NAME(KeyPeriod),
+			BON_KEY_NAME(KeySlash),
+			BON_KEY_NAME(Key0),
+			BON_KEY_NAME(Key1),
+			BON_KEY_NAME(Key2),
+			BON_KEY_NAME(Key3),
+			BON_KEY_NAME(Key4),
+			BON_KEY_NAME(Key5),
+			BON_KEY_NAME(Key6),
+			BON_KEY_NAME(Key7),
+			BON_KEY_NAME(Key8),
+			BON_KEY_NAME(Key9),
+			BON_KEY_NAME(KeyColon),
+			BON_KEY_NAME(KeySemicolon),
+			BON_KEY_NAME(KeyLess),
+			BON_KEY_NAME(KeyEquals),
+			BON_KEY_NAME(KeyGreater),
+			BON_KEY_NAME(KeyQuestion),
+			BON_KEY_NAME(KeyAt),
+			BON_KEY_NAME(KeyLeftbracket),
+			BON_KEY_NAME(KeyBackslash),
+			BON_KEY_NAME(KeyRightbracket),
+			BON_KEY_NAME(KeyCaret),
+			BON_KEY_NAME(KeyUnderscore),
+			BON_KEY_NAME(KeyBackquote),
+			BON_KEY_NAME(KeyA),
+			BON_KEY_NAME(KeyB),
+			BON_KEY_NAME(KeyC),
+			BON_KEY_NAME(KeyD),
+			BON_KEY_NAME(KeyE),
+			BON_KEY_NAME(KeyF),
+			BON_KEY_NAME(KeyG),
+			BON_KEY_NAME(KeyH),
+			BON_KEY_NAME(KeyI),
+			BON_KEY_NAME(KeyJ),
+			BON_KEY_NAME(KeyK),
+			BON_KEY_NAME(KeyL),
+			BON_KEY_NAME(KeyM),
+			BON_KEY_NAME(KeyN),
+			BON_KEY_NAME(KeyO),
+			BON_KEY_NAME(KeyP),
+			BON_KEY_NAME(KeyQ),
+			BON_KEY_NAME(KeyR),
+			BON_KEY_NAME(KeyS),
+			BON_KEY_NAME(KeyT),
+			BON_KEY_NAME(KeyU),
+			BON_KEY_NAME(KeyV),
+			BON_KEY_NAME(KeyW),
+			BON_KEY_NAME(KeyX),
+			BON_KEY_NAME(KeyY),
+			BON_KEY_NAME(KeyZ),
+			BON_KEY_NAME(KeyCapslock),
+			BON_KEY_NAME(KeyF1),
+			BON_KEY_NAME(KeyF2),
+			BON_KEY_NAME(KeyF3),
+			BON_KEY_NAME(KeyF4),
+			BON_KEY_NAME(KeyF5),
+			BON_KEY_NAME(KeyF6),
+			BON_KEY_NAME(KeyF7),
+			BON_KEY_NAME(KeyF8),
+			BON_KEY_NAME(KeyF9),
+			BON_KEY_NAME(KeyF10),
+			BON_KEY_NAME(KeyF11),
+			BON_KEY_NAME(KeyF12),
+			BON_KEY_NAME(KeyPrintscreen),
+			BON_KEY_NAME(KeyScrolllock),
+			BON_KEY_NAME(KeyPause),
+			BON_KEY_NAME(KeyInsert),
+			BON_KEY_NAME(KeyHome),
+			BON_KEY_NAME(KeyPageup),
+			BON_KEY_NAME(KeyDelete),
+			BON_KEY_NAME(KeyEnd),
+			BON_KEY_NAME(KeyPagedown),
+			BON_KEY_NAME(KeyRight),
+			BON_KEY_NAME(KeyLeft),
+			BON_KEY_NAME(KeyDown),
+			BON_KEY_NAME(KeyUp),
+			BON_KEY_NAME(KeyNumlockclear),
+			BON_KEY_NAME(KeyKpDivide),
+			BON_KEY_NAME(KeyKpMultiply),
+			BON_KEY_NAME(KeyKpMinus),
+			BON_KEY_NAME(KeyKpPlus),
+			BON_KEY_NAME(KeyKpEnter),
+			BON_KEY_NAME(KeyKp1),
+			BON_KEY_NAME(KeyKp2),
+			BON_KEY_NAME(KeyKp3),
+			BON_KEY_NAME(KeyKp4),
+			BON_KEY_NAME(KeyKp5),
+			BON_KEY_NAME(KeyKp6),
+			BON_KEY_NAME(KeyKp7),
+			BON_KEY_NAME(KeyKp8),
+			BON_KEY_NAME(KeyKp9),
+			BON_KEY_NAME(KeyKp0),
+			BON_KEY_NAME(KeyKpPeriod),
+			BON_KEY_NAME(KeyApplication),
+			BON_KEY_NAME(KeyPower),
+			BON_KEY_NAME(KeyKpEquals),
+			BON_KEY_NAME(KeyF13),
+			BON_KEY_NAME(KeyF14),
+			BON_KEY_NAME(KeyF15),
+			BON_KEY_NAME(KeyF16),
+			BON_KEY_NAME(KeyF17),
+			BON_KEY_NAME(KeyF18),
+			BON_KEY_NAME(KeyF19),
+			BON_KEY_NAME(KeyF20),
+			BON_KEY_NAME(KeyF21),
+			BON_KEY_NAME(KeyF22),
+			BON_KEY_NAME(KeyF23),
+			BON_KEY_NAME(KeyF24),
+			BON_KEY_NAME(KeyExecute),
+			BON_KEY_NAME(KeyHelp),
+			BON_KEY_NAME(KeyMenu),
+			BON_KEY_NAME(KeySelect),
+			BON_KEY_NAME(KeyStop),
+			BON_KEY_NAME(KeyAgain),
+			BON_KEY_NAME(KeyUndo),
+			BON_KEY_NAME(KeyCut),
+			BON_KEY_NAME(KeyCopy),
+			BON_KEY_NAME(KeyPaste),
+			BON_KEY_NAME(KeyFind),
+			BON_KEY_NAME(KeyMute),
+			BON_KEY_NAME(KeyVolumeup),
+			BON_KEY_NAME(KeyVolumedown),
+			BON_KEY_NAME(KeyKpComma),
+			BON_KEY_NAME(KeyKpEqualsas400),
+			BON_KEY_NAME(KeyAlterase),
+			BON_KEY_NAME(KeySysreq),
+			BON_KEY_NAME(KeyCancel),
+			BON_KEY_NAME(KeyClear),
+			BON_KEY_NAME(KeyPrior),
+			BON_KEY_NAME(KeyReturn2),
+			BON_KEY_NAME(KeySeparator),
+			BON_KEY_NAME(KeyOut),
+			BON_KEY_NAME(KeyOper),
+			BON_KEY_NAME(KeyClearagain),
+			BON_KEY_NAME(KeyCrsel),
+			BON_KEY_NAME(KeyExsel),
+			BON_KEY_NAME(KeyKp00),
+			BON_KEY_NAME(KeyKp000),
+			BON_KEY_NAME(KeyThousandsseparator),
+			BON_KEY_NAME(KeyDecimalseparator),
+			BON_KEY_NAME(KeyCurrencyunit),
+			BON_KEY_NAME(KeyCurrencysubunit),
+			BON_KEY_NAME(KeyKpLeftparen),
+			BON_KEY_NAME(KeyKpRightparen),
+			BON_KEY_NAME(KeyKpLeftbrace),
+			BON_KEY_NAME(KeyKpRightbrace),
+			BON_KEY_NAME(KeyKpTab),
+			BON_KEY_NAME(KeyKpBackspace),
+			BON_KEY_NAME(KeyKpA),
+			BON_KEY_NAME(KeyKpB),
+			BON_KEY_NAME(KeyKpC),
+			BON_KEY_NAME(KeyKpD),
+			BON_KEY_NAME(KeyKpE),
+			BON_KEY_NAME(KeyKpF),
+			BON_KEY_NAME(KeyKpXor),
+			BON_KEY_NAME(KeyKpPower),
+			BON_KEY_NAME(KeyKpPercent),
+			BON_KEY_NAME(KeyKpLess),
+			BON_KEY_NAME(KeyKpGreater),
+			BON_KEY_NAME(KeyKpAmpersand),
+			BON_KEY_NAME(KeyKpDblampersand),
+			BON_KEY_NAME(KeyKpVerticalbar),
+			BON_KEY_NAME(KeyKpDblverticalbar),
+			BON_KEY_NAME(KeyKpColon),
+			BON_KEY_NAME(KeyKpHash),
+			BON_KEY_NAME(KeyKpSpace),
+			BON_KEY_NAME(KeyKpAt),
+			BON_KEY_NAME(KeyKpExclam),
+			BON_KEY_NAME(KeyKpMemstore),
+			BON_KEY_NAME(KeyKpMemrecall),
+			BON_KEY_NAME(KeyKpMemclear),
+			BON_KEY_NAME(KeyKpMemadd),
+			BON_KEY_NAME(KeyKpMemsubtract),
+			BON_KEY_NAME(KeyKpMemmultiply),
+			BON_KEY_NAME(KeyKpMemdivide),
+			BON_KEY_NAME(KeyKpPlusminus),
+			BON_KEY_NAME(KeyKpClear),
+			BON_KEY_NAME(KeyKpClearentry),
+			BON_KEY_NAME(KeyKpBinary),
+			BON_KEY_NAME(KeyKpOctal),
+			BON_KEY_NAME(KeyKpDecimal),
+			BON_KEY_NAME(KeyKpHexadecimal),
+			BON_KEY_NAME(KeyLctrl),
+			BON_KEY_NAME(KeyLshift),
+			BON_KEY_NAME(KeyLalt),
+			BON_KEY_NAME(KeyLgui),
+			BON_KEY_NAME(KeyRctrl),
+			BON_KEY_NAME(KeyRshift),
+			BON_KEY_NAME(KeyRalt),
+			BON_KEY_NAME(KeyRgui),
+			BON_KEY_NAME(KeyMode),
+			BON_KEY_NAME(KeyAudionext),
+			BON_KEY_NAME(KeyAudioprev),
+			BON_KEY_NAME(KeyAudiostop),
+			BON_KEY_NAME(KeyAudioplay),
+			BON_KEY_NAME(KeyAudiomute),
+			BON_KEY_NAME(KeyMediaselect),
+			BON_KEY_NAME(KeyWww),
+			BON_KEY_NAME(KeyMail),
+			BON_KEY_NAME(KeyCalculator),
+			BON_KEY_NAME(KeyComputer),
+			BON_KEY_NAME(KeyAcSearch),
+			BON_KEY_NAME(KeyAcHome),
+			BON_KEY_NAME(KeyAcBack),
+			BON_KEY_NAME(KeyAcForward),
+			BON_KEY_NAME(KeyAcStop),
+			BON_KEY_NAME(KeyAcRefresh),
+			BON_KEY_NAME(KeyAcBookmarks),
+			BON_KEY_NAME(KeyBrightnessdown),
+			BON_KEY_NAME(KeyBrightnessup),
+			BON_KEY_NAME(KeyDisplayswitch),
+			BON_KEY_NAME(KeyKbdillumtoggle),
+			BON_KEY_NAME(KeyKbdillumdown),
+			BON_KEY_NAME(KeyKbdillumup),
+			BON_KEY_NAME(KeyEject),
+			BON_KEY_NAME(KeySleep),
+			BON_KEY_NAME(KeyApp1),
+			BON_KEY_NAME(KeyApp2),
+			BON_KEY_NAME(KeyAudiorewind),
+			BON_KEY_NAME(KeyAudiofastforward),
+			BON_KEY_NAME(MouseLeft),
+			BON_KEY_NAME(MouseMiddle),
+			BON_KEY_NAME(MouseRight),
+			BON_KEY_NAME(MouseX1),
+			BON_KEY_NAME(MouseX2),
+			BON_KEY_NAME(GamepadA),
+			BON_KEY_NAME(GamepadB),
+			BON_KEY_NAME(GamepadX),
+			BON_KEY_NAME(GamepadY),
+			BON_KEY_NAME(GamepadBack),
+			BON_KEY_NAME(GamepadGuide),
+			BON_KEY_NAME(GamepadStart),
+			BON_KEY_NAME(GamepadLeftStick),
+			BON_KEY_NAME(GamepadRightStick),
+			BON_KEY_NAME(GamepadLeftShoulder),
+			BON_KEY_NAME(GamepadRightShoulder),
+			BON_KEY_NAME(GamepadDpadUp),
+			BON_KEY_NAME(GamepadDpadDown),
+			BON_KEY_NAME(GamepadDpadLeft),
+			BON_KEY_NAME(GamepadDpadRight),
+			BON_KEY_NAME(GamepadLeftTrigger),
+			BON_KEY_NAME(GamepadRightTrigger),
+		};
+#undef BON_KEY_NAME
+
+		// names perfect hash table size (must be power of 2) and number of buckets
+		const uint32_t KeyNamesSlotsCount = 512;
+		const uint32_t KeyNamesBucketsCount = 128;
+
+		// names perfect hash table: bucket displacements, and key code in every slot (-1 = empty)
+		struct KeyNamesTable
+		{
+			uint32_t Displacements[KeyNamesBucketsCount];
+			int16_t Slots[KeyNamesSlotsCount];
+		};
+
+		// hash a key name (FNV-1a with seed)
+		constexpr uint32_t HashKeyName(const char* str, uint32_t seed)
+		{
+			uint32_t hash = 2166136261u ^ (seed * 16777619u);
+			for (; *str; ++str) {
+				hash = (hash ^ (uint8_t)*str) * 16777619u;
+			}
+			return hash ^ (hash >> 15);
+		}
+
+		// compare two key names
+		constexpr bool KeyNamesEqual(const char* a, const char* b)
+		{
+			for (; *a && *a == *b; ++a, ++b) {}
+			return *a == *b;
+		}
+
+		// names perfect hash table, generated offline since searching for displacements at compile time takes too many constexpr steps.
+		// after changing key codes, run create_key_names_table.py to regenerate it (ValidateKeyCodesNames() below fails if it's out of date).
+		// generated by create_key_names_table.py - begin
+		constexpr KeyNamesTable KeyNames =
+		{
+			{
+				0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 4, 1, 1, 2, 0,
+				6, 2, 2, 1, 2, 2, 4, 1, 2, 0, 1, 1, 0, 1, 2, 1,
+				1, 6, 2, 0, 1, 0, 4, 1, 3, 2, 1, 3, 1, 1, 2, 1,
+				0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 2, 6, 0, 1, 1,
+				1, 5, 0, 2, 2, 0, 1, 2, 1, 4, 4, 1, 2, 6, 1, 4,
+				1, 0, 1, 2, 4, 3, 0, 1, 3, 1, 1, 2, 1, 1, 1, 5,
+				2, 1, 1, 0, 2, 3, 4, 1, 0, 4, 1, 0, 1, 1, 3, 0,
+				9, 2, 1, 1, 1, 2, 0, 1, 4, 1, 2, 1, 3, 1, 0, 1,
+			},
+			{
+				-1, -1, 226, 16, -1, 224, 206, -1, -1, -1, -1, -1, 189, -1, -1, 100, 144, 19, -1, -1, -1, 18, 254, 116, -1, 132, -1, -1, 2, 222, 25, 91,
+				239, -1, 71, -1, 62, 246, -1, -1, -1, 139, 169, -1, -1, 98, -1, 260, 128, -1, 158, -1, -1, 203, 184, 90, -1, 103, 77, 88, 92, -1, -1, -1,
+				-1, -1, -1, -1, -1, 216, -1, 20, -1, 114, 29, 150, -1, -1, 4, 47, 221, 69, -1, 172, -1, -1, -1, 49, 228, 166, -1, 156, -1, 199, -1, 12,
+				-1, 101, -1, 56, -1, 74, -1, -1, -1, -1, -1, 28, -1, 207, 46, -1, 60, 157, 255, 261, 107, 227, -1, -1, 66, -1, 204, -1, -1, -1, 81, 109,
+				167, -1, -1, -1, -1, -1, 73, 108, 110, 89, 70, 8, 11, -1, 40, -1, -1, 185, -1, 231, 3, -1, 178, 186, -1, 154, -1, -1, 153, 141, 102, -1,
+				-1, 201, 209, -1, 202, 76, -1, 190, 96, 115, -1, 120, 64, 213, 220, 134, -1, 59, 118, 85, -1, -1, 200, 50, -1, 229, 149, 51, -1, -1, -1, 42,
+				94, -1, 249, 233, 27, 135, 251, 41, 21, -1, -1, 212, -1, 215, -1, 38, -1, 78, 214, 179, 183, -1, -1, -1, 113, 188, -1, 127, 236, -1, -1, -1,
+				-1, -1, -1, 248, -1, 197, 122, 111, -1, -1, -1, -1, 143, 87, 165, 259, -1, 105, 52, 205, 124, -1, 75, -1, 142, 45, 26, 235, 9, 151, -1, 119,
+				-1, 6, -1, 171, 182, -1, -1, -1, 146, -1, -1, 13, -1, -1, 181, -1, 140, 67, 217, 160, -1, 86, 164, -1, 68, 192, -1, -1, -1, -1, -1, -1,
+				177, -1, 79, 35, -1, 159, -1, -1, -1, 241, -1, -1, -1, 17, 37, -1, -1, -1, 131, -1, -1, -1, -1, -1, -1, -1, 218, -1, 112, 125, -1, 63,
+				-1, 232, 58, -1, 243, -1, -1, 93, -1, -1, 234, 10, 5, -1, -1, 133, 137, 22, 145, -1, -1, -1, 175, 136, -1, -1, 180, -1, 198, -1, -1, -1,
+				121, 53, -1, 168, -1, -1, 7, -1, 83, -1, 196, 152, 240, 194, -1, -1, 230, 43, 95, -1, -1, -1, 1, 250, -1, -1, 39, -1, -1, 138, -1, 129,
+				44, 155, 31, -1, -1, -1, 247, -1, 238, -1, 195, 245, 211, 163, -1, -1, 0, -1, 126, 162, -1, -1, 106, -1, 208, -1, -1, -1, 147, -1, -1, -1,
+				161, -1, 193, 34, -1, -1, -1, -1, -1, 61, 258, -1, 23, -1, 80, -1, -1, 130, 55, -1, 15, -1, -1, -1, 104, 72, 36, 257, 176, 210, 191, 14,
+				97, 174, -1, -1, -1, -1, 242, 253, -1, -1, -1, -1, -1, 54, 33, 223, 170, -1, -1, 24, 148, 256, -1, -1, -1, 244, -1, -1, 99, 57, -1, -1,
+				225, -1, 117, -1, -1, 65, -1, -1, 219, -1, 173, 82, -1, -1, -1, -1, -1, 123, -1, 32, 237, -1, -1, -1, -1, 30, 187, -1, 48, 84, 252, -1,
+			},
+		};
+		// generated by create_key_names_table.py - end
+
+		// find key code by name
+		constexpr KeyCodes FindKeyCode(const char* name)
+		{
+			uint32_t displacement = KeyNames.Displacements[HashKeyName(name, 0) % KeyNamesBucketsCount];
+			int16_t index = KeyNames.Slots[HashKeyName(name, displacement) & (KeyNamesSlotsCount - 1)];
+			return (index != -1 && KeyNamesEqual(KeyCodesNames[index].Name, name)) ? KeyCodesNames[index].Code : KeyCodes::KeyUnknown;
+		}
+
+		// make sure names table covers all key codes in order, and that every key code round-trips through its name.
+		// note: this costs a few hundred thousand constexpr steps, above MSVC's default - BonEngine.vcxproj raises it with /constexpr:steps.
+		constexpr bool ValidateKeyCodesNames()
+		{
+			for (int i = 0; i < KeyCodesCount; ++i)
+			{
+				if ((int)KeyCodesNames[i].Code != i || (int)FindKeyCode(KeyCodesNames[i].Name) != i) {
+					return false;
+				}
+			}
+			return true;
+		}
+		static_assert(sizeof(KeyCodesNames) / sizeof(KeyCodesNames[0]) == KeyCodesCount, "Key codes names table must cover all key codes.");
+		static_assert(ValidateKeyCodesNames(), "Key codes names table is out of order, or key codes don't round-trip through their names.");
+
 		// convert string to key code
 		KeyCodes _StrToKeyCode(const char* str)
 		{
-			// init conversion map on first call
-			static std::unordered_map<std::string, KeyCodes> strToCode;
-			if (strToCode.empty()) {
-				strToCode["KeyUnknown"] = KeyCodes::KeyUnknown;
-				strToCode["KeyReturn"] = KeyCodes::KeyReturn;
-				strToCode["KeyEscape"] = KeyCodes::KeyEscape;
-				strToCode["KeyBackspace"] = KeyCodes::KeyBackspace;
-				strToCode["KeyTab"] = KeyCodes::KeyTab;
-				strToCode["KeySpace"] = KeyCodes::KeySpace;
-				strToCode["KeyExclaim"] = KeyCodes::KeyExclaim;
-				strToCode["KeyQuotedbl"] = KeyCodes::KeyQuotedbl;
-				strToCode["KeyHash"] = KeyCodes::KeyHash;
-				strToCode["KeyPercent"] = KeyCodes::KeyPercent;
-				strToCode["KeyDollar"] = KeyCodes::KeyDollar;
-				strToCode["KeyAmpersand"] = KeyCodes::KeyAmpersand;
-				strToCode["KeyQuote"] = KeyCodes::KeyQuote;
-				strToCode["KeyLeftparen"] = KeyCodes::KeyLeftparen;
-				strToCode["KeyRightparen"] = KeyCodes::KeyRightparen;
-				strToCode["KeyAsterisk"] = KeyCodes::KeyAsterisk;
-				strToCode["KeyPlus"] = KeyCodes::KeyPlus;
-				strToCode["KeyComma"] = KeyCodes::KeyComma;
-				strToCode["KeyMinus"] = KeyCodes::KeyMinus;
-				strToCode["KeyPeriod"] = KeyCodes::KeyPeriod;
-				strToCode["KeySlash"] = KeyCodes::KeySlash;
-				strToCode["Key0"] = KeyCodes::Key0;
-				strToCode["Key1"] = KeyCodes::Key1;
-				strToCode["Key2"] = KeyCodes::Key2;
-				strToCode["Key3"] = KeyCodes::Key3;
-				strToCode["Key4"] = KeyCodes::Key4;
-				strToCode["Key5"] = KeyCodes::Key5;
-				strToCode["Key6"] = KeyCodes::Key6;
-				strToCode["Key7"] = KeyCodes::Key7;
-				strToCode["Key8"] = KeyCodes::Key8;
-				strToCode["Key9"] = KeyCodes::Key9;
-				strToCode["KeyColon"] = KeyCodes::KeyColon;
-				strToCode["KeySemicolon"] = KeyCodes::KeySemicolon;
-				strToCode["KeyLess"] = KeyCodes::KeyLess;
-				strToCode["KeyEquals"] = KeyCodes::KeyEquals;
-				strToCode["KeyGreater"] = KeyCodes::KeyGreater;
-				strToCode["KeyQuestion"] = KeyCodes::KeyQuestion;
-				strToCode["KeyAt"] = KeyCodes::KeyAt;
-				strToCode["KeyLeftbracket"] = KeyCodes::KeyLeftbracket;
-				strToCode["KeyBackslash"] = KeyCodes::KeyBackslash;
-				strToCode["KeyRightbracket"] = KeyCodes::KeyRightbracket;
-				strToCode["KeyCaret"] = KeyCodes::KeyCaret;
-				strToCode["KeyUnderscore"] = KeyCodes::KeyUnderscore;
-				strToCode["KeyBackquote"] = KeyCodes::KeyBackquote;
-				strToCode["KeyA"] = KeyCodes::KeyA;
-				strToCode["KeyB"] = KeyCodes::KeyB;
-				strToCode["KeyC"] = KeyCodes::KeyC;
-				strToCode["KeyD"] = KeyCodes::KeyD;
-				strToCode["KeyE"] = KeyCodes::KeyE;
-				strToCode["KeyF"] = KeyCodes::KeyF;
-				strToCode["KeyG"] = KeyCodes::KeyG;
-				strToCode["KeyH"] = KeyCodes::KeyH;
-				strToCode["KeyI"] = KeyCodes::KeyI;
-				strToCode["KeyJ"] = KeyCodes::KeyJ;
-				strToCode["KeyK"] = KeyCodes::KeyK;
-				strToCode["KeyL"] = KeyCodes::KeyL;
-				strToCode["KeyM"] = KeyCodes::KeyM;
-				strToCode["KeyN"] = KeyCodes::KeyN;
-				strToCode["KeyO"] = KeyCodes::KeyO;
-				strToCode["KeyP"] = KeyCodes::KeyP;
-				strToCode["KeyQ"] = KeyCodes::KeyQ;
-				strToCode["KeyR"] = KeyCodes::KeyR;
-				strToCode["KeyS"] = KeyCodes::KeyS;
-				strToCode["KeyT"] = KeyCodes::KeyT;
-				strToCode["KeyU"] = KeyCodes::KeyU;
-				strToCode["KeyV"] = KeyCodes::KeyV;
-				strToCode["KeyW"] = KeyCodes::KeyW;
-				strToCode["KeyX"] = KeyCodes::KeyX;
-				strToCode["KeyY"] = KeyCodes::KeyY;
-				strToCode["KeyZ"] = KeyCodes::KeyZ;
-				strToCode["KeyCapslock"] = KeyCodes::KeyCapslock;
-				strToCode["KeyF1"] = KeyCodes::KeyF1;
-				strToCode["KeyF2"] = KeyCodes::KeyF2;
-				strToCode["KeyF3"] = KeyCodes::KeyF3;
-				strToCode["KeyF4"] = KeyCodes::KeyF4;
-				strToCode["KeyF5"] = KeyCodes::KeyF5;
-				strToCode["KeyF6"] = KeyCodes::KeyF6;
-				strToCode["KeyF7"] = KeyCodes::KeyF7;
-				strToCode["KeyF8"] = KeyCodes::KeyF8;
-				strToCode["KeyF9"] = KeyCodes::KeyF9;
-				strToCode["KeyF10"] = KeyCodes::KeyF10;
-				strToCode["KeyF11"] = KeyCodes::KeyF11;
-				strToCode["KeyF12"] = KeyCodes::KeyF12;
-				strToCode["KeyPrintscreen"] = KeyCodes::KeyPrintscreen;
-				strToCode["KeyScrolllock"] = KeyCodes::KeyScrolllock;
-				strToCode["KeyPause"] = KeyCodes::KeyPause;
-				strToCode["KeyInsert"] = KeyCodes::KeyInsert;
-				strToCode["KeyHome"] = KeyCodes::KeyHome;
-				strToCode["KeyPageup"] = KeyCodes::KeyPageup;
-				strToCode["KeyDelete"] = KeyCodes::KeyDelete;
-				strToCode["KeyEnd"] = KeyCodes::KeyEnd;
-				strToCode["KeyPagedown"] = KeyCodes::KeyPagedown;
-				strToCode["KeyRight"] = KeyCodes::KeyRight;
-				strToCode["KeyLeft"] = KeyCodes::KeyLeft;
-				strToCode["KeyDown"] = KeyCodes::KeyDown;
-				strToCode["KeyUp"] = KeyCodes::KeyUp;
-				strToCode["KeyNumlockclear"] = KeyCodes::KeyNumlockclear;
-				strToCode["KeyKpDivide"] = KeyCodes::KeyKpDivide;
-				strToCode["KeyKpMultiply"] = KeyCodes::KeyKpMultiply;
-				strToCode["KeyKpMinus"] = KeyCodes::KeyKpMinus;
-				strToCode["KeyKpPlus"] = KeyCodes::KeyKpPlus;
-				strToCode["KeyKpEnter"] = KeyCodes::KeyKpEnter;
-				strToCode["KeyKp1"] = KeyCodes::KeyKp1;
-				strToCode["KeyKp2"] = KeyCodes::KeyKp2;
-				strToCode["KeyKp3"] = KeyCodes::KeyKp3;
-				strToCode["KeyKp4"] = KeyCodes::KeyKp4;
-				strToCode["KeyKp5"] = KeyCodes::KeyKp5;
-				strToCode["KeyKp6"] = KeyCodes::KeyKp6;
-				strToCode["KeyKp7"] = KeyCodes::KeyKp7;
-				strToCode["KeyKp8"] = KeyCodes::KeyKp8;
-				strToCode["KeyKp9"] = KeyCodes::KeyKp9;
-				strToCode["KeyKp0"] = KeyCodes::KeyKp0;
-				strToCode["KeyKpPeriod"] = KeyCodes::KeyKpPeriod;
-				strToCode["KeyApplication"] = KeyCodes::KeyApplication;
-				strToCode["KeyPower"] = KeyCodes::KeyPower;
-				strToCode["KeyKpEquals"] = KeyCodes::KeyKpEquals;
-				strToCode["KeyF13"] = KeyCodes::KeyF13;
-				strToCode["KeyF14"] = KeyCodes::KeyF14;
-				strToCode["KeyF15"] = KeyCodes::KeyF15;
-				strToCode["KeyF16"] = KeyCodes::KeyF16;
-				strToCode["KeyF17"] = KeyCodes::KeyF17;
-				strToCode["KeyF18"] = KeyCodes::KeyF18;
-				strToCode["KeyF19"] = KeyCodes::KeyF19;
-				strToCode["KeyF20"] = KeyCodes::KeyF20;
-				strToCode["KeyF21"] = KeyCodes::KeyF21;
-				strToCode["KeyF22"] = KeyCodes::KeyF22;
-				strToCode["KeyF23"] = KeyCodes::KeyF23;
-				strToCode["KeyF24"] = KeyCodes::KeyF24;
-				strToCode["KeyExecute"] = KeyCodes::KeyExecute;
-				strToCode["KeyHelp"] = KeyCodes::KeyHelp;
-				strToCode["KeyMenu"] = KeyCodes::KeyMenu;
-				strToCode["KeySelect"] = KeyCodes::KeySelect;
-				strToCode["KeyStop"] = KeyCodes::KeyStop;
-				strToCode["KeyAgain"] = KeyCodes::KeyAgain;
-				strToCode["KeyUndo"] = KeyCodes::KeyUndo;
-				strToCode["KeyCut"] = KeyCodes::KeyCut;
-				strToCode["KeyCopy"] = KeyCodes::KeyCopy;
-				strToCode["KeyPaste"] = KeyCodes::KeyPaste;
-				strToCode["KeyFind"] = KeyCodes::KeyFind;
-				strToCode["KeyMute"] = KeyCodes::KeyMute;
-				strToCode["KeyVolumeup"] = KeyCodes::KeyVolumeup;
-				strToCode["KeyVolumedown"] = KeyCodes::KeyVolumedown;
-				strToCode["KeyKpComma"] = KeyCodes::KeyKpComma;
-				strToCode["KeyKpEqualsas400"] = KeyCodes::KeyKpEqualsas400;
-				strToCode["KeyAlterase"] = KeyCodes::KeyAlterase;
-				strToCode["KeySysreq"] = KeyCodes::KeySysreq;
-				strToCode["KeyCancel"] = KeyCodes::KeyCancel;
-				strToCode["KeyClear"] = KeyCodes::KeyClear;
-				strToCode["KeyPrior"] = KeyCodes::KeyPrior;
-				strToCode["KeyReturn2"] = KeyCodes::KeyReturn2;
-				strToCode["KeySeparator"] = KeyCodes::KeySeparator;
-				strToCode["KeyOut"] = KeyCodes::KeyOut;
-				strToCode["KeyOper"] = KeyCodes::KeyOper;
-				strToCode["KeyClearagain"] = KeyCodes::KeyClearagain;
-				strToCode["KeyCrsel"] = KeyCodes::KeyCrsel;
-				strToCode["KeyExsel"] = KeyCodes::KeyExsel;
-				strToCode["KeyKp00"] = KeyCodes::KeyKp00;
-				strToCode["KeyKp000"] = KeyCodes::KeyKp000;
-				strToCode["KeyThousandsseparator"] = KeyCodes::KeyThousandsseparator;
-				strToCode["KeyDecimalseparator"] = KeyCodes::KeyDecimalseparator;
-				strToCode["KeyCurrencyunit"] = KeyCodes::KeyCurrencyunit;
-				strToCode["KeyCurrencysubunit"] = KeyCodes::KeyCurrencysubunit;
-				strToCode["KeyKpLeftparen"] = KeyCodes::KeyKpLeftparen;
-				strToCode["KeyKpRightparen"] = KeyCodes::KeyKpRightparen;
-				strToCode["KeyKpLeftbrace"] = KeyCodes::KeyKpLeftbrace;
-				strToCode["KeyKpRightbrace"] = KeyCodes::KeyKpRightbrace;
-				strToCode["KeyKpTab"] = KeyCodes::KeyKpTab;
-				strToCode["KeyKpBackspace"] = KeyCodes::KeyKpBackspace;
-				strToCode["KeyKpA"] = KeyCodes::KeyKpA;
-				strToCode["KeyKpB"] = KeyCodes::KeyKpB;
-				strToCode["KeyKpC"] = KeyCodes::KeyKpC;
-				strToCode["KeyKpD"] = KeyCodes::KeyKpD;
-				strToCode["KeyKpE"] = KeyCodes::KeyKpE;
-				strToCode["KeyKpF"] = KeyCodes::KeyKpF;
-				strToCode["KeyKpXor"] = KeyCodes::KeyKpXor;
-				strToCode["KeyKpPower"] = KeyCodes::KeyKpPower;
-				strToCode["KeyKpPercent"] = KeyCodes::KeyKpPercent;
-				strToCode["KeyKpLess"] = KeyCodes::KeyKpLess;
-				strToCode["KeyKpGreater"] = KeyCodes::KeyKpGreater;
-				strToCode["KeyKpAmpersand"] = KeyCodes::KeyKpAmpersand;
-				strToCode["KeyKpDblampersand"] = KeyCodes::KeyKpDblampersand;
-				strToCode["KeyKpVerticalbar"] = KeyCodes::KeyKpVerticalbar;
-				strToCode["KeyKpDblverticalbar"] = KeyCodes::KeyKpDblverticalbar;
-				strToCode["KeyKpColon"] = KeyCodes::KeyKpColon;
-				strToCode["KeyKpHash"] = KeyCodes::KeyKpHash;
-				strToCode["KeyKpSpace"] = KeyCodes::KeyKpSpace;
-				strToCode["KeyKpAt"] = KeyCodes::KeyKpAt;
-				strToCode["KeyKpExclam"] = KeyCodes::KeyKpExclam;
-				strToCode["KeyKpMemstore"] = KeyCodes::KeyKpMemstore;
-				strToCode["KeyKpMemrecall"] = KeyCodes::KeyKpMemrecall;
-				strToCode["KeyKpMemclear"] = KeyCodes::KeyKpMemclear;
-				strToCode["KeyKpMemadd"] = KeyCodes::KeyKpMemadd;
-				strToCode["KeyKpMemsubtract"] = KeyCodes::KeyKpMemsubtract;
-				strToCode["KeyKpMemmultiply"] = KeyCodes::KeyKpMemmultiply;
-				strToCode["KeyKpMemdivide"] = KeyCodes::KeyKpMemdivide;
-				strToCode["KeyKpPlusminus"] = KeyCodes::KeyKpPlusminus;
-				strToCode["KeyKpClear"] = KeyCodes::KeyKpClear;
-				strToCode["KeyKpClearentry"] = KeyCodes::KeyKpClearentry;
-				strToCode["KeyKpBinary"] = KeyCodes::KeyKpBinary;
-				strToCode["KeyKpOctal"] = KeyCodes::KeyKpOctal;
-				strToCode["KeyKpDecimal"] = KeyCodes::KeyKpDecimal;
-				strToCode["KeyKpHexadecimal"] = KeyCodes::KeyKpHexadecimal;
-				strToCode["KeyLctrl"] = KeyCodes::KeyLctrl;
-				strToCode["KeyLshift"] = KeyCodes::KeyLshift;
-				strToCode["KeyLalt"] = KeyCodes::KeyLalt;
-				strToCode["KeyLgui"] = KeyCodes::KeyLgui;
-				strToCode["KeyRctrl"] = KeyCodes::KeyRctrl;
-				strToCode["KeyRshift"] = KeyCodes::KeyRshift;
-				strToCode["KeyRalt"] = KeyCodes::KeyRalt;
-				strToCode["KeyRgui"] = KeyCodes::KeyRgui;
-				strToCode["KeyMode"] = KeyCodes::KeyMode;
-				strToCode["KeyAudionext"] = KeyCodes::KeyAudionext;
-				strToCode["KeyAudioprev"] = KeyCodes::KeyAudioprev;
-				strToCode["KeyAudiostop"] = KeyCodes::KeyAudiostop;
-				strToCode["KeyAudioplay"] = KeyCodes::KeyAudioplay;
-				strToCode["KeyAudiomute"] = KeyCodes::KeyAudiomute;
-				strToCode["KeyMediaselect"] = KeyCodes::KeyMediaselect;
-				strToCode["KeyWww"] = KeyCodes::KeyWww;
-				strToCode["KeyMail"] = KeyCodes::KeyMail;
-				strToCode["KeyCalculator"] = KeyCodes::KeyCalculator;
-				strToCode["KeyComputer"] = KeyCodes::KeyComputer;
-				strToCode["KeyAcSearch"] = KeyCodes::KeyAcSearch;
-				strToCode["KeyAcHome"] = KeyCodes::KeyAcHome;
-				strToCode["KeyAcBack"] = KeyCodes::KeyAcBack;
-				strToCode["KeyAcForward"] = KeyCodes::KeyAcForward;
-				strToCode["KeyAcStop"] = KeyCodes::KeyAcStop;
-				strToCode["KeyAcRefresh"] = KeyCodes::KeyAcRefresh;
-				strToCode["KeyAcBookmarks"] = KeyCodes::KeyAcBookmarks;
-				strToCode["KeyBrightnessdown"] = KeyCodes::KeyBrightnessdown;
-				strToCode["KeyBrightnessup"] = KeyCodes::KeyBrightnessup;
-				strToCode["KeyDisplayswitch"] = KeyCodes::KeyDisplayswitch;
-				strToCode["KeyKbdillumtoggle"] = KeyCodes::KeyKbdillumtoggle;
-				strToCode["KeyKbdillumdown"] = KeyCodes::KeyKbdillumdown;
-				strToCode["KeyKbdillumup"] = KeyCodes::KeyKbdillumup;
-				strToCode["KeyEject"] = KeyCodes::KeyEject;
-				strToCode["KeySleep"] = KeyCodes::KeySleep;
-				strToCode["KeyApp1"] = KeyCodes::KeyApp1;
-				strToCode["KeyApp2"] = KeyCodes::KeyApp2;
-				strToCode["KeyAudiorewind"] = KeyCodes::KeyAudiorewind;
-				strToCode["KeyAudiofastforward"] = KeyCodes::KeyAudiofastforward;
-				strToCode["MouseLeft"] = KeyCodes::MouseLeft;
-				strToCode["MouseMiddle"] = KeyCodes::MouseMiddle;
-				strToCode["MouseRight"] = KeyCodes::MouseRight;
-				strToCode["MouseX1"] = KeyCodes::MouseX1;
-				strToCode["MouseX2"] = KeyCodes::MouseX2;
-			}
+			return str ? FindKeyCode(str) : KeyCodes::KeyUnknown;
+		}
 
-			// return value
-			return strToCode[std::move(str)];
+		// convert key code to string
+		const char* _KeyCodeToString(KeyCodes key)
+		{
+			return ((int)key >= 0 && (int)key < KeyCodesCount) ? KeyCodesNames[(int)key].Name : "Unknown";
 		}
 	}
-}
\ No newline at end of file
+}
@@ -1,8 +1,13 @@
 #include <Input/Input.h>
 #include <Log/ILog.h>
 #include <Input/Defs.h>
+#include <Framework/Exceptions.h>
 #include <BonEngine.h>
 #include <string>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
 
 #pragma warning(push, 0)
 #include <SDL2-2.0.12/include/SDL.h>
@@ -30,537 +35,613 @@ namespace bon
 			return KeyCodes::KeyUnknown;
 		}
 
+		// a sdl key code and the bon key code it translates to
+		struct SdlKeyCode
+		{
+			SDL_Keycode Sdl;
+			KeyCodes Code;
+		};
+
+		// all sdl key codes we translate
+		constexpr SdlKeyCode SdlKeyCodes[] =
+		{
+			{ SDLK_RETURN, KeyCodes::KeyReturn },
+			{ SDLK_ESCAPE, KeyCodes::KeyEscape },
+			{ SDLK_BACKSPACE, KeyCodes::KeyBackspace },
+			{ SDLK_TAB, KeyCodes::KeyTab },
+			{ SDLK_SPACE, KeyCodes::KeySpace },
+			{ SDLK_EXCLAIM, KeyCodes::KeyExclaim },
+			{ SDLK_QUOTEDBL, KeyCodes::KeyQuotedbl },
+			{ SDLK_HASH, KeyCodes::KeyHash },
+			{ SDLK_PERCENT, KeyCodes::KeyPercent },
+			{ SDLK_DOLLAR, KeyCodes::KeyDollar },
+			{ SDLK_AMPERSAND, KeyCodes::KeyAmpersand },
+			{ SDLK_QUOTE, KeyCodes::KeyQuote },
+			{ SDLK_LEFTPAREN, KeyCodes::KeyLeftparen },
+			{ SDLK_RIGHTPAREN, KeyCodes::KeyRightparen },
+			{ SDLK_ASTERISK, KeyCodes::KeyAsterisk },
+			{ SDLK_PLUS, KeyCodes::KeyPlus },
+			{ SDLK_COMMA, KeyCodes::KeyComma },
+			{ SDLK_MINUS, KeyCodes::KeyMinus },
+			{ SDLK_PERIOD, KeyCodes::KeyPeriod },
+			{ SDLK_SLASH, KeyCodes::KeySlash },
+			{ SDLK_0, KeyCodes::Key0 },
+			{ SDLK_1, KeyCodes::Key1 },
+			{ SDLK_2, KeyCodes::Key2 },
+			{ SDLK_3, KeyCodes::Key3 },
+			{ SDLK_4, KeyCodes::Key4 },
+			{ SDLK_5, KeyCodes::Key5 },
+			{ SDLK_6, KeyCodes::Key6 },
+			{ SDLK_7, KeyCodes::Key7 },
+			{ SDLK_8, KeyCodes::Key8 },
+			{ SDLK_9, KeyCodes::Key9 },
+			{ SDLK_COLON, KeyCodes::KeyColon },
+			{ SDLK_SEMICOLON, KeyCodes::KeySemicolon },
+			{ SDLK_LESS, KeyCodes::KeyLess },
+			{ SDLK_EQUALS, KeyCodes::KeyEquals },
+			{ SDLK_GREATER, KeyCodes::KeyGreater },
+			{ SDLK_QUESTION, KeyCodes::KeyQuestion },
+			{ SDLK_AT, KeyCodes::KeyAt },
+			{ SDLK_LEFTBRACKET, KeyCodes::KeyLeftbracket },
+			{ SDLK_BACKSLASH, KeyCodes::KeyBackslash },
+			{ SDLK_RIGHTBRACKET, KeyCodes::KeyRightbracket },
+			{ SDLK_CARET, KeyCodes::KeyCaret },
+			{ SDLK_UNDERSCORE, KeyCodes::KeyUnderscore },
+			{ SDLK_BACKQUOTE, KeyCodes::KeyBackquote },
+			{ SDLK_a, KeyCodes::KeyA },
+			{ SDLK_b, KeyCodes::KeyB },
+			{ SDLK_c, KeyCodes::KeyC },
+			{ SDLK_d, KeyCodes::KeyD },
+			{ SDLK_e, KeyCodes::KeyE },
+			{ SDLK_f, KeyCodes::KeyF },
+			{ SDLK_g, KeyCodes::KeyG },
+			{ SDLK_h, KeyCodes::KeyH },
+			{ SDLK_i, KeyCodes::KeyI },
+			{ SDLK_j, KeyCodes::KeyJ },
+			{ SDLK_k, KeyCodes::KeyK },
+			{ SDLK_l, KeyCodes::KeyL },
+			{ SDLK_m, KeyCodes::KeyM },
+			{ SDLK_n, KeyCodes::KeyN },
+			{ SDLK_o, KeyCodes::KeyO },
+			{ SDLK_p, KeyCodes::KeyP },
+			{ SDLK_q, KeyCodes::KeyQ },
+			{ SDLK_r, KeyCodes::KeyR },
+			{ SDLK_s, KeyCodes::KeyS },
+			{ SDLK_t, KeyCodes::KeyT },
+			{ SDLK_u, KeyCodes::KeyU },
+			{ SDLK_v, KeyCodes::KeyV },
+			{ SDLK_w, KeyCodes::KeyW },
+			{ SDLK_x, KeyCodes::KeyX },
+			{ SDLK_y, KeyCodes::KeyY },
+			{ SDLK_z, KeyCodes::KeyZ },
+			{ SDLK_CAPSLOCK, KeyCodes::KeyCapslock },
+			{ SDLK_F1, KeyCodes::KeyF1 },
+			{ SDLK_F2, KeyCodes::KeyF2 },
+			{ SDLK_F3, KeyCodes::KeyF3 },
+			{ SDLK_F4, KeyCodes::KeyF4 },
+			{ SDLK_F5, KeyCodes::KeyF5 },
+			{ SDLK_F6, KeyCodes::KeyF6 },
+			{ SDLK_F7, KeyCodes::KeyF7 },
+			{ SDLK_F8, KeyCodes::KeyF8 },
+			{ SDLK_F9, KeyCodes::KeyF9 },
+			{ SDLK_F10, KeyCodes::KeyF10 },
+			{ SDLK_F11, KeyCodes::KeyF11 },
+			{ SDLK_F12, KeyCodes::KeyF12 },
+			{ SDLK_PRINTSCREEN, KeyCodes::KeyPrintscreen },
+			{ SDLK_SCROLLLOCK, KeyCodes::KeyScrolllock },
+			{ SDLK_PAUSE, KeyCodes::KeyPause },
+			{ SDLK_INSERT, KeyCodes::KeyInsert },
+			{ SDLK_HOME, KeyCodes::KeyHome },
+			{ SDLK_PAGEUP, KeyCodes::KeyPageup },
+			{ SDLK_DELETE, KeyCodes::KeyDelete },
+			{ SDLK_END, KeyCodes::KeyEnd },
+			{ SDLK_PAGEDOWN, KeyCodes::KeyPagedown },
+			{ SDLK_RIGHT, KeyCodes::KeyRight },
+			{ SDLK_LEFT, KeyCodes::KeyLeft },
+			{ SDLK_DOWN, KeyCodes::KeyDown },
+			{ SDLK_UP, KeyCodes::KeyUp },
+			{ SDLK_NUMLOCKCLEAR, KeyCodes::KeyNumlockclear },
+			{ SDLK_KP_DIVIDE, KeyCodes::KeyKpDivide },
+			{ SDLK_KP_MULTIPLY, KeyCodes::KeyKpMultiply },
+			{ SDLK_KP_MINUS, KeyCodes::KeyKpMinus },
+			{ SDLK_KP_PLUS, KeyCodes::KeyKpPlus },
+			{ SDLK_KP_ENTER, KeyCodes::KeyKpEnter },
+			{ SDLK_KP_1, KeyCodes::KeyKp1 },
+			{ SDLK_KP_2, KeyCodes::KeyKp2 },
+			{ SDLK_KP_3, KeyCodes::KeyKp3 },
+			{ SDLK_KP_4, KeyCodes::KeyKp4 },
+			{ SDLK_KP_5, KeyCodes::KeyKp5 },
+			{ SDLK_KP_6, KeyCodes::KeyKp6 },
+			{ SDLK_KP_7, KeyCodes::KeyKp7 },
+			{ SDLK_KP_8, KeyCodes::KeyKp8 },
+			{ SDLK_KP_9, KeyCodes::KeyKp9 },
+			{ SDLK_KP_0, KeyCodes::KeyKp0 },
+			{ SDLK_KP_PERIOD, KeyCodes::KeyKpPeriod },
+			{ SDLK_APPLICATION, KeyCodes::KeyApplication },
+			{ SDLK_POWER, KeyCodes::KeyPower },
+			{ SDLK_KP_EQUALS, KeyCodes::KeyKpEquals },
+			{ SDLK_F13, KeyCodes::KeyF13 },
+			{ SDLK_F14, KeyCodes::KeyF14 },
+			{ SDLK_F15, KeyCodes::KeyF15 },
+			{ SDLK_F16, KeyCodes::KeyF16 },
+			{ SDLK_F17, KeyCodes::KeyF17 },
+			{ SDLK_F18, KeyCodes::KeyF18 },
+			{ SDLK_F19, KeyCodes::KeyF19 },
+			{ SDLK_F20, KeyCodes::KeyF20 },
+			{ SDLK_F21, KeyCodes::KeyF21 },
+			{ SDLK_F22, KeyCodes::KeyF22 },
+			{ SDLK_F23, KeyCodes::KeyF23 },
+			{ SDLK_F24, KeyCodes::KeyF24 },
+			{ SDLK_EXECUTE, KeyCodes::KeyExecute },
+			{ SDLK_HELP, KeyCodes::KeyHelp },
+			{ SDLK_MENU, KeyCodes::KeyMenu },
+			{ SDLK_SELECT, KeyCodes::KeySelect },
+			{ SDLK_STOP, KeyCodes::KeyStop },
+			{ SDLK_AGAIN, KeyCodes::KeyAgain },
+			{ SDLK_UNDO, KeyCodes::KeyUndo },
+			{ SDLK_CUT, KeyCodes::KeyCut },
+			{ SDLK_COPY, KeyCodes::KeyCopy },
+			{ SDLK_PASTE, KeyCodes::KeyPaste },
+			{ SDLK_FIND, KeyCodes::KeyFind },
+			{ SDLK_MUTE, KeyCodes::KeyMute },
+			{ SDLK_VOLUMEUP, KeyCodes::KeyVolumeup },
+			{ SDLK_VOLUMEDOWN, KeyCodes::KeyVolumedown },
+			{ SDLK_KP_COMMA, KeyCodes::KeyKpComma },
+			{ SDLK_KP_EQUALSAS400, KeyCodes::KeyKpEqualsas400 },
+			{ SDLK_ALTERASE, KeyCodes::KeyAlterase },
+			{ SDLK_SYSREQ, KeyCodes::KeySysreq },
+			{ SDLK_CANCEL, KeyCodes::KeyCancel },
+			{ SDLK_CLEAR, KeyCodes::KeyClear },
+			{ SDLK_PRIOR, KeyCodes::KeyPrior },
+			{ SDLK_RETURN2, KeyCodes::KeyReturn2 },
+			{ SDLK_SEPARATOR, KeyCodes::KeySeparator },
+			{ SDLK_OUT, KeyCodes::KeyOut },
+			{ SDLK_OPER, KeyCodes::KeyOper },
+			{ SDLK_CLEARAGAIN, KeyCodes::KeyClearagain },
+			{ SDLK_CRSEL, KeyCodes::KeyCrsel },
+			{ SDLK_EXSEL, KeyCodes::KeyExsel },
+			{ SDLK_KP_00, KeyCodes::KeyKp00 },
+			{ SDLK_KP_000, KeyCodes::KeyKp000 },
+			{ SDLK_THOUSANDSSEPARATOR, KeyCodes::KeyThousandsseparator },
+			{ SDLK_DECIMALSEPARATOR, KeyCodes::KeyDecimalseparator },
+			{ SDLK_CURRENCYUNIT, KeyCodes::KeyCurrencyunit },
+			{ SDLK_CURRENCYSUBUNIT, KeyCodes::KeyCurrencysubunit },
+			{ SDLK_KP_LEFTPAREN, KeyCodes::KeyKpLeftparen },
+			{ SDLK_KP_RIGHTPAREN, KeyCodes::KeyKpRightparen },
+			{ SDLK_KP_LEFTBRACE, KeyCodes::KeyKpLeftbrace },
+			{ SDLK_KP_RIGHTBRACE, KeyCodes::KeyKpRightbrace },
+			{ SDLK_KP_TAB, KeyCodes::KeyKpTab },
+			{ SDLK_KP_BACKSPACE, KeyCodes::KeyKpBackspace },
+			{ SDLK_KP_A, KeyCodes::KeyKpA },
+			{ SDLK_KP_B, KeyCodes::KeyKpB },
+			{ SDLK_KP_C, KeyCodes::KeyKpC },
+			{ SDLK_KP_D, KeyCodes::KeyKpD },
+			{ SDLK_KP_E, KeyCodes::KeyKpE },
+			{ SDLK_KP_F, KeyCodes::KeyKpF },
+			{ SDLK_KP_XOR, KeyCodes::KeyKpXor },
+			{ SDLK_KP_POWER, KeyCodes::KeyKpPower },
+			{ SDLK_KP_PERCENT, KeyCodes::KeyKpPercent },
+			{ SDLK_KP_LESS, KeyCodes::KeyKpLess },
+			{ SDLK_KP_GREATER, KeyCodes::KeyKpGreater },
+			{ SDLK_KP_AMPERSAND, KeyCodes::KeyKpAmpersand },
+			{ SDLK_KP_DBLAMPERSAND, KeyCodes::KeyKpDblampersand },
+			{ SDLK_KP_VERTICALBAR, KeyCodes::KeyKpVerticalbar },
+			{ SDLK_KP_DBLVERTICALBAR, KeyCodes::KeyKpDblverticalbar },
+			{ SDLK_KP_COLON, KeyCodes::KeyKpColon },
+			{ SDLK_KP_HASH, KeyCodes::KeyKpHash },
+			{ SDLK_KP_SPACE, KeyCodes::KeyKpSpace },
+			{ SDLK_KP_AT, KeyCodes::KeyKpAt },
+			{ SDLK_KP_EXCLAM, KeyCodes::KeyKpExclam },
+			{ SDLK_KP_MEMSTORE, KeyCodes::KeyKpMemstore },
+			{ SDLK_KP_MEMRECALL, KeyCodes::KeyKpMemrecall },
+			{ SDLK_KP_MEMCLEAR, KeyCodes::KeyKpMemclear },
+			{ SDLK_KP_MEMADD, KeyCodes::KeyKpMemadd },
+			{ SDLK_KP_MEMSUBTRACT, KeyCodes::KeyKpMemsubtract },
+			{ SDLK_KP_MEMMULTIPLY, KeyCodes::KeyKpMemmultiply },
+			{ SDLK_KP_MEMDIVIDE, KeyCodes::KeyKpMemdivide },
+			{ SDLK_KP_PLUSMINUS, KeyCodes::KeyKpPlusminus },
+			{ SDLK_KP_CLEAR, KeyCodes::KeyKpClear },
+			{ SDLK_KP_CLEARENTRY, KeyCodes::KeyKpClearentry },
+			{ SDLK_KP_BINARY, KeyCodes::KeyKpBinary },
+			{ SDLK_KP_OCTAL, KeyCodes::KeyKpOctal },
+			{ SDLK_KP_DECIMAL, KeyCodes::KeyKpDecimal },
+			{ SDLK_KP_HEXADECIMAL, KeyCodes::KeyKpHexadecimal },
+			{ SDLK_LCTRL, KeyCodes::KeyLctrl },
+			{ SDLK_LSHIFT, KeyCodes::KeyLshift },
+			{ SDLK_LALT, KeyCodes::KeyLalt },
+			{ SDLK_LGUI, KeyCodes::KeyLgui },
+			{ SDLK_RCTRL, KeyCodes::KeyRctrl },
+			{ SDLK_RSHIFT, KeyCodes::KeyRshift },
+			{ SDLK_RALT, KeyCodes::KeyRalt },
+			{ SDLK_RGUI, KeyCodes::KeyRgui },
+			{ SDLK_MODE, KeyCodes::KeyMode },
+			{ SDLK_AUDIONEXT, KeyCodes::KeyAudionext },
+			{ SDLK_AUDIOPREV, KeyCodes::KeyAudioprev },
+			{ SDLK_AUDIOSTOP, KeyCodes::KeyAudiostop },
+			{ SDLK_AUDIOPLAY, KeyCodes::KeyAudioplay },
+			{ SDLK_AUDIOMUTE, KeyCodes::KeyAudiomute },
+			{ SDLK_MEDIASELECT, KeyCodes::KeyMediaselect },
+			{ SDLK_WWW, KeyCodes::KeyWww },
+			{ SDLK_MAIL, KeyCodes::KeyMail },
+			{ SDLK_CALCULATOR, KeyCodes::KeyCalculator },
+			{ SDLK_COMPUTER, KeyCodes::KeyComputer },
+			{ SDLK_AC_SEARCH, KeyCodes::KeyAcSearch },
+			{ SDLK_AC_HOME, KeyCodes::KeyAcHome },
+			{ SDLK_AC_BACK, KeyCodes::KeyAcBack },
+			{ SDLK_AC_FORWARD, KeyCodes::KeyAcForward },
+			{ SDLK_AC_STOP, KeyCodes::KeyAcStop },
+			{ SDLK_AC_REFRESH, KeyCodes::KeyAcRefresh },
+			{ SDLK_AC_BOOKMARKS, KeyCodes::KeyAcBookmarks },
+			{ SDLK_BRIGHTNESSDOWN, KeyCodes::KeyBrightnessdown },
+			{ SDLK_BRIGHTNESSUP, KeyCodes::KeyBrightnessup },
+			{ SDLK_DISPLAYSWITCH, KeyCodes::KeyDisplayswitch },
+			{ SDLK_KBDILLUMTOGGLE, KeyCodes::KeyKbdillumtoggle },
+			{ SDLK_KBDILLUMDOWN, KeyCodes::KeyKbdillumdown },
+			{ SDLK_KBDILLUMUP, KeyCodes::KeyKbdillumup },
+			{ SDLK_EJECT, KeyCodes::KeyEject },
+			{ SDLK_SLEEP, KeyCodes::KeySleep },
+			{ SDLK_APP1, KeyCodes::KeyApp1 },
+			{ SDLK_APP2, KeyCodes::KeyApp2 },
+			{ SDLK_AUDIOREWIND, KeyCodes::KeyAudiorewind },
+			{ SDLK_AUDIOFASTFORWARD, KeyCodes::KeyAudiofastforward },
+		};
+
+		// sdl to bon key codes lookup tables.
+		// sdl key codes are either ascii characters, or scancodes with SDLK_SCANCODE_MASK bit set.
+		struct SdlKeyCodesTable
+		{
+			KeyCodes Chars[128];
+			KeyCodes Scancodes[SDL_NUM_SCANCODES];
+		};
+
+		// build sdl key codes lookup tables at compile time
+		constexpr SdlKeyCodesTable BuildSdlKeyCodesTable()
+		{
+			SdlKeyCodesTable ret = {};
+			for (auto& key : SdlKeyCodes)
+			{
+				if (key.Sdl & SDLK_SCANCODE_MASK) { ret.Scancodes[key.Sdl & ~SDLK_SCANCODE_MASK] = key.Code; }
+				else { ret.Chars[key.Sdl] = key.Code; }
+			}
+			return ret;
+		}
+		constexpr SdlKeyCodesTable SdlKeyCodesLookup = BuildSdlKeyCodesTable();
+
 		// convert sdl key code to bon key code
-		KeyCodes SdlToEzKeyCode(int sdlCode)
+		constexpr KeyCodes SdlToEzKeyCode(int sdlCode)
 		{
-			switch (sdlCode)
+			if (sdlCode & SDLK_SCANCODE_MASK) 
 			{
-				case SDLK_UNKNOWN: return KeyCodes::KeyUnknown;
-				case SDLK_RETURN: return KeyCodes::KeyReturn;
-				case SDLK_ESCAPE: return KeyCodes::KeyEscape;
-				case SDLK_BACKSPACE: return KeyCodes::KeyBackspace;
-				case SDLK_TAB: return KeyCodes::KeyTab;
-				case SDLK_SPACE: return KeyCodes::KeySpace;
-				case SDLK_EXCLAIM: return KeyCodes::KeyExclaim;
-				case SDLK_QUOTEDBL: return KeyCodes::KeyQuotedbl;
-				case SDLK_HASH: return KeyCodes::KeyHash;
-				case SDLK_PERCENT: return KeyCodes::KeyPercent;
-				case SDLK_DOLLAR: return KeyCodes::KeyDollar;
-				case SDLK_AMPERSAND: return KeyCodes::KeyAmpersand;
-				case SDLK_QUOTE: return KeyCodes::KeyQuote;
-				case SDLK_LEFTPAREN: return KeyCodes::KeyLeftparen;
-				case SDLK_RIGHTPAREN: return KeyCodes::KeyRightparen;
-				case SDLK_ASTERISK: return KeyCodes::KeyAsterisk;
-				case SDLK_PLUS: return KeyCodes::KeyPlus;
-				case SDLK_COMMA: return KeyCodes::KeyComma;
-				case SDLK_MINUS: return KeyCodes::KeyMinus;
-				case SDLK_PERIOD: return KeyCodes::KeyPeriod;
-				case SDLK_SLASH: return KeyCodes::KeySlash;
-				case SDLK_0: return KeyCodes::Key0;
-				case SDLK_1: return KeyCodes::Key1;
-				case SDLK_2: return KeyCodes::Key2;
-				case SDLK_3: return KeyCodes::Key3;
-				case SDLK_4: return KeyCodes::Key4;
-				case SDLK_5: return KeyCodes::Key5;
-				case SDLK_6: return KeyCodes::Key6;
-				case SDLK_7: return KeyCodes::Key7;
-				case SDLK_8: return KeyCodes::Key8;
-				case SDLK_9: return KeyCodes::Key9;
-				case SDLK_COLON: return KeyCodes::KeyColon;
-				case SDLK_SEMICOLON: return KeyCodes::KeySemicolon;
-				case SDLK_LESS: return KeyCodes::KeyLess;
-				case SDLK_EQUALS: return KeyCodes::KeyEquals;
-				case SDLK_GREATER: return KeyCodes::KeyGreater;
-				case SDLK_QUESTION: return KeyCodes::KeyQuestion;
-				case SDLK_AT: return KeyCodes::KeyAt;
-				case SDLK_LEFTBRACKET: return KeyCodes::KeyLeftbracket;
-				case SDLK_BACKSLASH: return KeyCodes::KeyBackslash;
-				case SDLK_RIGHTBRACKET: return KeyCodes::KeyRightbracket;
-				case SDLK_CARET: return KeyCodes::KeyCaret;
-				case SDLK_UNDERSCORE: return KeyCodes::KeyUnderscore;
-				case SDLK_BACKQUOTE: return KeyCodes::KeyBackquote;
-				case SDLK_a: return KeyCodes::KeyA;
-				case SDLK_b: return KeyCodes::KeyB;
-				case SDLK_c: return KeyCodes::KeyC;
-				case SDLK_d: return KeyCodes::KeyD;
-				case SDLK_e: return KeyCodes::KeyE;
-				case SDLK_f: return KeyCodes::KeyF;
-				case SDLK_g: return KeyCodes::KeyG;
-				case SDLK_h: return KeyCodes::KeyH;
-				case SDLK_i: return KeyCodes::KeyI;
-				case SDLK_j: return KeyCodes::KeyJ;
-				case SDLK_k: return KeyCodes::KeyK;
-				case SDLK_l: return KeyCodes::KeyL;
-				case SDLK_m: return KeyCodes::KeyM;
-				case SDLK_n: return KeyCodes::KeyN;
-				case SDLK_o: return KeyCodes::KeyO;
-				case SDLK_p: return KeyCodes::KeyP;
-				case SDLK_q: return KeyCodes::KeyQ;
-				case SDLK_r: return KeyCodes::KeyR;
-				case SDLK_s: return KeyCodes::KeyS;
-				case SDLK_t: return KeyCodes::KeyT;
-				case SDLK_u: return KeyCodes::KeyU;
-				case SDLK_v: return KeyCodes::KeyV;
-				case SDLK_w: return KeyCodes::KeyW;
-				case SDLK_x: return KeyCodes::KeyX;
-				case SDLK_y: return KeyCodes::KeyY;
-				case SDLK_z: return KeyCodes::KeyZ;
-				case SDLK_CAPSLOCK: return KeyCodes::KeyCapslock;
-				case SDLK_F1: return KeyCodes::KeyF1;
-				case SDLK_F2: return KeyCodes::KeyF2;
-				case SDLK_F3: return KeyCodes::KeyF3;
-				case SDLK_F4: return KeyCodes::KeyF4;
-				case SDLK_F5: return KeyCodes::KeyF5;
-				case SDLK_F6: return KeyCodes::KeyF6;
-				case SDLK_F7: return KeyCodes::KeyF7;
-				case SDLK_F8: return KeyCodes::KeyF8;
-				case SDLK_F9: return KeyCodes::KeyF9;
-				case SDLK_F10: return KeyCodes::KeyF10;
-				case SDLK_F11: return KeyCodes::KeyF11;
-				case SDLK_F12: return KeyCodes::KeyF12;
-				case SDLK_PRINTSCREEN: return KeyCodes::KeyPrintscreen;
-				case SDLK_SCROLLLOCK: return KeyCodes::KeyScrolllock;
-				case SDLK_PAUSE: return KeyCodes::KeyPause;
-				case SDLK_INSERT: return KeyCodes::KeyInsert;
-				case SDLK_HOME: return KeyCodes::KeyHome;
-				case SDLK_PAGEUP: return KeyCodes::KeyPageup;
-				case SDLK_DELETE: return KeyCodes::KeyDelete;
-				case SDLK_END: return KeyCodes::KeyEnd;
-				case SDLK_PAGEDOWN: return KeyCodes::KeyPagedown;
-				case SDLK_RIGHT: return KeyCodes::KeyRight;
-				case SDLK_LEFT: return KeyCodes::KeyLeft;
-				case SDLK_DOWN: return KeyCodes::KeyDown;
-				case SDLK_UP: return KeyCodes::KeyUp;
-				case SDLK_NUMLOCKCLEAR: return KeyCodes::KeyNumlockclear;
-				case SDLK_KP_DIVIDE: return KeyCodes::KeyKpDivide;
-				case SDLK_KP_MULTIPLY: return KeyCodes::KeyKpMultiply;
-				case SDLK_KP_MINUS: return KeyCodes::KeyKpMinus;
-				case SDLK_KP_PLUS: return KeyCodes::KeyKpPlus;
-				case SDLK_KP_ENTER: return KeyCodes::KeyKpEnter;
-				case SDLK_KP_1: return KeyCodes::KeyKp1;
-				case SDLK_KP_2: return KeyCodes::KeyKp2;
-				case SDLK_KP_3: return KeyCodes::KeyKp3;
-				case SDLK_KP_4: return KeyCodes::KeyKp4;
-				case SDLK_KP_5: return KeyCodes::KeyKp5;
-				case SDLK_KP_6: return KeyCodes::KeyKp6;
-				case SDLK_KP_7: return KeyCodes::KeyKp7;
-				case SDLK_KP_8: return KeyCodes::KeyKp8;
-				case SDLK_KP_9: return KeyCodes::KeyKp9;
-				case SDLK_KP_0: return KeyCodes::KeyKp0;
-				case SDLK_KP_PERIOD: return KeyCodes::KeyKpPeriod;
-				case SDLK_APPLICATION: return KeyCodes::KeyApplication;
-				case SDLK_POWER: return KeyCodes::KeyPower;
-				case SDLK_KP_EQUALS: return KeyCodes::KeyKpEquals;
-				case SDLK_F13: return KeyCodes::KeyF13;
-				case SDLK_F14: return KeyCodes::KeyF14;
-				case SDLK_F15: return KeyCodes::KeyF15;
-				case SDLK_F16: return KeyCodes::KeyF16;
-				case SDLK_F17: return KeyCodes::KeyF17;
-				case SDLK_F18: return KeyCodes::KeyF18;
-				case SDLK_F19: return KeyCodes::KeyF19;
-				case SDLK_F20: return KeyCodes::KeyF20;
-				case SDLK_F21: return KeyCodes::KeyF21;
-				case SDLK_F22: return KeyCodes::KeyF22;
-				case SDLK_F23: return KeyCodes::KeyF23;
-				case SDLK_F24: return KeyCodes::KeyF24;
-				case SDLK_EXECUTE: return KeyCodes::KeyExecute;
-				case SDLK_HELP: return KeyCodes::KeyHelp;
-				case SDLK_MENU: return KeyCodes::KeyMenu;
-				case SDLK_SELECT: return KeyCodes::KeySelect;
-				case SDLK_STOP: return KeyCodes::KeyStop;
-				case SDLK_AGAIN: return KeyCodes::KeyAgain;
-				case SDLK_UNDO: return KeyCodes::KeyUndo;
-				case SDLK_CUT: return KeyCodes::KeyCut;
-				case SDLK_COPY: return KeyCodes::KeyCopy;
-				case SDLK_PASTE: return KeyCodes::KeyPaste;
-				case SDLK_FIND: return KeyCodes::KeyFind;
-				case SDLK_MUTE: return KeyCodes::KeyMute;
-				case SDLK_VOLUMEUP: return KeyCodes::KeyVolumeup;
-				case SDLK_VOLUMEDOWN: return KeyCodes::KeyVolumedown;
-				case SDLK_KP_COMMA: return KeyCodes::KeyKpComma;
-				case SDLK_KP_EQUALSAS400: return KeyCodes::KeyKpEqualsas400;
-				case SDLK_ALTERASE: return KeyCodes::KeyAlterase;
-				case SDLK_SYSREQ: return KeyCodes::KeySysreq;
-				case SDLK_CANCEL: return KeyCodes::KeyCancel;
-				case SDLK_CLEAR: return KeyCodes::KeyClear;
-				case SDLK_PRIOR: return KeyCodes::KeyPrior;
-				case SDLK_RETURN2: return KeyCodes::KeyReturn2;
-				case SDLK_SEPARATOR: return KeyCodes::KeySeparator;
-				case SDLK_OUT: return KeyCodes::KeyOut;
-				case SDLK_OPER: return KeyCodes::KeyOper;
-				case SDLK_CLEARAGAIN: return KeyCodes::KeyClearagain;
-				case SDLK_CRSEL: return KeyCodes::KeyCrsel;
-				case SDLK_EXSEL: return KeyCodes::KeyExsel;
-				case SDLK_KP_00: return KeyCodes::KeyKp00;
-				case SDLK_KP_000: return KeyCodes::KeyKp000;
-				case SDLK_THOUSANDSSEPARATOR: return KeyCodes::KeyThousandsseparator;
-				case SDLK_DECIMALSEPARATOR: return KeyCodes::KeyDecimalseparator;
-				case SDLK_CURRENCYUNIT: return KeyCodes::KeyCurrencyunit;
-				case SDLK_CURRENCYSUBUNIT: return KeyCodes::KeyCurrencysubunit;
-				case SDLK_KP_LEFTPAREN: return KeyCodes::KeyKpLeftparen;
-				case SDLK_KP_RIGHTPAREN: return KeyCodes::KeyKpRightparen;
-				case SDLK_KP_LEFTBRACE: return KeyCodes::KeyKpLeftbrace;
-				case SDLK_KP_RIGHTBRACE: return KeyCodes::KeyKpRightbrace;
-				case SDLK_KP_TAB: return KeyCodes::KeyKpTab;
-				case SDLK_KP_BACKSPACE: return KeyCodes::KeyKpBackspace;
-				case SDLK_KP_A: return KeyCodes::KeyKpA;
-				case SDLK_KP_B: return KeyCodes::KeyKpB;
-				case SDLK_KP_C: return KeyCodes::KeyKpC;
-				case SDLK_KP_D: return KeyCodes::KeyKpD;
-				case SDLK_KP_E: return KeyCodes::KeyKpE;
-				case SDLK_KP_F: return KeyCodes::KeyKpF;
-				case SDLK_KP_XOR: return KeyCodes::KeyKpXor;
-				case SDLK_KP_POWER: return KeyCodes::KeyKpPower;
-				case SDLK_KP_PERCENT: return KeyCodes::KeyKpPercent;
-				case SDLK_KP_LESS: return KeyCodes::KeyKpLess;
-				case SDLK_KP_GREATER: return KeyCodes::KeyKpGreater;
-				case SDLK_KP_AMPERSAND: return KeyCodes::KeyKpAmpersand;
-				case SDLK_KP_DBLAMPERSAND: return KeyCodes::KeyKpDblampersand;
-				case SDLK_KP_VERTICALBAR: return KeyCodes::KeyKpVerticalbar;
-				case SDLK_KP_DBLVERTICALBAR: return KeyCodes::KeyKpDblverticalbar;
-				case SDLK_KP_COLON: return KeyCodes::KeyKpColon;
-				case SDLK_KP_HASH: return KeyCodes::KeyKpHash;
-				case SDLK_KP_SPACE: return KeyCodes::KeyKpSpace;
-				case SDLK_KP_AT: return KeyCodes::KeyKpAt;
-				case SDLK_KP_EXCLAM: return KeyCodes::KeyKpExclam;
-				case SDLK_KP_MEMSTORE: return KeyCodes::KeyKpMemstore;
-				case SDLK_KP_MEMRECALL: return KeyCodes::KeyKpMemrecall;
-				case SDLK_KP_MEMCLEAR: return KeyCodes::KeyKpMemclear;
-				case SDLK_KP_MEMADD: return KeyCodes::KeyKpMemadd;
-				case SDLK_KP_MEMSUBTRACT: return KeyCodes::KeyKpMemsubtract;
-				case SDLK_KP_MEMMULTIPLY: return KeyCodes::KeyKpMemmultiply;
-				case SDLK_KP_MEMDIVIDE: return KeyCodes::KeyKpMemdivide;
-				case SDLK_KP_PLUSMINUS: return KeyCodes::KeyKpPlusminus;
-				case SDLK_KP_CLEAR: return KeyCodes::KeyKpClear;
-				case SDLK_KP_CLEARENTRY: return KeyCodes::KeyKpClearentry;
-				case SDLK_KP_BINARY: return KeyCodes::KeyKpBinary;
-				case SDLK_KP_OCTAL: return KeyCodes::KeyKpOctal;
-				case SDLK_KP_DECIMAL: return KeyCodes::KeyKpDecimal;
-				case SDLK_KP_HEXADECIMAL: return KeyCodes::KeyKpHexadecimal;
-				case SDLK_LCTRL: return KeyCodes::KeyLctrl;
-				case SDLK_LSHIFT: return KeyCodes::KeyLshift;
-				case SDLK_LALT: return KeyCodes::KeyLalt;
-				case SDLK_LGUI: return KeyCodes::KeyLgui;
-				case SDLK_RCTRL: return KeyCodes::KeyRctrl;
-				case SDLK_RSHIFT: return KeyCodes::KeyRshift;
-				case SDLK_RALT: return KeyCodes::KeyRalt;
-				case SDLK_RGUI: return KeyCodes::KeyRgui;
-				case SDLK_MODE: return KeyCodes::KeyMode;
-				case SDLK_AUDIONEXT: return KeyCodes::KeyAudionext;
-				case SDLK_AUDIOPREV: return KeyCodes::KeyAudioprev;
-				case SDLK_AUDIOSTOP: return KeyCodes::KeyAudiostop;
-				case SDLK_AUDIOPLAY: return KeyCodes::KeyAudioplay;
-				case SDLK_AUDIOMUTE: return KeyCodes::KeyAudiomute;
-				case SDLK_MEDIASELECT: return KeyCodes::KeyMediaselect;
-				case SDLK_WWW: return KeyCodes::KeyWww;
-				case SDLK_MAIL: return KeyCodes::KeyMail;
-				case SDLK_CALCULATOR: return KeyCodes::KeyCalculator;
-				case SDLK_COMPUTER: return KeyCodes::KeyComputer;
-				case SDLK_AC_SEARCH: return KeyCodes::KeyAcSearch;
-				case SDLK_AC_HOME: return KeyCodes::KeyAcHome;
-				case SDLK_AC_BACK: return KeyCodes::KeyAcBack;
-				case SDLK_AC_FORWARD: return KeyCodes::KeyAcForward;
-				case SDLK_AC_STOP: return KeyCodes::KeyAcStop;
-				case SDLK_AC_REFRESH: return KeyCodes::KeyAcRefresh;
-				case SDLK_AC_BOOKMARKS: return KeyCodes::KeyAcBookmarks;
-				case SDLK_BRIGHTNESSDOWN: return KeyCodes::KeyBrightnessdown;
-				case SDLK_BRIGHTNESSUP: return KeyCodes::KeyBrightnessup;
-				case SDLK_DISPLAYSWITCH: return KeyCodes::KeyDisplayswitch;
-				case SDLK_KBDILLUMTOGGLE: return KeyCodes::KeyKbdillumtoggle;
-				case SDLK_KBDILLUMDOWN: return KeyCodes::KeyKbdillumdown;
-				case SDLK_KBDILLUMUP: return KeyCodes::KeyKbdillumup;
-				case SDLK_EJECT: return KeyCodes::KeyEject;
-				case SDLK_SLEEP: return KeyCodes::KeySleep;
-				case SDLK_APP1: return KeyCodes::KeyApp1;
-				case SDLK_APP2: return KeyCodes::KeyApp2;
-				case SDLK_AUDIOREWIND: return KeyCodes::KeyAudiorewind;
-				case SDLK_AUDIOFASTFORWARD: return KeyCodes::KeyAudiofastforward;
+				int scancode = sdlCode & ~SDLK_SCANCODE_MASK;
+				return (scancode < SDL_NUM_SCANCODES) ? SdlKeyCodesLookup.Scancodes[scancode] : KeyCodes::KeyUnknown;
 			}
-			return KeyCodes::KeyUnknown;
+			return (sdlCode >= 0 && sdlCode < 128) ? SdlKeyCodesLookup.Chars[sdlCode] : KeyCodes::KeyUnknown;
 		}
 
-		// convert key code enum to string
-		const char* KeyCodeToString(KeyCodes key)
+		// make sure every sdl key code translates to its bon key code, ie there are no duplicated or out of range sdl key codes
+		constexpr bool ValidateSdlKeyCodes()
 		{
-			switch (key)
+			for (auto& key : SdlKeyCodes)
 			{
-				case KeyCodes::KeyUnknown: return "KeyUnknown";
-				case KeyCodes::KeyReturn: return "KeyReturn";
-				case KeyCodes::KeyEscape: return "KeyEscape";
-				case KeyCodes::KeyBackspace: return "KeyBackspace";
-				case KeyCodes::KeyTab: return "KeyTab";
-				case KeyCodes::KeySpace: return "KeySpace";
-				case KeyCodes::KeyExclaim: return "KeyExclaim";
-				case KeyCodes::KeyQuotedbl: return "KeyQuotedbl";
-				case KeyCodes::KeyHash: return "KeyHash";
-				case KeyCodes::KeyPercent: return "KeyPercent";
-				case KeyCodes::KeyDollar: return "KeyDollar";
-				case KeyCodes::KeyAmpersand: return "KeyAmpersand";
-				case KeyCodes::KeyQuote: return "KeyQuote";
-				case KeyCodes::KeyLeftparen: return "KeyLeftparen";
-				case KeyCodes::KeyRightparen: return "KeyRightparen";
-				case KeyCodes::KeyAsterisk: return "KeyAsterisk";
-				case KeyCodes::KeyPlus: return "KeyPlus";
-				case KeyCodes::KeyComma: return "KeyComma";
-				case KeyCodes::KeyMinus: return "KeyMinus";
-				case KeyCodes::KeyPeriod: return "KeyPeriod";
-				case KeyCodes::KeySlash: return "KeySlash";
-				case KeyCodes::Key0: return "Key0";
-				case KeyCodes::Key1: return "Key1";
-				case KeyCodes::Key2: return "Key2";
-				case KeyCodes::Key3: return "Key3";
-				case KeyCodes::Key4: return "Key4";
-				case KeyCodes::Key5: return "Key5";
-				case KeyCodes::Key6: return "Key6";
-				case KeyCodes::Key7: return "Key7";
-				case KeyCodes::Key8: return "Key8";
-				case KeyCodes::Key9: return "Key9";
-				case KeyCodes::KeyColon: return "KeyColon";
-				case KeyCodes::KeySemicolon: return "KeySemicolon";
-				case KeyCodes::KeyLess: return "KeyLess";
-				case KeyCodes::KeyEquals: return "KeyEquals";
-				case KeyCodes::KeyGreater: return "KeyGreater";
-				case KeyCodes::KeyQuestion: return "KeyQuestion";
-				case KeyCodes::KeyAt: return "KeyAt";
-				case KeyCodes::KeyLeftbracket: return "KeyLeftbracket";
-				case KeyCodes::KeyBackslash: return "KeyBackslash";
-				case KeyCodes::KeyRightbracket: return "KeyRightbracket";
-				case KeyCodes::KeyCaret: return "KeyCaret";
-				case KeyCodes::KeyUnderscore: return "KeyUnderscore";
-				case KeyCodes::KeyBackquote: return "KeyBackquote";
-				case KeyCodes::KeyA: return "KeyA";
-				case KeyCodes::KeyB: return "KeyB";
-				case KeyCodes::KeyC: return "KeyC";
-				case KeyCodes::KeyD: return "KeyD";
-				case KeyCodes::KeyE: return "KeyE";
-				case KeyCodes::KeyF: return "KeyF";
-				case KeyCodes::KeyG: return "KeyG";
-				case KeyCodes::KeyH: return "KeyH";
-				case KeyCodes::KeyI: return "KeyI";
-				case KeyCodes::KeyJ: return "KeyJ";
-				case KeyCodes::KeyK: return "KeyK";
-				case KeyCodes::KeyL: return "KeyL";
-				case KeyCodes::KeyM: return "KeyM";
-				case KeyCodes::KeyN: return "KeyN";
-				case KeyCodes::KeyO: return "KeyO";
-				case KeyCodes::KeyP: return "KeyP";
-				case KeyCodes::KeyQ: return "KeyQ";
-				case KeyCodes::KeyR: return "KeyR";
-				case KeyCodes::KeyS: return "KeyS";
-				case KeyCodes::KeyT: return "KeyT";
-				case KeyCodes::KeyU: return "KeyU";
-				case KeyCodes::KeyV: return "KeyV";
-				case KeyCodes::KeyW: return "KeyW";
-				case KeyCodes::KeyX: return "KeyX";
-				case KeyCodes::KeyY: return "KeyY";
-				case KeyCodes::KeyZ: return "KeyZ";
-				case KeyCodes::KeyCapslock: return "KeyCapslock";
-				case KeyCodes::KeyF1: return "KeyF1";
-				case KeyCodes::KeyF2: return "KeyF2";
-				case KeyCodes::KeyF3: return "KeyF3";
-				case KeyCodes::KeyF4: return "KeyF4";
-				case KeyCodes::KeyF5: return "KeyF5";
-				case KeyCodes::KeyF6: return "KeyF6";
-				case KeyCodes::KeyF7: return "KeyF7";
-				case KeyCodes::KeyF8: return "KeyF8";
-				case KeyCodes::KeyF9: return "KeyF9";
-				case KeyCodes::KeyF10: return "KeyF10";
-				case KeyCodes::KeyF11: return "KeyF11";
-				case KeyCodes::KeyF12: return "KeyF12";
-				case KeyCodes::KeyPrintscreen: return "KeyPrintscreen";
-				case KeyCodes::KeyScrolllock: return "KeyScrolllock";
-				case KeyCodes::KeyPause: return "KeyPause";
-				case KeyCodes::KeyInsert: return "KeyInsert";
-				case KeyCodes::KeyHome: return "KeyHome";
-				case KeyCodes::KeyPageup: return "KeyPageup";
-				case KeyCodes::KeyDelete: return "KeyDelete";
-				case KeyCodes::KeyEnd: return "KeyEnd";
-				case KeyCodes::KeyPagedown: return "KeyPagedown";
-				case KeyCodes::KeyRight: return "KeyRight";
-				case KeyCodes::KeyLeft: return "KeyLeft";
-				case KeyCodes::KeyDown: return "KeyDown";
-				case KeyCodes::KeyUp: return "KeyUp";
-				case KeyCodes::KeyNumlockclear: return "KeyNumlockclear";
-				case KeyCodes::KeyKpDivide: return "KeyKpDivide";
-				case KeyCodes::KeyKpMultiply: return "KeyKpMultiply";
-				case KeyCodes::KeyKpMinus: return "KeyKpMinus";
-				case KeyCodes::KeyKpPlus: return "KeyKpPlus";
-				case KeyCodes::KeyKpEnter: return "KeyKpEnter";
-				case KeyCodes::KeyKp1: return "KeyKp1";
-				case KeyCodes::KeyKp2: return "KeyKp2";
-				case KeyCodes::KeyKp3: return "KeyKp3";
-				case KeyCodes::KeyKp4: return "KeyKp4";
-				case KeyCodes::KeyKp5: return "KeyKp5";
-				case KeyCodes::KeyKp6: return "KeyKp6";
-				case KeyCodes::KeyKp7: return "KeyKp7";
-				case KeyCodes::KeyKp8: return "KeyKp8";
-				case KeyCodes::KeyKp9: return "KeyKp9";
-				case KeyCodes::KeyKp0: return "KeyKp0";
-				case KeyCodes::KeyKpPeriod: return "KeyKpPeriod";
-				case KeyCodes::KeyApplication: return "KeyApplication";
-				case KeyCodes::KeyPower: return "KeyPower";
-				case KeyCodes::KeyKpEquals: return "KeyKpEquals";
-				case KeyCodes::KeyF13: return "KeyF13";
-				case KeyCodes::KeyF14: return "KeyF14";
-				case KeyCodes::KeyF15: return "KeyF15";
-				case KeyCodes::KeyF16: return "KeyF16";
-				case KeyCodes::KeyF17: return "KeyF17";
-				case KeyCodes::KeyF18: return "KeyF18";
-				case KeyCodes::KeyF19: return "KeyF19";
-				case KeyCodes::KeyF20: return "KeyF20";
-				case KeyCodes::KeyF21: return "KeyF21";
-				case KeyCodes::KeyF22: return "KeyF22";
-				case KeyCodes::KeyF23: return "KeyF23";
-				case KeyCodes::KeyF24: return "KeyF24";
-				case KeyCodes::KeyExecute: return "KeyExecute";
-				case KeyCodes::KeyHelp: return "KeyHelp";
-				case KeyCodes::KeyMenu: return "KeyMenu";
-				case KeyCodes::KeySelect: return "KeySelect";
-				case KeyCodes::KeyStop: return "KeyStop";
-				case KeyCodes::KeyAgain: return "KeyAgain";
-				case KeyCodes::KeyUndo: return "KeyUndo";
-				case KeyCodes::KeyCut: return "KeyCut";
-				case KeyCodes::KeyCopy: return "KeyCopy";
-				case KeyCodes::KeyPaste: return "KeyPaste";
-				case KeyCodes::KeyFind: return "KeyFind";
-				case KeyCodes::KeyMute: return "KeyMute";
-				case KeyCodes::KeyVolumeup: return "KeyVolumeup";
-				case KeyCodes::KeyVolumedown: return "KeyVolumedown";
-				case KeyCodes::KeyKpComma: return "KeyKpComma";
-				case KeyCodes::KeyKpEqualsas400: return "KeyKpEqualsas400";
-				case KeyCodes::KeyAlterase: return "KeyAlterase";
-				case KeyCodes::KeySysreq: return "KeySysreq";
-				case KeyCodes::KeyCancel: return "KeyCancel";
-				case KeyCodes::KeyClear: return "KeyClear";
-				case KeyCodes::KeyPrior: return "KeyPrior";
-				case KeyCodes::KeyReturn2: return "KeyReturn2";
-				case KeyCodes::KeySeparator: return "KeySeparator";
-				case KeyCodes::KeyOut: return "KeyOut";
-				case KeyCodes::KeyOper: return "KeyOper";
-				case KeyCodes::KeyClearagain: return "KeyClearagain";
-				case KeyCodes::KeyCrsel: return "KeyCrsel";
-				case KeyCodes::KeyExsel: return "KeyExsel";
-				case KeyCodes::KeyKp00: return "KeyKp00";
-				case KeyCodes::KeyKp000: return "KeyKp000";
-				case KeyCodes::KeyThousandsseparator: return "KeyThousandsseparator";
-				case KeyCodes::KeyDecimalseparator: return "KeyDecimalseparator";
-				case KeyCodes::KeyCurrencyunit: return "KeyCurrencyunit";
-				case KeyCodes::KeyCurrencysubunit: return "KeyCurrencysubunit";
-				case KeyCodes::KeyKpLeftparen: return "KeyKpLeftparen";
-				case KeyCodes::KeyKpRightparen: return "KeyKpRightparen";
-				case KeyCodes::KeyKpLeftbrace: return "KeyKpLeftbrace";
-				case KeyCodes::KeyKpRightbrace: return "KeyKpRightbrace";
-				case KeyCodes::KeyKpTab: return "KeyKpTab";
-				case KeyCodes::KeyKpBackspace: return "KeyKpBackspace";
-				case KeyCodes::KeyKpA: return "KeyKpA";
-				case KeyCodes::KeyKpB: return "KeyKpB";
-				case KeyCodes::KeyKpC: return "KeyKpC";
-				case KeyCodes::KeyKpD: return "KeyKpD";
-				case KeyCodes::KeyKpE: return "KeyKpE";
-				case KeyCodes::KeyKpF: return "KeyKpF";
-				case KeyCodes::KeyKpXor: return "KeyKpXor";
-				case KeyCodes::KeyKpPower: return "KeyKpPower";
-				case KeyCodes::KeyKpPercent: return "KeyKpPercent";
-				case KeyCodes::KeyKpLess: return "KeyKpLess";
-				case KeyCodes::KeyKpGreater: return "KeyKpGreater";
-				case KeyCodes::KeyKpAmpersand: return "KeyKpAmpersand";
-				case KeyCodes::KeyKpDblampersand: return "KeyKpDblampersand";
-				case KeyCodes::KeyKpVerticalbar: return "KeyKpVerticalbar";
-				case KeyCodes::KeyKpDblverticalbar: return "KeyKpDblverticalbar";
-				case KeyCodes::KeyKpColon: return "KeyKpColon";
-				case KeyCodes::KeyKpHash: return "KeyKpHash";
-				case KeyCodes::KeyKpSpace: return "KeyKpSpace";
-				case KeyCodes::KeyKpAt: return "KeyKpAt";
-				case KeyCodes::KeyKpExclam: return "KeyKpExclam";
-				case KeyCodes::KeyKpMemstore: return "KeyKpMemstore";
-				case KeyCodes::KeyKpMemrecall: return "KeyKpMemrecall";
-				case KeyCodes::KeyKpMemclear: return "KeyKpMemclear";
-				case KeyCodes::KeyKpMemadd: return "KeyKpMemadd";
-				case KeyCodes::KeyKpMemsubtract: return "KeyKpMemsubtract";
-				case KeyCodes::KeyKpMemmultiply: return "KeyKpMemmultiply";
-				case KeyCodes::KeyKpMemdivide: return "KeyKpMemdivide";
-				case KeyCodes::KeyKpPlusminus: return "KeyKpPlusminus";
-				case KeyCodes::KeyKpClear: return "KeyKpClear";
-				case KeyCodes::KeyKpClearentry: return "KeyKpClearentry";
-				case KeyCodes::KeyKpBinary: return "KeyKpBinary";
-				case KeyCodes::KeyKpOctal: return "KeyKpOctal";
-				case KeyCodes::KeyKpDecimal: return "KeyKpDecimal";
-				case KeyCodes::KeyKpHexadecimal: return "KeyKpHexadecimal";
-				case KeyCodes::KeyLctrl: return "KeyLctrl";
-				case KeyCodes::KeyLshift: return "KeyLshift";
-				case KeyCodes::KeyLalt: return "KeyLalt";
-				case KeyCodes::KeyLgui: return "KeyLgui";
-				case KeyCodes::KeyRctrl: return "KeyRctrl";
-				case KeyCodes::KeyRshift: return "KeyRshift";
-				case KeyCodes::KeyRalt: return "KeyRalt";
-				case KeyCodes::KeyRgui: return "KeyRgui";
-				case KeyCodes::KeyMode: return "KeyMode";
-				case KeyCodes::KeyAudionext: return "KeyAudionext";
-				case KeyCodes::KeyAudioprev: return "KeyAudioprev";
-				case KeyCodes::KeyAudiostop: return "KeyAudiostop";
-				case KeyCodes::KeyAudioplay: return "KeyAudioplay";
-				case KeyCodes::KeyAudiomute: return "KeyAudiomute";
-				case KeyCodes::KeyMediaselect: return "KeyMediaselect";
-				case KeyCodes::KeyWww: return "KeyWww";
-				case KeyCodes::KeyMail: return "KeyMail";
-				case KeyCodes::KeyCalculator: return "KeyCalculator";
-				case KeyCodes::KeyComputer: return "KeyComputer";
-				case KeyCodes::KeyAcSearch: return "KeyAcSearch";
-				case KeyCodes::KeyAcHome: return "KeyAcHome";
-				case KeyCodes::KeyAcBack: return "KeyAcBack";
-				case KeyCodes::KeyAcForward: return "KeyAcForward";
-				case KeyCodes::KeyAcStop: return "KeyAcStop";
-				case KeyCodes::KeyAcRefresh: return "KeyAcRefresh";
-				case KeyCodes::KeyAcBookmarks: return "KeyAcBookmarks";
-				case KeyCodes::KeyBrightnessdown: return "KeyBrightnessdown";
-				case KeyCodes::KeyBrightnessup: return "KeyBrightnessup";
-				case KeyCodes::KeyDisplayswitch: return "KeyDisplayswitch";
-				case KeyCodes::KeyKbdillumtoggle: return "KeyKbdillumtoggle";
-				case KeyCodes::KeyKbdillumdown: return "KeyKbdillumdown";
-				case KeyCodes::KeyKbdillumup: return "KeyKbdillumup";
-				case KeyCodes::KeyEject: return "KeyEject";
-				case KeyCodes::KeySleep: return "KeySleep";
-				case KeyCodes::KeyApp1: return "KeyApp1";
-				case KeyCodes::KeyApp2: return "KeyApp2";
-				case KeyCodes::KeyAudiorewind: return "KeyAudiorewind";
-				case KeyCodes::KeyAudiofastforward: return "KeyAudiofastforward";
-				case KeyCodes::MouseLeft: return "MouseLeft";
-				case KeyCodes::MouseRight: return "MouseRight";
-				case KeyCodes::MouseMiddle: return "MouseMiddle";
-				case KeyCodes::MouseX1: return "MouseX1";
-				case KeyCodes::MouseX2: return "MouseX2";
-			}
-			return "Unknown";
+				if (SdlToEzKeyCode(key.Sdl) != key.Code) {
+					return false;
+				}
+			}
+			return true;
+		}
+		static_assert(ValidateSdlKeyCodes(), "Sdl key codes table contains duplicated or out of range key codes.");
+
+		// create input manager
+		Input::Input()
+		{
+			std::fill(std::begin(_keyBinds), std::end(_keyBinds), InvalidActionId);
 		}
 
 		// init input manager
 		void Input::_Initialize()
 		{
+			// init gamepads support (connected gamepads will be opened when we get their 'added' events)
+			if (SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) < 0)
+			{
+				BON_WLOG_CAT(Input, "Failed to init gamepads support! SDL_Error: %s", SDL_GetError());
+			}
 		}
 
 		// dispose input resources
 		void Input::_Dispose()
 		{
+			StopRecording();
 			SDL_StopTextInput();
+
+			// close gamepads
+			for (int i = 0; i < MaxGamepads; ++i)
+			{
+				if (_gamepads[i].Controller) 
+				{
+					SDL_GameControllerClose(_gamepads[i].Controller);
+					_gamepads[i] = _GamepadState();
+				}
+			}
+			SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
 		}
 
 		// do updates
 		void Input::_Update(double deltaTime)
 		{
+			// if recording, write previous frame's input before resetting it
+			if (_recordFramePending) {
+				WriteRecordedFrame();
+			}
+
 			// reset current frame's text input data
 			_textInputData = TextInputData();
 
 			// copy current cursor position to previous frame cursor position
 			_prevCursorPosition = _cursorPosition;
 
+			// reset mouse wheel delta
+			_scrollDelta.Reset();
+
+			// replaying? take input from recording
+			if (_replaying)
+			{
+				ReadRecordedFrame();
+			}
 			// get new cursor position
-			SDL_GetMouseState(&_cursorPosition.X, &_cursorPosition.Y);
+			else
+			{
+				SDL_GetMouseState(&_cursorPosition.X, &_cursorPosition.Y);
+			}
 			
 			// calculate mouse delta
 			_cursorMovement.Set(_cursorPosition.X - _prevCursorPosition.X, _cursorPosition.Y - _prevCursorPosition.Y);
 
-			// reset mouse wheel delta
-			_scrollDelta.Reset();
+			// start recording this frame
+			if (IsRecording())
+			{
+				_recordDeltaTime = deltaTime;
+				_recordKeyEvents.clear();
+				_recordFramePending = true;
+			}
+		}
+
+		// input recording magic and version
+		const char InputRecordingMagic[4] = { 'B', 'I', 'N', 'P' };
+		const uint32_t InputRecordingVersion = 1;
+
+		// input recording file header
+		struct InputRecordingHeader
+		{
+			char Magic[4];
+			uint32_t Version;
+		};
+
+		// a single recorded frame header.
+		// followed by 'KeyEventsCount' key events (uint16: key code << 1 | is down), and 'TextLength' bytes of text input.
+		struct RecordedFrameHeader
+		{
+			double DeltaTime;
+			int32_t CursorX;
+			int32_t CursorY;
+			int32_t ScrollX;
+			int32_t ScrollY;
+			uint16_t KeyEventsCount;
+			uint16_t TextFlags;
+			uint8_t TextLength;
+			uint8_t Reserved[3];
+		};
+		static_assert(sizeof(RecordedFrameHeader) == 32, "Recorded frame header must be packed.");
+
+		// text input flags in recorded frames
+		enum RecordedTextFlags : uint16_t
+		{
+			TextBackspace = 1 << 0,
+			TextDelete = 1 << 1,
+			TextCopy = 1 << 2,
+			TextPaste = 1 << 3,
+			TextTab = 1 << 4,
+			TextUp = 1 << 5,
+			TextDown = 1 << 6,
+			TextLeft = 1 << 7,
+			TextRight = 1 << 8,
+			TextHome = 1 << 9,
+			TextEnd = 1 << 10,
+			TextInsert = 1 << 11,
+		};
+
+		// set key state from event
+		void Input::SetKeyStateFromEvent(KeyCodes key, bool state)
+		{
+			// when replaying, key states only come from the recording. this also covers key states derived
+			// from gamepads (like releasing buttons of a disconnected gamepad), which would desync the replay
+			if (_replaying) {
+				return;
+			}
+			if ((unsigned int)key >= (unsigned int)KeyCodesCount || _currKeyStates[(int)key].IsDown == state) {
+				return;
+			}
+			if (_recordFramePending) {
+				_recordKeyEvents.push_back((uint16_t)(((int)key << 1) | (state ? 1 : 0)));
+			}
+			SetKeyState(key, state);
+		}
+
+		// start recording input
+		void Input::StartRecording(const char* filename)
+		{
+			if (_replaying) {
+				throw framework::InvalidState("Can't record input while replaying recorded input!");
+			}
+			StopRecording();
+
+			// open file and write header
+			_recordFile.open(filename, std::ios::binary | std::ios::trunc);
+			if (!_recordFile.is_open()) {
+				throw framework::InvalidValue((std::string("Failed to open input recording file '") + filename + "' for writing.").c_str());
+			}
+			InputRecordingHeader header;
+			memcpy(header.Magic, InputRecordingMagic, sizeof(InputRecordingMagic));
+			header.Version = InputRecordingVersion;
+			_recordFile.write((const char*)&header, sizeof(header));
+
+			// note: first frame starts on next update
+			BON_ILOG_CAT(Input, "Start recording input to '%s'.", filename);
+		}
+
+		// stop recording input
+		void Input::StopRecording()
+		{
+			if (!_recordFile.is_open()) {
+				return;
+			}
+			if (_recordFramePending) {
+				WriteRecordedFrame();
+			}
+			_recordFile.close();
+			BON_ILOG_CAT(Input, "Stopped recording input.");
+		}
+
+		// write current frame to recording
+		void Input::WriteRecordedFrame()
+		{
+			_recordFramePending = false;
+
+			// build frame header
+			RecordedFrameHeader frame = {};
+			frame.DeltaTime = _recordDeltaTime;
+			frame.CursorX = _cursorPosition.X;
+			frame.CursorY = _cursorPosition.Y;
+			frame.ScrollX = _scrollDelta.X;
+			frame.ScrollY = _scrollDelta.Y;
+			frame.KeyEventsCount = (uint16_t)std::min(_recordKeyEvents.size(), (size_t)UINT16_MAX);
+			frame.TextFlags = 
+				(_textInputData.Backspace ? TextBackspace : 0) | (_textInputData.Delete ? TextDelete : 0) |
+				(_textInputData.Copy ? TextCopy : 0) | (_textInputData.Paste ? TextPaste : 0) |
+				(_textInputData.Tab ? TextTab : 0) | (_textInputData.Up ? TextUp : 0) |
+				(_textInputData.Down ? TextDown : 0) | (_textInputData.Left ? TextLeft : 0) |
+				(_textInputData.Right ? TextRight : 0) | (_textInputData.Home ? TextHome : 0) |
+				(_textInputData.End ? TextEnd : 0) | (_textInputData.Insert ? TextInsert : 0);
+			frame.TextLength = (uint8_t)strnlen(_textInputData.Text, sizeof(_textInputData.Text) - 1);
+
+			// write frame
+			_recordFile.write((const char*)&frame, sizeof(frame));
+			_recordFile.write((const char*)_recordKeyEvents.data(), frame.KeyEventsCount * sizeof(uint16_t));
+			_recordFile.write(_textInputData.Text, frame.TextLength);
+		}
+
+		// start replaying input
+		void Input::StartReplay(const char* filename, bool exitWhenDone)
+		{
+			StopRecording();
+
+			// read file
+			std::ifstream file(filename, std::ios::binary | std::ios::ate);
+			if (!file.good()) {
+				throw framework::AssetLoadError((std::string("Failed to open input recording file '") + filename + "'.").c_str());
+			}
+			size_t size = (size_t)file.tellg();
+			file.seekg(0);
+			_replayData.resize(size);
+			file.read(_replayData.data(), size);
+
+			// validate header
+			InputRecordingHeader header;
+			if (size < sizeof(header)) {
+				throw framework::AssetLoadError("Invalid input recording file: bad header.");
+			}
+			memcpy(&header, _replayData.data(), sizeof(header));
+			if (memcmp(header.Magic, InputRecordingMagic, sizeof(InputRecordingMagic)) != 0 || header.Version != InputRecordingVersion) {
+				throw framework::AssetLoadError("Invalid input recording file: bad header or unsupported version.");
+			}
+
+			// start replay and release all keys, so live input won't leak into replay
+			_replayPosition = sizeof(header);
+			_replaying = true;
+			_exitWhenReplayDone = exitWhenDone;
+			for (int i = 0; i < KeyCodesCount; ++i) {
+				SetKeyState((KeyCodes)i, false);
+			}
+			BON_ILOG_CAT(Input, "Start replaying input from '%s'.", filename);
+		}
+
+		// stop replaying input
+		void Input::StopReplay()
+		{
+			if (!_replaying) {
+				return;
+			}
+			_replaying = false;
+			_replayData.clear();
+			_replayPosition = 0;
+			for (int i = 0; i < KeyCodesCount; ++i) {
+				SetKeyState((KeyCodes)i, false);
+			}
+			BON_ILOG_CAT(Input, "Stopped replaying input.");
+			if (_exitWhenReplayDone) {
+				_GetEngine().Game().Exit();
+			}
+		}
+
+		// override delta time with recorded value
+		void Input::_OverrideDeltaTime(double& deltaTime)
+		{
+			if (_replaying && _replayPosition + sizeof(RecordedFrameHeader) <= _replayData.size())
+			{
+				memcpy(&deltaTime, _replayData.data() + _replayPosition + offsetof(RecordedFrameHeader, DeltaTime), sizeof(double));
+			}
+		}
+
+		// read and apply next recorded frame
+		void Input::ReadRecordedFrame()
+		{
+			// reached end?
+			if (_replayPosition >= _replayData.size()) {
+				BON_ILOG_CAT(Input, "Input replay reached end of recording.");
+				StopReplay();
+				return;
+			}
+
+			// read frame header and validate size
+			RecordedFrameHeader frame;
+			size_t frameSize = sizeof(frame);
+			if (_replayPosition + frameSize <= _replayData.size()) {
+				memcpy(&frame, _replayData.data() + _replayPosition, sizeof(frame));
+				frameSize += frame.KeyEventsCount * sizeof(uint16_t) + frame.TextLength;
+			}
+			if (_replayPosition + frameSize > _replayData.size() || frame.TextLength >= sizeof(_textInputData.Text)) {
+				BON_ELOG_CAT(Input, "Input recording is corrupted at offset %d, stop replay.", (int)_replayPosition);
+				StopReplay();
+				return;
+			}
+			const char* data = _replayData.data() + _replayPosition + sizeof(frame);
+			_replayPosition += frameSize;
+
+			// apply cursor and scroll
+			_cursorPosition.Set(frame.CursorX, frame.CursorY);
+			_scrollDelta.Set(frame.ScrollX, frame.ScrollY);
+
+			// apply keys
+			for (uint16_t i = 0; i < frame.KeyEventsCount; ++i) {
+				uint16_t keyEvent;
+				memcpy(&keyEvent, data + i * sizeof(uint16_t), sizeof(uint16_t));
+				SetKeyState((KeyCodes)(keyEvent >> 1), (keyEvent & 1) != 0);
+			}
+
+			// apply text input
+			_textInputData.Backspace = (frame.TextFlags & TextBackspace) != 0;
+			_textInputData.Delete = (frame.TextFlags & TextDelete) != 0;
+			_textInputData.Copy = (frame.TextFlags & TextCopy) != 0;
+			_textInputData.Paste = (frame.TextFlags & TextPaste) != 0;
+			_textInputData.Tab = (frame.TextFlags & TextTab) != 0;
+			_textInputData.Up = (frame.TextFlags & TextUp) != 0;
+			_textInputData.Down = (frame.TextFlags & TextDown) != 0;
+			_textInputData.Left = (frame.TextFlags & TextLeft) != 0;
+			_textInputData.Right = (frame.TextFlags & TextRight) != 0;
+			_textInputData.Home = (frame.TextFlags & TextHome) != 0;
+			_textInputData.End = (frame.TextFlags & TextEnd) != 0;
+			_textInputData.Insert = (frame.TextFlags & TextInsert) != 0;
+			memcpy(_textInputData.Text, data + frame.KeyEventsCount * sizeof(uint16_t), frame.TextLength);
+			_textInputData.Text[frame.TextLength] = '\0';
 		}
 
 		// set cursor position
@@ -582,12 +663,12 @@ namespace bon
 		void Input::_Start()
 		{
 			// if started and user didn't do any maps, do default mappings
-			if (_keyBinds.empty()) {
-				BON_ILOG("Set default key bindings.");
+			if (_keyBindsCount == 0) {
+				BON_ILOG_CAT(Input, "Set default key bindings.");
 				SetDefaultKeyBinds();
 			}
 			else {
-				BON_ILOG("Skip setting default key bindings, because user defined his own map.");
+				BON_ILOG_CAT(Input, "Skip setting default key bindings, because user defined his own map.");
 			}
 
 			// enable text input
@@ -647,13 +728,63 @@ namespace bon
 		// set a key binding
 		void Input::SetKeyBind(KeyCodes keyCode, const char* actionId)
 		{
-			BON_DLOG("Bind key: %s --> '%s'.", KeyCodeToString(keyCode), actionId);
-			(_keyBinds)[keyCode] = std::string(actionId);
+			// sanity
+			if ((unsigned int)keyCode >= (unsigned int)KeyCodesCount)
+			{
+				throw framework::InvalidValue("Invalid key code to bind!");
+			}
+
+			// null action - unbind key
+			BON_DLOG_CAT(Input, "Bind key: %s --> '%s'.", _KeyCodeToString(keyCode), actionId ? actionId : "(none)");
+			ActionId& bind = _keyBinds[(int)keyCode];
+			if (actionId == nullptr)
+			{
+				if (bind != InvalidActionId) { _keyBindsCount--; }
+				bind = InvalidActionId;
+				return;
+			}
+
+			// bind key
+			if (bind == InvalidActionId) { _keyBindsCount++; }
+			bind = GetActionId(actionId);
+		}
+
+		// get or create action id
+		ActionId Input::GetActionId(const char* actionId)
+		{
+			auto found = _actionIds.find(actionId);
+			if (found != _actionIds.end())
+			{
+				return found->second;
+			}
+			ActionId ret = (ActionId)_actionNames.size();
+			_actionIds[actionId] = ret;
+			_actionNames.push_back(actionId);
+			_actionStates.push_back(_ActionStates());
+			return ret;
+		}
+
+		// find action id without creating it
+		ActionId Input::FindActionId(const char* actionId) const
+		{
+			auto found = _actionIds.find(actionId);
+			return found != _actionIds.end() ? found->second : InvalidActionId;
 		}
 
 		// handle events
 		void Input::_HandleEvent(SDL_Event& event)
 		{
+			// gamepad events
+			if (event.type >= SDL_CONTROLLERAXISMOTION && event.type <= SDL_CONTROLLERDEVICEREMAPPED) {
+				HandleGamepadEvent(event);
+				return;
+			}
+
+			// when replaying recorded input, ignore input from OS
+			if (_replaying) {
+				return;
+			}
+
 			// check event type
 			switch (event.type) {
 
@@ -665,22 +796,22 @@ namespace bon
 				// key down
 				case SDL_KEYDOWN:
 					HandleTextInput(event);
-					SetKeyState(SdlToEzKeyCode((int)(event.key.keysym.sym)), true);
+					SetKeyStateFromEvent(SdlToEzKeyCode((int)(event.key.keysym.sym)), true);
 					break;
 
 				// key up
 				case SDL_KEYUP:	
-					SetKeyState(SdlToEzKeyCode((int)(event.key.keysym.sym)), false);
+					SetKeyStateFromEvent(SdlToEzKeyCode((int)(event.key.keysym.sym)), false);
 					break;
 
 				// mouse button down
 				case SDL_MOUSEBUTTONDOWN:
-					SetKeyState(SdlToEzMouseCode((int)(event.button.button)), true);
+					SetKeyStateFromEvent(SdlToEzMouseCode((int)(event.button.button)), true);
 					break;
 
 				// mouse button up
 				case SDL_MOUSEBUTTONUP:
-					SetKeyState(SdlToEzMouseCode((int)(event.button.button)), false);
+					SetKeyStateFromEvent(SdlToEzMouseCode((int)(event.button.button)), false);
 					break;
 
 				// text input event
@@ -690,6 +821,217 @@ namespace bon
 			}
 		}
 
+		// gamepad trigger value above which trigger acts as pressed button
+		const float GamepadTriggerPressThreshold = 0.5f;
+
+		// handle gamepad events
+		void Input::HandleGamepadEvent(SDL_Event& event)
+		{
+			switch (event.type)
+			{
+				// gamepad connected - assign to first free player slot
+				case SDL_CONTROLLERDEVICEADDED:
+				{
+					int deviceIndex = event.cdevice.which;
+					if (!SDL_IsGameController(deviceIndex)) { 
+						return; 
+					}
+					int instanceId = (int)SDL_JoystickGetDeviceInstanceID(deviceIndex);
+					if (GetGamepadPlayer(instanceId) != -1) {
+						return;
+					}
+					for (int i = 0; i < MaxGamepads; ++i)
+					{
+						if (_gamepads[i].Controller == nullptr)
+						{
+							SDL_GameController* controller = SDL_GameControllerOpen(deviceIndex);
+							if (controller == nullptr) {
+								BON_WLOG_CAT(Input, "Failed to open gamepad! SDL_Error: %s", SDL_GetError());
+								return;
+							}
+							_gamepads[i].Controller = controller;
+							_gamepads[i].InstanceId = (int)SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controller));
+							BON_ILOG_CAT(Input, "Gamepad '%s' connected as player %d.", SDL_GameControllerName(controller), i);
+							return;
+						}
+					}
+					BON_WLOG_CAT(Input, "Gamepad connected, but all %d gamepad slots are taken.", MaxGamepads);
+					break;
+				}
+
+				// gamepad disconnected - release its buttons and free its slot
+				case SDL_CONTROLLERDEVICEREMOVED:
+				{
+					int player = GetGamepadPlayer(event.cdevice.which);
+					if (player == -1) {
+						return;
+					}
+					for (int button = 0; button < GamepadButtonsCount; ++button) {
+						SetGamepadButtonState(player, button, false);
+					}
+					SDL_GameControllerClose(_gamepads[player].Controller);
+					_gamepads[player] = _GamepadState();
+					BON_ILOG_CAT(Input, "Gamepad of player %d disconnected.", player);
+					break;
+				}
+
+				// gamepad button down / up
+				case SDL_CONTROLLERBUTTONDOWN:
+				case SDL_CONTROLLERBUTTONUP:
+				{
+					int player = GetGamepadPlayer(event.cbutton.which);
+					int button = (int)event.cbutton.button;
+					if (_replaying || player == -1 || button < 0 || button >= GamepadButtonsCount) {
+						return;
+					}
+					SetGamepadButtonState(player, button, event.type == SDL_CONTROLLERBUTTONDOWN);
+					break;
+				}
+
+				// gamepad axis motion
+				case SDL_CONTROLLERAXISMOTION:
+				{
+					int player = GetGamepadPlayer(event.caxis.which);
+					int axis = (int)event.caxis.axis;
+					if (_replaying || player == -1 || axis < 0 || axis >= GamepadAxesCount) {
+						return;
+					}
+					float value = std::max(-1.0f, (float)event.caxis.value / 32767.0f);
+					_gamepads[player].Axes[axis] = value;
+
+					// triggers also act as buttons
+					if (axis == (int)GamepadAxes::LeftTrigger || axis == (int)GamepadAxes::RightTrigger)
+					{
+						KeyCodes button = (axis == (int)GamepadAxes::LeftTrigger) ? KeyCodes::GamepadLeftTrigger : KeyCodes::GamepadRightTrigger;
+						SetGamepadButtonState(player, (int)button - (int)KeyCodes::GamepadA, value > GamepadTriggerPressThreshold);
+					}
+					break;
+				}
+			}
+		}
+
+		// set gamepad button state
+		void Input::SetGamepadButtonState(int player, int button, bool state)
+		{
+			// update player's button state
+			_ActionStates& buttonState = _gamepads[player].Buttons[button];
+			if (buttonState.IsDown == state) {
+				return;
+			}
+			buttonState.IsDown = state;
+			buttonState.UpdateFrameId = _GetEngine().UpdatesCount();
+			buttonState.FixedUpdateFrameId = _GetEngine().FixedUpdatesCount();
+
+			// update gamepad key code, which is down while any player holds it
+			bool anyDown = state;
+			for (int i = 0; i < MaxGamepads && !anyDown; ++i) {
+				anyDown = _gamepads[i].Buttons[button].IsDown;
+			}
+			SetKeyStateFromEvent((KeyCodes)((int)KeyCodes::GamepadA + button), anyDown);
+		}
+
+		// get player index from gamepad instance id
+		int Input::GetGamepadPlayer(int instanceId) const
+		{
+			for (int i = 0; i < MaxGamepads; ++i)
+			{
+				if (_gamepads[i].Controller && _gamepads[i].InstanceId == instanceId) {
+					return i;
+				}
+			}
+			return -1;
+		}
+
+		// get if gamepad is connected
+		bool Input::GamepadConnected(int player) const
+		{
+			return player >= 0 && player < MaxGamepads && _gamepads[player].Controller != nullptr;
+		}
+
+		// get connected gamepads count
+		int Input::GamepadsCount() const
+		{
+			int ret = 0;
+			for (int i = 0; i < MaxGamepads; ++i) {
+				if (_gamepads[i].Controller) { ret++; }
+			}
+			return ret;
+		}
+
+		// get gamepad button state
+		KeyStates Input::GetGamepadButtonState(int player, KeyCodes button) const
+		{
+			int index = (int)button - (int)KeyCodes::GamepadA;
+			if (player < 0 || player >= MaxGamepads || index < 0 || index >= GamepadButtonsCount) {
+				return KeyStates::Released;
+			}
+			return GetState(_gamepads[player].Buttons[index]);
+		}
+
+		// get if gamepad button is down
+		bool Input::GamepadDown(int player, KeyCodes button) const
+		{
+			auto state = GetGamepadButtonState(player, button);
+			return state == KeyStates::PressedNow || state == KeyStates::Pressed;
+		}
+
+		// get if gamepad button was pressed now
+		bool Input::GamepadPressedNow(int player, KeyCodes button) const
+		{
+			return GetGamepadButtonState(player, button) == KeyStates::PressedNow;
+		}
+
+		// get if gamepad button was released now
+		bool Input::GamepadReleasedNow(int player, KeyCodes button) const
+		{
+			return GetGamepadButtonState(player, button) == KeyStates::ReleasedNow;
+		}
+
+		// get gamepad axis value
+		float Input::GamepadAxis(int player, GamepadAxes axis) const
+		{
+			if (player < 0 || player >= MaxGamepads || (int)axis < 0 || (int)axis >= GamepadAxesCount) {
+				return 0.0f;
+			}
+			const float* axes = _gamepads[player].Axes;
+
+			// triggers - linear dead zone
+			if (axis == GamepadAxes::LeftTrigger || axis == GamepadAxes::RightTrigger)
+			{
+				float value = axes[(int)axis];
+				return (value <= _triggersDeadZone) ? 0.0f : std::min(1.0f, (value - _triggersDeadZone) / (1.0f - _triggersDeadZone));
+			}
+
+			// sticks - radial dead zone, based on both axes of the stick
+			int first = (axis == GamepadAxes::LeftX || axis == GamepadAxes::LeftY) ? (int)GamepadAxes::LeftX : (int)GamepadAxes::RightX;
+			float x = axes[first];
+			float y = axes[first + 1];
+			float length = sqrtf(x * x + y * y);
+			if (length <= _sticksDeadZone) {
+				return 0.0f;
+			}
+			float scale = (std::min(length, 1.0f) - _sticksDeadZone) / (1.0f - _sticksDeadZone) / length;
+			return axes[(int)axis] * scale;
+		}
+
+		// set gamepad dead zones
+		void Input::SetGamepadDeadZones(float sticks, float triggers)
+		{
+			_sticksDeadZone = std::min(std::max(sticks, 0.0f), 0.99f);
+			_triggersDeadZone = std::min(std::max(triggers, 0.0f), 0.99f);
+		}
+
+		// rumble gamepad
+		bool Input::GamepadRumble(int player, float lowFrequency, float highFrequency, unsigned int durationMs)
+		{
+			if (!GamepadConnected(player)) {
+				return false;
+			}
+			Uint16 low = (Uint16)(std::min(std::max(lowFrequency, 0.0f), 1.0f) * 0xFFFF);
+			Uint16 high = (Uint16)(std::min(std::max(highFrequency, 0.0f), 1.0f) * 0xFFFF);
+			return SDL_GameControllerRumble(_gamepads[player].Controller, low, high, durationMs) == 0;
+		}
+
 		// set clipboard value.
 		void Input::SetClipboard(const char* text)
 		{
@@ -702,14 +1044,15 @@ namespace bon
 			// clear previous key binds
 			if (removePreviousBinds)
 			{
-				_keyBinds.clear();
+				std::fill(std::begin(_keyBinds), std::end(_keyBinds), InvalidActionId);
+				_keyBindsCount = 0;
 			}
 
 			// load keys
 			if (config->Exists("controls"))
 			{
-				auto controls = config->Keys("controls");
-				for (auto key : controls)
+				const auto& controls = config->Keys("controls");
+				for (const auto& key : controls)
 				{
 					KeyCodes keyCode = _StrToKeyCode(key.c_str());
 					const char* action = config->GetStr("controls", key.c_str(), nullptr);
@@ -813,48 +1156,65 @@ namespace bon
 		// set key state
 		void Input::SetKeyState(KeyCodes key, bool value)
 		{
-			// get existing value
-			bool currVal = (_currKeyStates)[key].IsDown;
+			// ignore unknown keys
+			if ((unsigned int)key >= (unsigned int)KeyCodesCount) {
+				return;
+			}
 
 			// if didn't change, stop here!
-			if (value == currVal) {
+			_ActionStates& state = _currKeyStates[(int)key];
+			if (value == state.IsDown) {
 				return;
 			}
 
 			// set key state
-			_ActionStates state;
 			state.IsDown = value;
 			state.UpdateFrameId = _GetEngine().UpdatesCount();
 			state.FixedUpdateFrameId = _GetEngine().FixedUpdatesCount();
-			(_currKeyStates)[key] = state;
 
 			// check if this key is bound to action, and if so set action as well
-			if (_keyBinds.find(key) != _keyBinds.end()) 
+			ActionId action = _keyBinds[(int)key];
+			if (action != InvalidActionId) 
 			{
-				const char* action = (_keyBinds)[key].c_str();
-				(_actionStates)[std::move(action)] = state;
+				_actionStates[action] = state;
 			}
 		}
 
 		// get if given action is down
 		bool Input::Down(const char* actionId) const
 		{
-			auto state = GetState(actionId);
-			return state == KeyStates::PressedNow || state == KeyStates::Pressed;
+			return Down(FindActionId(actionId));
 		}
 
 		// get if a given game action was released this frame
 		bool Input::ReleasedNow(const char* actionId) const
 		{
-			auto state = GetState(actionId);
-			return state == KeyStates::ReleasedNow;
+			return ReleasedNow(FindActionId(actionId));
 		}
 
 		// get if a given game action was pressed this frame
 		bool Input::PressedNow(const char* actionId) const
 		{
-			auto state = GetState(actionId);
-			return state == KeyStates::PressedNow;
+			return PressedNow(FindActionId(actionId));
+		}
+
+		// get if given action is down
+		bool Input::Down(ActionId action) const
+		{
+			auto state = GetState(action);
+			return state == KeyStates::PressedNow || state == KeyStates::Pressed;
+		}
+
+		// get if a given game action was released this frame
+		bool Input::ReleasedNow(ActionId action) const
+		{
+			return GetState(action) == KeyStates::ReleasedNow;
+		}
+
+		// get if a given game action was pressed this frame
+		bool Input::PressedNow(ActionId action) const
+		{
+			return GetState(action) == KeyStates::PressedNow;
 		}
 
 		// get if a key is currently down
@@ -879,25 +1239,32 @@ namespace bon
 		}
 
 		// get action state
-		KeyStates Input::GetState(const char* actionId) const
+		KeyStates Input::GetState(ActionId action) const
 		{
-			_ActionStates state = ((Input*)(this))->_actionStates[std::move(actionId)];
-			bool wasUpdateNow = (_GetEngine().CurrentState() == engine::EngineStates::Update && _GetEngine().UpdatesCount() == state.UpdateFrameId) ||
-				(_GetEngine().CurrentState() == engine::EngineStates::FixedUpdate && _GetEngine().FixedUpdatesCount() == state.FixedUpdateFrameId);
-			if (state.IsDown) {
-				return wasUpdateNow ? KeyStates::PressedNow : KeyStates::Pressed;
-			}
-			else {
-				return wasUpdateNow ? KeyStates::ReleasedNow : KeyStates::Released;
+			// unknown actions are never pressed
+			if ((unsigned int)action >= (unsigned int)_actionStates.size()) {
+				return KeyStates::Released;
 			}
+			return GetState(_actionStates[action]);
 		}
 
 		// get key state
 		KeyStates Input::GetState(KeyCodes keyCode) const
 		{
-			_ActionStates state = ((Input*)(this))->_currKeyStates[keyCode];
-			bool wasUpdateNow = (_GetEngine().CurrentState() == engine::EngineStates::Update && _GetEngine().UpdatesCount() == state.UpdateFrameId) ||
-				(_GetEngine().CurrentState() == engine::EngineStates::FixedUpdate && _GetEngine().FixedUpdatesCount() == state.FixedUpdateFrameId);
+			if ((unsigned int)keyCode >= (unsigned int)KeyCodesCount) {
+				return KeyStates::Released;
+			}
+			return GetState(_currKeyStates[(int)keyCode]);
+		}
+
+		// get key state from stored state.
+		// note: 'now' edges are not computed per frame, instead every state is stamped with the update and fixed update it changed in.
+		KeyStates Input::GetState(const _ActionStates& state) const
+		{
+			auto& engine = _GetEngine();
+			auto engineState = engine.CurrentState();
+			bool wasUpdateNow = (engineState == engine::EngineStates::Update && engine.UpdatesCount() == state.UpdateFrameId) ||
+				(engineState == engine::EngineStates::FixedUpdate && engine.FixedUpdatesCount() == state.FixedUpdateFrameId);
 			if (state.IsDown) {
 				return wasUpdateNow ? KeyStates::PressedNow : KeyStates::Pressed;
 			}
@@ -910,12 +1277,13 @@ namespace bon
 		std::vector<KeyCodes> Input::GetAssignedKeys(const char* actionId) const
 		{
 			std::vector<KeyCodes> ret;
-			std::string actionIdStr(actionId);
-			for (auto x : _keyBinds)
+			ActionId action = FindActionId(actionId);
+			if (action == InvalidActionId) { return ret; }
+			for (int i = 0; i < KeyCodesCount; ++i)
 			{
-				if (x.second == actionIdStr)
+				if (_keyBinds[i] == action)
 				{
-					ret.push_back(x.first);
+					ret.push_back((KeyCodes)i);
 				}
 			}
 			return ret;
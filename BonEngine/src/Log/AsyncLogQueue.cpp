@@ -0,0 +1,422 @@
+#include <Log/AsyncLogQueue.h>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+
+namespace bon
+{
+	namespace log
+	{
+		// argument types, after default promotions
+		enum class LogArgType
+		{
+			None,
+			Signed,
+			Unsigned,
+			Double,
+			LongDouble,
+			String,
+			Pointer,
+			Literal,
+		};
+
+		// a parsed conversion specification from a format string
+		struct LogFormatSpec
+		{
+			// whole conversion spec, from '%' to conversion char
+			const char* Start;
+			size_t Length;
+
+			// flags and width part, and precision part (including '.')
+			const char* Width;
+			size_t WidthLength;
+			const char* Precision;
+			size_t PrecisionLength;
+
+			// conversion char and argument type
+			char Conversion;
+			LogArgType Type;
+
+			// size of integer argument, in bytes
+			size_t IntSize;
+		};
+
+		// parse the conversion spec starting at '%'.
+		// returns pointer to right after the spec.
+		static const char* ParseFormatSpec(const char* curr, LogFormatSpec& spec)
+		{
+			spec.Start = curr++;
+			spec.IntSize = sizeof(int);
+
+			// flags and width
+			spec.Width = curr;
+			while (*curr && strchr("-+ #0'", *curr)) { curr++; }
+			while (*curr && strchr("0123456789*", *curr)) { curr++; }
+			spec.WidthLength = curr - spec.Width;
+
+			// precision
+			spec.Precision = curr;
+			if (*curr == '.')
+			{
+				curr++;
+				while (*curr && strchr("0123456789*", *curr)) { curr++; }
+			}
+			spec.PrecisionLength = curr - spec.Precision;
+
+			// length modifiers
+			bool longDouble = false;
+			int longsCount = 0;
+			for (bool done = false; *curr && !done; )
+			{
+				switch (*curr)
+				{
+				case 'h': curr++; break;
+				case 'l': longsCount++; spec.IntSize = (longsCount > 1) ? sizeof(long long) : sizeof(long); curr++; break;
+				case 'z': spec.IntSize = sizeof(size_t); curr++; break;
+				case 'j': spec.IntSize = sizeof(intmax_t); curr++; break;
+				case 't': spec.IntSize = sizeof(ptrdiff_t); curr++; break;
+				case 'L': longDouble = true; curr++; break;
+				case 'I':
+					if (curr[1] == '6' && curr[2] == '4') { spec.IntSize = sizeof(long long); curr += 3; }
+					else if (curr[1] == '3' && curr[2] == '2') { spec.IntSize = sizeof(int); curr += 3; }
+					else { spec.IntSize = sizeof(size_t); curr++; }
+					break;
+				default: done = true; break;
+				}
+			}
+
+			// conversion
+			spec.Conversion = *curr;
+			switch (spec.Conversion)
+			{
+			case 'd': case 'i': case 'c':
+				spec.Type = LogArgType::Signed; break;
+			case 'u': case 'o': case 'x': case 'X':
+				spec.Type = LogArgType::Unsigned; break;
+			case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+				spec.Type = longDouble ? LogArgType::LongDouble : LogArgType::Double; break;
+			case 's':
+				spec.Type = LogArgType::String; break;
+			case 'p': case 'n':
+				spec.Type = LogArgType::Pointer; break;
+			case '%':
+				spec.Type = LogArgType::Literal; break;
+			default:
+				spec.Type = LogArgType::None; break;
+			}
+			if (*curr) { curr++; }
+			spec.Length = curr - spec.Start;
+			return curr;
+		}
+
+		// count '*' in a part of conversion spec
+		static int CountStars(const char* part, size_t length)
+		{
+			int ret = 0;
+			for (size_t i = 0; i < length; ++i) { if (part[i] == '*') { ret++; } }
+			return ret;
+		}
+
+		// write a value into packed arguments
+		template <typename T>
+		static bool PackValue(LogRecord& record, T value)
+		{
+			if (record.ArgsSize + sizeof(T) > LogRecordArgsSize) { return false; }
+			memcpy(record.Args + record.ArgsSize, &value, sizeof(T));
+			record.ArgsSize += sizeof(T);
+			return true;
+		}
+
+		// read a value from packed arguments
+		template <typename T>
+		static bool UnpackValue(const LogRecord& record, size_t& offset, T& out)
+		{
+			if (offset + sizeof(T) > record.ArgsSize) { return false; }
+			memcpy(&out, record.Args + offset, sizeof(T));
+			offset += sizeof(T);
+			return true;
+		}
+
+		// pack log arguments
+		void PackLogArguments(LogRecord& record, va_list args)
+		{
+			record.ArgsSize = 0;
+			record.Truncated = false;
+			bool fits = true;
+
+			for (const char* curr = record.Format; *curr; )
+			{
+				// skip plain text
+				if (*curr != '%') { curr++; continue; }
+
+				// parse spec and pack its arguments.
+				// note: we must keep consuming arguments even when out of space, since va_list is positional
+				LogFormatSpec spec;
+				curr = ParseFormatSpec(curr, spec);
+				int starsCount = CountStars(spec.Width, spec.WidthLength) + CountStars(spec.Precision, spec.PrecisionLength);
+				for (int i = 0; i < starsCount; ++i)
+				{
+					fits = fits && PackValue<long long>(record, va_arg(args, int));
+				}
+				switch (spec.Type)
+				{
+				case LogArgType::Signed:
+				{
+					long long value = (spec.IntSize == sizeof(long long)) ? va_arg(args, long long) :
+						(spec.IntSize == sizeof(long)) ? va_arg(args, long) : va_arg(args, int);
+					fits = fits && PackValue(record, value);
+					break;
+				}
+				case LogArgType::Unsigned:
+				{
+					unsigned long long value = (spec.IntSize == sizeof(unsigned long long)) ? va_arg(args, unsigned long long) :
+						(spec.IntSize == sizeof(unsigned long)) ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+					fits = fits && PackValue(record, value);
+					break;
+				}
+				case LogArgType::Double:
+					fits = fits && PackValue(record, va_arg(args, double));
+					break;
+				case LogArgType::LongDouble:
+					fits = fits && PackValue(record, (double)va_arg(args, long double));
+					break;
+				case LogArgType::Pointer:
+					fits = fits && PackValue(record, va_arg(args, void*));
+					break;
+				case LogArgType::String:
+				{
+					// copy string with its length, truncate if needed
+					const char* str = va_arg(args, const char*);
+					if (!str) { str = "(null)"; }
+					if (!fits || record.ArgsSize + sizeof(uint16_t) >= LogRecordArgsSize) { fits = false; break; }
+					size_t available = LogRecordArgsSize - record.ArgsSize - sizeof(uint16_t);
+					size_t length = strlen(str);
+					if (length > available) { length = available; record.Truncated = true; }
+					PackValue(record, (uint16_t)length);
+					memcpy(record.Args + record.ArgsSize, str, length);
+					record.ArgsSize += (uint16_t)length;
+					break;
+				}
+				default:
+					break;
+				}
+			}
+			if (!fits) { record.Truncated = true; }
+		}
+
+		// append text to output buffer
+		static void Append(char* out, size_t outSize, size_t& length, const char* text, size_t textLength)
+		{
+			if (length + 1 >= outSize) { return; }
+			size_t toCopy = (textLength < outSize - length - 1) ? textLength : (outSize - length - 1);
+			memcpy(out + length, text, toCopy);
+			length += toCopy;
+			out[length] = '\0';
+		}
+
+		// append snprintf result to output buffer
+		template <typename T>
+		static void AppendFormatted(char* out, size_t outSize, size_t& length, const char* spec, T value)
+		{
+			if (length + 1 >= outSize) { return; }
+			int written = snprintf(out + length, outSize - length, spec, value);
+			if (written > 0) { length += ((size_t)written < outSize - length) ? (size_t)written : (outSize - length - 1); }
+		}
+
+		// append part of conversion spec to spec text, replacing '*' with their packed values
+		static bool AppendSpecPart(const LogRecord& record, size_t& offset, const char* part, size_t partLength, char* out, size_t& outLength, size_t outSize)
+		{
+			for (size_t i = 0; i < partLength && outLength + 12 < outSize; ++i)
+			{
+				if (part[i] == '*')
+				{
+					long long value;
+					if (!UnpackValue(record, offset, value)) { return false; }
+					outLength += snprintf(out + outLength, outSize - outLength, "%d", (int)value);
+				}
+				else
+				{
+					out[outLength++] = part[i];
+				}
+			}
+			return true;
+		}
+
+		// format log record
+		size_t FormatLogRecord(const LogRecord& record, char* out, size_t outSize)
+		{
+			size_t length = 0;
+			size_t offset = 0;
+			if (outSize == 0) { return 0; }
+			out[0] = '\0';
+
+			for (const char* curr = record.Format; *curr; )
+			{
+				// copy plain text
+				const char* textEnd = strchr(curr, '%');
+				if (textEnd != curr)
+				{
+					size_t textLength = textEnd ? (size_t)(textEnd - curr) : strlen(curr);
+					Append(out, outSize, length, curr, textLength);
+					curr += textLength;
+					continue;
+				}
+
+				// parse spec
+				LogFormatSpec spec;
+				curr = ParseFormatSpec(curr, spec);
+				if (spec.Type == LogArgType::Literal) { Append(out, outSize, length, "%", 1); continue; }
+				if (spec.Type == LogArgType::None) { Append(out, outSize, length, spec.Start, spec.Length); continue; }
+
+				// build spec with '*' replaced by their values and normalized length modifier.
+				// strings are not null terminated in packed arguments, so their length is used as max precision.
+				char specText[64];
+				size_t specLength = 0;
+				bool valid = true;
+				specText[specLength++] = '%';
+				valid = valid && AppendSpecPart(record, offset, spec.Width, spec.WidthLength, specText, specLength, sizeof(specText));
+				if (spec.Type == LogArgType::String)
+				{
+					int precision = -1;
+					if (spec.PrecisionLength > 0)
+					{
+						char precisionText[24];
+						size_t precisionLength = 0;
+						valid = valid && AppendSpecPart(record, offset, spec.Precision + 1, spec.PrecisionLength - 1, precisionText, precisionLength, sizeof(precisionText));
+						precisionText[precisionLength] = '\0';
+						precision = atoi(precisionText);
+					}
+					uint16_t strLength = 0;
+					valid = valid && UnpackValue(record, offset, strLength) && (offset + strLength <= record.ArgsSize);
+					if (!valid) { break; }
+					if (precision < 0 || precision > (int)strLength) { precision = (int)strLength; }
+					specLength += snprintf(specText + specLength, sizeof(specText) - specLength, ".%ds", precision);
+					AppendFormatted(out, outSize, length, specText, (const char*)record.Args + offset);
+					offset += strLength;
+					continue;
+				}
+				valid = valid && AppendSpecPart(record, offset, spec.Precision, spec.PrecisionLength, specText, specLength, sizeof(specText));
+				if ((spec.Type == LogArgType::Signed || spec.Type == LogArgType::Unsigned) && spec.Conversion != 'c')
+				{
+					specText[specLength++] = 'l';
+					specText[specLength++] = 'l';
+				}
+				specText[specLength++] = spec.Conversion;
+				specText[specLength] = '\0';
+
+				// format argument
+				switch (spec.Type)
+				{
+				case LogArgType::Signed:
+				{
+					long long value;
+					if (!(valid = valid && UnpackValue(record, offset, value))) { break; }
+					if (spec.Conversion == 'c') { AppendFormatted(out, outSize, length, specText, (int)value); }
+					else { AppendFormatted(out, outSize, length, specText, value); }
+					break;
+				}
+				case LogArgType::Unsigned:
+				{
+					unsigned long long value;
+					if (!(valid = valid && UnpackValue(record, offset, value))) { break; }
+					AppendFormatted(out, outSize, length, specText, value);
+					break;
+				}
+				case LogArgType::Double:
+				case LogArgType::LongDouble:
+				{
+					double value;
+					if (!(valid = valid && UnpackValue(record, offset, value))) { break; }
+					AppendFormatted(out, outSize, length, specText, value);
+					break;
+				}
+				case LogArgType::Pointer:
+				{
+					void* value;
+					if (!(valid = valid && UnpackValue(record, offset, value))) { break; }
+					if (spec.Conversion == 'p') { AppendFormatted(out, outSize, length, specText, value); }
+					break;
+				}
+				default:
+					break;
+				}
+
+				// ran out of packed arguments? stop here
+				if (!valid) { break; }
+			}
+
+			// add truncation mark
+			if (record.Truncated) { Append(out, outSize, length, "...", 3); }
+			return length;
+		}
+
+		// create queue
+		AsyncLogQueue::AsyncLogQueue(size_t capacity)
+		{
+			size_t size = 2;
+			while (size < capacity) { size <<= 1; }
+			_cells = std::vector<Cell>(size);
+			for (size_t i = 0; i < size; ++i)
+			{
+				_cells[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+			_mask = size - 1;
+		}
+
+		// claim a slot
+		LogRecord* AsyncLogQueue::TryClaim(uint64_t& outTicket)
+		{
+			uint64_t pos = _enqueuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Cell& cell = _cells[pos & _mask];
+				uint64_t sequence = cell.Sequence.load(std::memory_order_acquire);
+				int64_t diff = (int64_t)sequence - (int64_t)pos;
+
+				// slot is free - try to claim it
+				if (diff == 0)
+				{
+					if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						outTicket = pos;
+						return &cell.Record;
+					}
+				}
+				// slot still used by a record that wasn't consumed - queue is full
+				else if (diff < 0)
+				{
+					return nullptr;
+				}
+				// another producer claimed this slot - try again
+				else
+				{
+					pos = _enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// publish claimed record
+		void AsyncLogQueue::Publish(uint64_t ticket)
+		{
+			_cells[ticket & _mask].Sequence.store(ticket + 1, std::memory_order_release);
+		}
+
+		// get oldest published record
+		LogRecord* AsyncLogQueue::Peek()
+		{
+			uint64_t pos = _dequeuePos.load(std::memory_order_relaxed);
+			Cell& cell = _cells[pos & _mask];
+			if (cell.Sequence.load(std::memory_order_acquire) != pos + 1) { return nullptr; }
+			return &cell.Record;
+		}
+
+		// release consumed record
+		void AsyncLogQueue::Release()
+		{
+			uint64_t pos = _dequeuePos.load(std::memory_order_relaxed);
+			_cells[pos & _mask].Sequence.store(pos + _mask + 1, std::memory_order_release);
+			_dequeuePos.store(pos + 1, std::memory_order_release);
+		}
+	}
+}
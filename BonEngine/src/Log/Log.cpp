@@ -3,28 +3,90 @@
 #include <cstdarg>
 #include <iostream>
 #include <ctime>
-#include <windows.h>
-#include <Sysinfoapi.h>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <vector>
 
 namespace bon
 {
 	namespace log
 	{
+		// convert log level to severity string
+		static const char* SeverityNames[] = {
+			"Debug",
+			"Info",
+			"Warn",
+			"Error",
+			"Critical"
+		};
+
+		// log to flush when crashing, signals we flush on and their previous handlers
+		static Log* _crashFlushLog = nullptr;
+		static const int CrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+		static void (*_prevCrashHandlers[sizeof(CrashSignals) / sizeof(CrashSignals[0])])(int);
+
+		// crash signal handler: write pending async logs, then let previous handler handle the signal
+		static void OnCrashSignal(int signal)
+		{
+			if (_crashFlushLog) { 
+				_crashFlushLog->_FlushOnCrash(); 
+			}
+			for (size_t i = 0; i < sizeof(CrashSignals) / sizeof(CrashSignals[0]); ++i) 
+			{
+				if (CrashSignals[i] == signal) {
+					std::signal(signal, (_prevCrashHandlers[i] == SIG_ERR || _prevCrashHandlers[i] == SIG_IGN) ? SIG_DFL : _prevCrashHandlers[i]);
+				}
+			}
+			std::raise(signal);
+		}
+
+		// min level to write per category, used by log macros
+		std::atomic<int> LogFilter::_minLevels[(int)LogCategory::_Count];
+
+		// set category min level
+		void LogFilter::_SetMinLevel(LogCategory category, LogLevel minLevel)
+		{
+			// none is stored as a level above all others, so filtering is a single comparison
+			int value = (minLevel == LogLevel::None) ? (int)LogLevel::Critical + 1 : (int)minLevel;
+			_minLevels[(int)category].store(value, std::memory_order_relaxed);
+		}
+
+		// check and update call site rate limit
+		bool LogFilter::_RateLimit(std::atomic<uint64_t>& lastWriteTime, uint64_t intervalMs)
+		{
+			uint64_t now = MonotonicMilliseconds();
+			uint64_t last = lastWriteTime.load(std::memory_order_relaxed);
+			if (last != 0 && now - last < intervalMs) {
+				return false;
+			}
+			return lastWriteTime.compare_exchange_strong(last, now ? now : 1, std::memory_order_relaxed);
+		}
+
+		// format timestamp text
+		static void FormatTimeStamp(time_t rawtime, char* out, size_t outSize)
+		{
+			struct tm timeinfo;
+			LocalTime(rawtime, timeinfo);
+			strftime(out, outSize, "%d-%m-%Y %H:%M:%S", &timeinfo);
+		}
+
 		// init log manager
 		void Log::_Initialize()
 		{
 			// already init? skip
-			if (_logFile) {
+			if (_logFile.IsOpen()) {
 				return;
 			}
 
 			// open log file
-			fopen_s(&_logFile, "_log.txt", "w");
+			_logFile.Open("_log.txt");
 		}
 
 		// dispose log resources
 		void Log::_Dispose()
 		{
+			SetAsync(false);
 			Write(LogLevel::Info, "Destroying debug manager - there will be no more logs after this line.");
 			FlushLogFile();
 			CloseLogFile();
@@ -35,7 +97,7 @@ namespace bon
 		{
 			_timeForNextFlush -= deltaTime;
 			if (_timeForNextFlush < 0) {
-				_timeForNextFlush = 1.5;
+				_timeForNextFlush = _flushInterval;
 				FlushLogFile();
 			}
 		}
@@ -50,28 +112,65 @@ namespace bon
 		void Log::UpdateTimeStamp()
 		{
 			time_t rawtime;
-			struct tm timeinfo;
-
 			time(&rawtime);
-			localtime_s(&timeinfo, &rawtime);
-
-			strftime(curr_time_stamp, sizeof(curr_time_stamp), "%d-%m-%Y %H:%M:%S", &timeinfo);
+			FormatTimeStamp(rawtime, curr_time_stamp, sizeof(curr_time_stamp));
 		}
 
 		// flush log file, if exists
 		void Log::FlushLogFile()
 		{
-			if (_logFile) {
-				fflush(_logFile);
-			}
+			_logFile.Flush();
+			fflush(stdout);
 		}
 
 		// close log file
 		void Log::CloseLogFile()
 		{
-			if (_logFile) {
-				fclose(_logFile);
-				_logFile = nullptr;
+			_logFile.Close();
+		}
+
+		// set log file buffer size
+		void Log::SetFileBufferSize(int bufferSize)
+		{
+			_logFile.SetBufferSize((size_t)(bufferSize > 0 ? bufferSize : 0));
+		}
+
+		// set log file rotation
+		void Log::SetFileRotation(long long maxFileSize, int maxBackups)
+		{
+			_logFile.SetRotation((uint64_t)(maxFileSize > 0 ? maxFileSize : 0), maxBackups);
+		}
+
+		// write a formatted line to log file and console
+		void Log::WriteLine(const char* line, size_t length)
+		{
+			_logFile.Write(line, length);
+			fwrite(line, 1, length, stdout);
+		}
+
+		// set log level
+		void Log::SetLevel(LogLevel level)
+		{
+			_level = level;
+			UpdateLogFilter();
+		}
+
+		// set category log level
+		void Log::SetCategoryLevel(LogCategory category, LogLevel level)
+		{
+			_categoryLevels[(int)category] = level;
+			UpdateLogFilter();
+		}
+
+		// update cached min level per category: messages must pass both global and category levels
+		void Log::UpdateLogFilter()
+		{
+			for (int i = 0; i < (int)LogCategory::_Count; ++i)
+			{
+				LogLevel categoryLevel = _categoryLevels[i];
+				bool disabled = (_level == LogLevel::None || categoryLevel == LogLevel::None);
+				LogLevel minLevel = disabled ? LogLevel::None : (_level > categoryLevel ? _level : categoryLevel);
+				LogFilter::_SetMinLevel((LogCategory)i, minLevel);
 			}
 		}
 
@@ -87,51 +186,222 @@ namespace bon
 		// flush log file
 		void Log::Flush()
 		{
+			// if async, wait until writer thread writes everything
+			AsyncLogQueue* queue = _asyncQueue.load(std::memory_order_acquire);
+			if (queue) {
+				while (!queue->IsEmpty() && _asyncRunning.load(std::memory_order_acquire)) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
 			FlushLogFile();
 		}
 
+		// enable / disable async logging
+		void Log::SetAsync(bool async, LogOverflowPolicy overflowPolicy, int capacity)
+		{
+			_overflowPolicy = overflowPolicy;
+			if (async == IsAsync()) {
+				return;
+			}
+
+			// start async logging: create queue and writer thread, and flush pending messages if we crash
+			if (async)
+			{
+				AsyncLogQueue* queue = new AsyncLogQueue((size_t)(capacity > 0 ? capacity : 1));
+				_asyncRunning.store(true);
+				_asyncThread = std::thread(&Log::AsyncWriterLoop, this, queue);
+				_asyncQueue.store(queue, std::memory_order_release);
+				_crashFlushLog = this;
+				for (size_t i = 0; i < sizeof(CrashSignals) / sizeof(CrashSignals[0]); ++i) {
+					_prevCrashHandlers[i] = std::signal(CrashSignals[i], OnCrashSignal);
+				}
+			}
+			// stop async logging: stop writer thread and write whatever is left
+			else
+			{
+				for (size_t i = 0; i < sizeof(CrashSignals) / sizeof(CrashSignals[0]); ++i) {
+					std::signal(CrashSignals[i], (_prevCrashHandlers[i] == SIG_ERR) ? SIG_DFL : _prevCrashHandlers[i]);
+				}
+				_crashFlushLog = nullptr;
+				AsyncLogQueue* queue = _asyncQueue.exchange(nullptr);
+				_asyncRunning.store(false);
+				_asyncThread.join();
+				DrainAsyncQueue(*queue);
+				_retiredAsyncQueues.emplace_back(queue);
+				FlushLogFile();
+			}
+		}
+
+		// format and write all records in async queue
+		size_t Log::DrainAsyncQueue(AsyncLogQueue& queue)
+		{
+			static char timeStamp[80];
+			static time_t timeStampTime = 0;
+			char line[1024];
+			size_t count = 0;
+
+			// report dropped messages
+			long long dropped = _droppedCount.load(std::memory_order_relaxed);
+			if (dropped != _reportedDroppedCount) 
+			{
+				int length = snprintf(line, sizeof(line), "%s %s>  %lld log messages were dropped because async log queue was full.\n", timeStamp, SeverityNames[(int)LogLevel::Warn], dropped - _reportedDroppedCount);
+				_reportedDroppedCount = dropped;
+				WriteLine(line, (size_t)length);
+			}
+
+			// write records
+			while (LogRecord* record = queue.Peek())
+			{
+				// update timestamp if needed
+				time_t recordTime = (time_t)(record->Timestamp / 1000000000);
+				if (recordTime != timeStampTime) {
+					timeStampTime = recordTime;
+					FormatTimeStamp(recordTime, timeStamp, sizeof(timeStamp));
+				}
+
+				// format line
+				int prefixLength = snprintf(line, sizeof(line), "%s %s>  ", timeStamp, SeverityNames[(int)record->Level]);
+				size_t length = (size_t)prefixLength + FormatLogRecord(*record, line + prefixLength, sizeof(line) - prefixLength - 1);
+				line[length++] = '\n';
+
+				// write it and release record
+				WriteLine(line, length);
+				queue.Release();
+				count++;
+			}
+
+			// in debug mode, flush immediately
+			#ifdef _DEBUG
+				if (count) { FlushLogFile(); }
+			#endif
+			return count;
+		}
+
+		// async writer thread loop
+		void Log::AsyncWriterLoop(AsyncLogQueue* queue)
+		{
+			while (_asyncRunning.load(std::memory_order_acquire))
+			{
+				size_t written = 0;
+				if (!_asyncDraining.test_and_set(std::memory_order_acquire)) {
+					written = DrainAsyncQueue(*queue);
+					_asyncDraining.clear(std::memory_order_release);
+				}
+				if (written == 0) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+		}
+
+		// write pending async messages when crashing.
+		// this runs inside a signal handler, so it can't format, take locks or use stdio - only copy strings and write them raw.
+		void Log::_FlushOnCrash()
+		{
+			// take draining lock from writer thread. if it's taken we may have crashed while writing, so bail out
+			AsyncLogQueue* queue = _asyncQueue.load(std::memory_order_acquire);
+			if (!queue || _asyncDraining.test_and_set(std::memory_order_acquire)) {
+				return;
+			}
+
+			// write header. if log file is locked, give up
+			static const char header[] = "Critical>  Crash signal received! Pending log messages below are written without their arguments.\n";
+			if (!_logFile.TryWriteOnCrash(header, sizeof(header) - 1)) {
+				return;
+			}
+			WriteRaw(StdOutFileDescriptor, header, sizeof(header) - 1);
+
+			// write pending records' severity and format string
+			char line[1024];
+			while (LogRecord* record = queue->Peek())
+			{
+				size_t length = 0;
+				for (const char* part : { SeverityNames[(int)record->Level], ">  ", record->Format }) 
+				{
+					size_t partLength = strnlen(part, sizeof(line) - 1 - length);
+					memcpy(line + length, part, partLength);
+					length += partLength;
+				}
+				line[length++] = '\n';
+				if (!_logFile.TryWriteOnCrash(line, length)) {
+					return;
+				}
+				WriteRaw(StdOutFileDescriptor, line, length);
+				queue->Release();
+			}
+		}
+
 		// write log
 		void Log::Write(LogLevel level, const char* fmt, ...)
 		{
-			// convert log level to severity string
-			static const char* severity_names[] = {
-				"Debug",
-				"Info",
-				"Warn",
-				"Error",
-				"Critical"
-			};
-
 			// validate log level
 			if (!IsValid(level)) {
 				return;
 			}
 
+			// async logging? pack message into queue and let writer thread format and write it
+			AsyncLogQueue* queue = _asyncQueue.load(std::memory_order_acquire);
+			if (queue)
+			{
+				// claim a record, drop message or wait if queue is full
+				uint64_t ticket;
+				LogRecord* record = queue->TryClaim(ticket);
+				while (!record) 
+				{
+					if (_overflowPolicy == LogOverflowPolicy::Drop) {
+						_droppedCount.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+					std::this_thread::yield();
+					record = queue->TryClaim(ticket);
+				}
+
+				// fill record and publish it
+				record->Timestamp = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+				record->Format = fmt;
+				record->Level = level;
+				va_list arg;
+				va_start(arg, fmt);
+				PackLogArguments(*record, arg);
+				va_end(arg);
+				queue->Publish(ticket);
+				return;
+			}
+
 			// get current tick and check if need to update timestamp
-			auto currTick = GetTickCount64();
+			auto currTick = MonotonicMilliseconds();
 			if (currTick != _lastTick) {
 				_lastTick = currTick;
 				UpdateTimeStamp();
 			}
 
-			// start iterating arguments
+			// format line once, for both log file and console
+			char line[1024];
+			int prefixLength = snprintf(line, sizeof(line), "%s %s>  ", curr_time_stamp, SeverityNames[(int)level]);
 			va_list arg;
 			va_start(arg, fmt);
-
-			// write to log
-			if (_logFile) {
-				fprintf_s(_logFile, "%s %s>  ", curr_time_stamp, severity_names[(int)level]);
-				vfprintf(_logFile, fmt, arg);
-				fprintf_s(_logFile, "\n");
+			int messageLength = vsnprintf(line + prefixLength, sizeof(line) - prefixLength, fmt, arg);
+			va_end(arg);
+			if (messageLength < 0) {
+				messageLength = 0;
 			}
 
-			// write to console
-			printf_s("%s %s>  ", curr_time_stamp, severity_names[(int)level]);
-			vprintf(fmt, arg);
-			printf_s("\n");
-
-			// end iterating args
-			va_end(arg);
+			// message too long for line buffer? format it again into a big enough buffer
+			size_t length = (size_t)prefixLength + (size_t)messageLength;
+			if (length + 1 < sizeof(line))
+			{
+				line[length++] = '\n';
+				WriteLine(line, length);
+			}
+			else
+			{
+				std::vector<char> longLine(length + 2);
+				memcpy(longLine.data(), line, prefixLength);
+				va_start(arg, fmt);
+				vsnprintf(longLine.data() + prefixLength, longLine.size() - prefixLength, fmt, arg);
+				va_end(arg);
+				longLine[length++] = '\n';
+				WriteLine(longLine.data(), length);
+			}
 
 			// in debug mode, flush immediately
 			#ifdef _DEBUG
@@ -0,0 +1,224 @@
+#include <Log/LogPlatform.h>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+
+namespace bon
+{
+	namespace log
+	{
+		// get monotonic time in milliseconds
+		uint64_t MonotonicMilliseconds()
+		{
+#if defined(_WIN32)
+			return (uint64_t)GetTickCount64();
+#else
+			struct timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+#endif
+		}
+
+		// convert raw time to local time
+		void LocalTime(time_t rawtime, struct tm& out)
+		{
+#if defined(_WIN32)
+			localtime_s(&out, &rawtime);
+#else
+			localtime_r(&rawtime, &out);
+#endif
+		}
+
+		// write data to file descriptor, handling partial writes
+		void WriteRaw(int fd, const char* data, size_t size)
+		{
+			while (size > 0 && fd >= 0)
+			{
+#if defined(_WIN32)
+				int written = _write(fd, data, (unsigned int)size);
+#else
+				ssize_t written = write(fd, data, size);
+#endif
+				if (written < 0) {
+					if (errno == EINTR) { continue; }
+					return;
+				}
+				data += written;
+				size -= (size_t)written;
+			}
+		}
+
+		// create log file
+		LogFile::LogFile(size_t bufferSize) : _buffer(bufferSize)
+		{
+		}
+
+		// close log file
+		LogFile::~LogFile()
+		{
+			Close();
+		}
+
+		// open log file
+		bool LogFile::Open(const char* path)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			FlushBuffer();
+			CloseFile();
+			_path = path;
+			return OpenFile();
+		}
+
+		// close log file
+		void LogFile::Close()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			FlushBuffer();
+			CloseFile();
+		}
+
+		// write data to buffer or file
+		void LogFile::Write(const char* data, size_t size)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_fd < 0) {
+				return;
+			}
+
+			// rotate if this write will exceed max file size
+			if (_maxFileSize > 0 && _fileSize > 0 && _fileSize + size > _maxFileSize) {
+				Rotate();
+			}
+			_fileSize += size;
+
+			// make room in buffer, or write directly if it can't fit
+			if (_used + size > _buffer.size()) {
+				FlushBuffer();
+				if (size > _buffer.size()) {
+					WriteToFile(data, size);
+					return;
+				}
+			}
+			memcpy(_buffer.data() + _used, data, size);
+			_used += size;
+		}
+
+		// flush buffer
+		void LogFile::Flush()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			FlushBuffer();
+		}
+
+		// write buffer and data without blocking, when crashing
+		bool LogFile::TryWriteOnCrash(const char* data, size_t size)
+		{
+			if (!_mutex.try_lock()) {
+				return false;
+			}
+			FlushBuffer();
+			WriteToFile(data, size);
+			_fileSize += size;
+			_mutex.unlock();
+			return true;
+		}
+
+		// set buffer size
+		void LogFile::SetBufferSize(size_t bufferSize)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			FlushBuffer();
+			_buffer.resize(bufferSize);
+			_buffer.shrink_to_fit();
+		}
+
+		// set rotation settings
+		void LogFile::SetRotation(uint64_t maxFileSize, int maxBackups)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_maxFileSize = maxFileSize;
+			_maxBackups = maxBackups > 0 ? maxBackups : 0;
+		}
+
+		// write buffer to file
+		void LogFile::FlushBuffer()
+		{
+			if (_used > 0) {
+				WriteToFile(_buffer.data(), _used);
+				_used = 0;
+			}
+		}
+
+		// write data directly to file
+		void LogFile::WriteToFile(const char* data, size_t size)
+		{
+			WriteRaw(_fd, data, size);
+		}
+
+		// open file at current path
+		bool LogFile::OpenFile()
+		{
+#if defined(_WIN32)
+			_fd = _open(_path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_TEXT, _S_IREAD | _S_IWRITE);
+#else
+			_fd = open(_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+			_fileSize = 0;
+			return _fd >= 0;
+		}
+
+		// close file descriptor
+		void LogFile::CloseFile()
+		{
+			if (_fd >= 0) {
+#if defined(_WIN32)
+				_close(_fd);
+#else
+				close(_fd);
+#endif
+				_fd = -1;
+			}
+		}
+
+		// get backup file path: 'name.ext' -> 'name.index.ext'
+		static std::string BackupPath(const std::string& path, int index)
+		{
+			size_t dot = path.find_last_of('.');
+			size_t slash = path.find_last_of("/\\");
+			if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+				dot = path.length();
+			}
+			return path.substr(0, dot) + "." + std::to_string(index) + path.substr(dot);
+		}
+
+		// rotate log files
+		void LogFile::Rotate()
+		{
+			FlushBuffer();
+			CloseFile();
+
+			// shift backups, dropping the oldest
+			if (_maxBackups > 0)
+			{
+				std::remove(BackupPath(_path, _maxBackups).c_str());
+				for (int i = _maxBackups - 1; i >= 1; --i) {
+					std::rename(BackupPath(_path, i).c_str(), BackupPath(_path, i + 1).c_str());
+				}
+				std::rename(_path.c_str(), BackupPath(_path, 1).c_str());
+			}
+
+			OpenFile();
+		}
+	}
+}
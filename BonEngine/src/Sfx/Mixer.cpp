@@ -0,0 +1,413 @@
+#include <Sfx/Mixer.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// bus peak above this level triggers ducking (about -60 dB)
+		const float DuckingThreshold = 0.001f;
+
+		// smoothing factor for average callback time
+		const double AverageCallbackSmoothing = 0.05;
+
+		// create mixer
+		Mixer::Mixer(int frequency, int channels) : _frequency(std::max(frequency, 1)), _channels(channels == 1 ? 1 : 2)
+		{
+			for (int i = 0; i < (int)MixerBus::_Count; ++i)
+			{
+				_busBuffers[i].resize((size_t)MaxFramesPerSlice * _channels);
+				_busVolumes[i] = 1.0f;
+			}
+		}
+
+		// close device
+		Mixer::~Mixer()
+		{
+			CloseDevice();
+		}
+
+		// push command
+		bool Mixer::_PushCommand(const Command& command)
+		{
+			if (!_commands.Push(command))
+			{
+				_droppedCommands.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			return true;
+		}
+
+		// play voice
+		MixerVoiceId Mixer::Play(const MixerSource& source, MixerBus bus, float volume, float pan, int loops)
+		{
+			if (source.Data == nullptr || source.Frames <= 0 || (source.Channels != 1 && source.Channels != 2)) {
+				return InvalidMixerVoice;
+			}
+
+			Command command;
+			command.Type = Command::Types::Play;
+			command.Id = _nextVoiceId;
+			command.Source = source;
+			command.Bus = (int)bus;
+			command.Loops = loops;
+			command.Values[0] = std::max(volume, 0.0f);
+			command.Values[1] = std::max(-1.0f, std::min(1.0f, pan));
+			if (!_PushCommand(command)) {
+				return InvalidMixerVoice;
+			}
+			_nextVoiceId = (_nextVoiceId == INT32_MAX) ? 0 : _nextVoiceId + 1;
+			return command.Id;
+		}
+
+		// stop voice
+		void Mixer::Stop(MixerVoiceId voice)
+		{
+			Command command;
+			command.Type = Command::Types::Stop;
+			command.Id = voice;
+			_PushCommand(command);
+		}
+
+		// stop all voices
+		void Mixer::StopAll()
+		{
+			Command command;
+			command.Type = Command::Types::StopAll;
+			_PushCommand(command);
+		}
+
+		// set voice volume
+		void Mixer::SetVoiceVolume(MixerVoiceId voice, float volume)
+		{
+			Command command;
+			command.Type = Command::Types::SetVoiceVolume;
+			command.Id = voice;
+			command.Values[0] = std::max(volume, 0.0f);
+			_PushCommand(command);
+		}
+
+		// set bus volume
+		void Mixer::SetBusVolume(MixerBus bus, float volume)
+		{
+			_busVolumes[(int)bus] = std::max(volume, 0.0f);
+			Command command;
+			command.Type = Command::Types::SetBusVolume;
+			command.Bus = (int)bus;
+			command.Values[0] = _busVolumes[(int)bus];
+			_PushCommand(command);
+		}
+
+		// set bus low-pass filter
+		void Mixer::SetBusLowPass(MixerBus bus, float cutoff)
+		{
+			Command command;
+			command.Type = Command::Types::SetBusLowPass;
+			command.Bus = (int)bus;
+			command.Values[0] = cutoff;
+			_PushCommand(command);
+		}
+
+		// set bus ducking
+		void Mixer::SetBusDucking(MixerBus bus, MixerBus trigger, float amount, float attack, float release)
+		{
+			Command command;
+			command.Type = Command::Types::SetBusDucking;
+			command.Bus = (int)bus;
+			command.Trigger = (int)trigger;
+			command.Values[0] = std::max(0.0f, std::min(1.0f, amount));
+			command.Values[1] = std::max(attack, 0.0f);
+			command.Values[2] = std::max(release, 0.0f);
+			_PushCommand(command);
+		}
+
+		// get finished voices
+		int Mixer::PollFinished(MixerVoiceId* out, int maxCount)
+		{
+			int count = 0;
+			while (count < maxCount && _finished.Pop(out[count])) {
+				count++;
+			}
+			return count;
+		}
+
+		// get stats
+		MixerStats Mixer::GetStats() const
+		{
+			MixerStats ret;
+			ret.Callbacks = _callbacks.load(std::memory_order_relaxed);
+			ret.LastCallbackMs = _lastCallbackMs.load(std::memory_order_relaxed);
+			ret.AverageCallbackMs = _averageCallbackMs.load(std::memory_order_relaxed);
+			ret.MaxCallbackMs = _maxCallbackMs.load(std::memory_order_relaxed);
+			ret.Load = _averageLoad.load(std::memory_order_relaxed);
+			ret.ActiveVoices = _activeVoices.load(std::memory_order_relaxed);
+			ret.DroppedCommands = _droppedCommands.load(std::memory_order_relaxed);
+			return ret;
+		}
+
+		// apply pending commands (audio thread)
+		void Mixer::_ApplyCommands()
+		{
+			Command command;
+			while (_commands.Pop(command))
+			{
+				switch (command.Type)
+				{
+				case Command::Types::Play:
+				{
+					// find a free voice. if none is free, voice is dropped and reported as finished
+					Voice* voice = std::find_if(_voices, _voices + MaxVoices, [](const Voice& v) { return v.Id == InvalidMixerVoice; });
+					if (voice == _voices + MaxVoices) {
+						_finished.Push(command.Id);
+						break;
+					}
+					voice->Id = command.Id;
+					voice->Source = command.Source;
+					voice->Bus = command.Bus;
+					voice->Loops = command.Loops;
+					voice->Position = 0;
+					voice->Volume = voice->CurrentVolume = command.Values[0];
+
+					// mono sources use constant power panning, stereo sources use balance
+					float pan = command.Values[1];
+					if (command.Source.Channels == 1)
+					{
+						float angle = (pan + 1.0f) * 0.25f * 3.14159265f;
+						voice->GainLeft = std::cos(angle) * 1.41421356f;
+						voice->GainRight = std::sin(angle) * 1.41421356f;
+					}
+					else
+					{
+						voice->GainLeft = std::min(1.0f, 1.0f - pan);
+						voice->GainRight = std::min(1.0f, 1.0f + pan);
+					}
+					_activeVoices.fetch_add(1, std::memory_order_relaxed);
+					break;
+				}
+
+				case Command::Types::Stop:
+				case Command::Types::StopAll:
+					for (Voice& voice : _voices)
+					{
+						if (voice.Id != InvalidMixerVoice && (command.Type == Command::Types::StopAll || voice.Id == command.Id))
+						{
+							_finished.Push(voice.Id);
+							voice.Id = InvalidMixerVoice;
+							_activeVoices.fetch_sub(1, std::memory_order_relaxed);
+						}
+					}
+					break;
+
+				case Command::Types::SetVoiceVolume:
+					for (Voice& voice : _voices)
+					{
+						if (voice.Id == command.Id) { voice.Volume = command.Values[0]; }
+					}
+					break;
+
+				case Command::Types::SetBusVolume:
+					_buses[command.Bus].Volume = command.Values[0];
+					break;
+
+				case Command::Types::SetBusLowPass:
+				{
+					// one-pole low-pass. cutoff at or above nyquist disables filter
+					float cutoff = command.Values[0];
+					Bus& bus = _buses[command.Bus];
+					bus.LowPassCoef = (cutoff > 0.0f && cutoff < _frequency * 0.5f) ? 1.0f - std::exp(-2.0f * 3.14159265f * cutoff / _frequency) : 0.0f;
+					break;
+				}
+
+				case Command::Types::SetBusDucking:
+				{
+					Bus& bus = _buses[command.Bus];
+					bus.DuckTrigger = command.Values[0] > 0.0f ? command.Trigger : -1;
+					bus.DuckAmount = command.Values[0];
+					bus.DuckAttack = command.Values[1];
+					bus.DuckRelease = command.Values[2];
+					if (bus.DuckTrigger == -1) { bus.DuckGain = 1.0f; }
+					break;
+				}
+				}
+			}
+		}
+
+		// mix a single voice into bus buffer (audio thread)
+		bool Mixer::_MixVoice(Voice& voice, float* buffer, int frames)
+		{
+			const MixerSource& source = voice.Source;
+			float volumeStep = (voice.Volume - voice.CurrentVolume) / frames;
+			float volume = voice.CurrentVolume;
+
+			int written = 0;
+			while (written < frames)
+			{
+				// mix until source end or slice end
+				int count = std::min(frames - written, source.Frames - voice.Position);
+				float* out = buffer + written * _channels;
+				for (int i = 0; i < count; ++i)
+				{
+					// read frame as float
+					int index = (voice.Position + i) * source.Channels;
+					float left, right;
+					if (source.Float)
+					{
+						const float* data = (const float*)source.Data;
+						left = data[index];
+						right = source.Channels == 2 ? data[index + 1] : left;
+					}
+					else
+					{
+						const int16_t* data = (const int16_t*)source.Data;
+						left = data[index] * (1.0f / 32768.0f);
+						right = source.Channels == 2 ? data[index + 1] * (1.0f / 32768.0f) : left;
+					}
+
+					// add to output
+					volume += volumeStep;
+					if (_channels == 2)
+					{
+						out[i * 2] += left * voice.GainLeft * volume;
+						out[i * 2 + 1] += right * voice.GainRight * volume;
+					}
+					else
+					{
+						out[i] += (left + right) * 0.5f * volume;
+					}
+				}
+				written += count;
+				voice.Position += count;
+
+				// reached source end: loop or finish
+				if (voice.Position >= source.Frames)
+				{
+					if (voice.Loops == 0) {
+						voice.CurrentVolume = voice.Volume;
+						return false;
+					}
+					if (voice.Loops > 0) { voice.Loops--; }
+					voice.Position = 0;
+				}
+			}
+			voice.CurrentVolume = voice.Volume;
+			return true;
+		}
+
+		// apply bus effects and volume (audio thread)
+		void Mixer::_ProcessBus(int index, float* buffer, int frames)
+		{
+			Bus& bus = _buses[index];
+			int samples = frames * _channels;
+
+			// low-pass filter
+			if (bus.LowPassCoef > 0.0f)
+			{
+				for (int c = 0; c < _channels; ++c)
+				{
+					float state = bus.LowPassState[c];
+					for (int i = c; i < samples; i += _channels)
+					{
+						state += bus.LowPassCoef * (buffer[i] - state);
+						buffer[i] = state;
+					}
+					bus.LowPassState[c] = state;
+				}
+			}
+
+			// ducking: move gain towards target, based on trigger bus peak from previous slice
+			float targetGain = bus.Volume;
+			if (bus.DuckTrigger >= 0)
+			{
+				bool ducked = _buses[bus.DuckTrigger].Peak > DuckingThreshold;
+				float time = ducked ? bus.DuckAttack : bus.DuckRelease;
+				float sliceTime = (float)frames / _frequency;
+				float coef = time > 0.0f ? 1.0f - std::exp(-sliceTime / time) : 1.0f;
+				bus.DuckGain += ((ducked ? 1.0f - bus.DuckAmount : 1.0f) - bus.DuckGain) * coef;
+				targetGain *= bus.DuckGain;
+			}
+
+			// apply volume, ramping from previous gain to avoid clicks, and measure peak
+			float gain = bus.CurrentVolume;
+			float gainStep = (targetGain - gain) / frames;
+			float peak = 0.0f;
+			for (int i = 0; i < frames; ++i)
+			{
+				gain += gainStep;
+				for (int c = 0; c < _channels; ++c)
+				{
+					float& sample = buffer[i * _channels + c];
+					sample *= gain;
+					peak = std::max(peak, std::abs(sample));
+				}
+			}
+			bus.CurrentVolume = targetGain;
+			bus.Peak = peak;
+		}
+
+		// mix a slice (audio thread)
+		void Mixer::_MixSlice(float* out, int frames)
+		{
+			int samples = frames * _channels;
+			for (auto& buffer : _busBuffers) {
+				std::fill(buffer.begin(), buffer.begin() + samples, 0.0f);
+			}
+
+			// mix voices into their buses
+			for (Voice& voice : _voices)
+			{
+				if (voice.Id != InvalidMixerVoice && !_MixVoice(voice, _busBuffers[voice.Bus].data(), frames))
+				{
+					_finished.Push(voice.Id);
+					voice.Id = InvalidMixerVoice;
+					_activeVoices.fetch_sub(1, std::memory_order_relaxed);
+				}
+			}
+
+			// process child buses and mix them into master
+			float* master = _busBuffers[(int)MixerBus::Master].data();
+			for (int bus = (int)MixerBus::Master + 1; bus < (int)MixerBus::_Count; ++bus)
+			{
+				float* buffer = _busBuffers[bus].data();
+				_ProcessBus(bus, buffer, frames);
+				for (int i = 0; i < samples; ++i) {
+					master[i] += buffer[i];
+				}
+			}
+
+			// process master and write output, clamped
+			_ProcessBus((int)MixerBus::Master, master, frames);
+			for (int i = 0; i < samples; ++i) {
+				out[i] = std::max(-1.0f, std::min(1.0f, master[i]));
+			}
+		}
+
+		// mix into output (audio thread)
+		void Mixer::Mix(float* out, int frames)
+		{
+			auto start = std::chrono::steady_clock::now();
+
+			// apply commands and mix in slices
+			_ApplyCommands();
+			const int sliceFrames = MaxFramesPerSlice;
+			for (int done = 0; done < frames; done += sliceFrames) {
+				_MixSlice(out + (size_t)done * _channels, std::min(sliceFrames, frames - done));
+			}
+
+			// update timing stats
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			double budgetMs = frames * 1000.0 / _frequency;
+			uint64_t callbacks = _callbacks.fetch_add(1, std::memory_order_relaxed);
+			double average = callbacks == 0 ? ms : _averageCallbackMs.load(std::memory_order_relaxed) * (1.0 - AverageCallbackSmoothing) + ms * AverageCallbackSmoothing;
+			_lastCallbackMs.store(ms, std::memory_order_relaxed);
+			_averageCallbackMs.store(average, std::memory_order_relaxed);
+			_averageLoad.store(budgetMs > 0 ? average / budgetMs : 0.0, std::memory_order_relaxed);
+			if (ms > _maxCallbackMs.load(std::memory_order_relaxed)) {
+				_maxCallbackMs.store(ms, std::memory_order_relaxed);
+			}
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#include <Sfx/Mixer.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// SDL audio callback that drives the mixer
+		static void MixerAudioCallback(void* userData, Uint8* stream, int len)
+		{
+			Mixer* mixer = (Mixer*)userData;
+			mixer->Mix((float*)stream, len / (int)(sizeof(float) * mixer->Channels()));
+		}
+
+		// open SDL audio device
+		bool Mixer::OpenDevice(int samples)
+		{
+			CloseDevice();
+
+			// make sure audio subsystem is initialized
+			if (!SDL_WasInit(SDL_INIT_AUDIO) && SDL_InitSubSystem(SDL_INIT_AUDIO) < 0)
+			{
+				BON_ELOG_CAT(Sfx, "Failed to init SDL audio for engine mixer! SDL Error: %s", SDL_GetError());
+				return false;
+			}
+
+			// open device with float format. SDL converts to device format if needed
+			SDL_AudioSpec want, have;
+			SDL_zero(want);
+			want.freq = _frequency;
+			want.format = AUDIO_F32SYS;
+			want.channels = (Uint8)_channels;
+			want.samples = (Uint16)samples;
+			want.callback = MixerAudioCallback;
+			want.userdata = this;
+			SDL_AudioDeviceID device = SDL_OpenAudioDevice(nullptr, 0, &want, &have, 0);
+			if (device == 0)
+			{
+				BON_ELOG_CAT(Sfx, "Failed to open engine mixer audio device! SDL Error: %s", SDL_GetError());
+				return false;
+			}
+
+			// start playing
+			_device = device;
+			BON_DLOG_CAT(Sfx, "Opened engine mixer device: driver=%s, frequency=%d, channels=%d, samples=%d.", SDL_GetCurrentAudioDriver(), have.freq, have.channels, have.samples);
+			SDL_PauseAudioDevice(device, 0);
+			return true;
+		}
+
+		// close SDL audio device
+		void Mixer::CloseDevice()
+		{
+			if (_device != 0)
+			{
+				SDL_CloseAudioDevice(_device);
+				_device = 0;
+			}
+		}
+	}
+}
@@ -0,0 +1,449 @@
+#include <Sfx/Resampler.h>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BON_RESAMPLER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define BON_RESAMPLER_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// are SIMD code paths enabled
+		std::atomic<bool> Resampler::_simdEnabled{ true };
+
+		// fixed-point fraction to floating point factor
+		static const double FractionToFloat = 1.0 / 4294967296.0;
+
+		// sample type traits
+		template<typename T>
+		struct SampleTraits
+		{
+			// type to interpolate with. 32 bit integers need double precision
+			typedef typename std::conditional<(sizeof(T) >= 4 && std::is_integral<T>::value), double, float>::type Work;
+
+			// silence value (unsigned formats are centered around half range)
+			static inline T Silence()
+			{
+				return std::is_unsigned<T>::value ? (T)(((uint64_t)std::numeric_limits<T>::max() + 1) / 2) : (T)0;
+			}
+
+			// convert interpolated value back to sample, with rounding and clipping
+			static inline T FromWork(Work value)
+			{
+				if (std::is_floating_point<T>::value) {
+					return (T)value;
+				}
+				value = std::floor(value + (Work)0.5);
+				if (value < (Work)std::numeric_limits<T>::lowest()) { return std::numeric_limits<T>::lowest(); }
+				if (value > (Work)std::numeric_limits<T>::max()) { return std::numeric_limits<T>::max(); }
+				return (T)value;
+			}
+		};
+
+		// get fraction between frames of a fixed-point position
+		template<typename Work>
+		static inline Work Fraction(uint64_t position)
+		{
+			return (Work)((double)(uint32_t)position * FractionToFloat);
+		}
+
+		// cubic (catmull-rom) interpolation between p1 and p2
+		template<typename Work>
+		static inline Work Cubic(Work p0, Work p1, Work p2, Work p3, Work f)
+		{
+			Work c1 = (Work)0.5 * (p2 - p0);
+			Work c2 = p0 - (Work)2.5 * p1 + (Work)2 * p2 - (Work)0.5 * p3;
+			Work c3 = (Work)0.5 * (p3 - p0) + (Work)1.5 * (p1 - p2);
+			return ((c3 * f + c2) * f + c1) * f + p1;
+		}
+
+		// resample frames with linear interpolation, without bounds checks
+		template<typename T>
+		static void LinearRunScalar(const T* source, int channels, T* out, int count, uint64_t position, uint64_t step)
+		{
+			typedef typename SampleTraits<T>::Work Work;
+			for (int i = 0; i < count; ++i, position += step)
+			{
+				const T* left = source + (size_t)(position >> 32) * channels;
+				const Work f = Fraction<Work>(position);
+				for (int c = 0; c < channels; ++c)
+				{
+					Work value = (Work)left[c];
+					*out++ = SampleTraits<T>::FromWork(value + ((Work)left[c + channels] - value) * f);
+				}
+			}
+		}
+
+		// resample frames with cubic interpolation, without bounds checks
+		template<typename T>
+		static void CubicRunScalar(const T* source, int channels, T* out, int count, uint64_t position, uint64_t step)
+		{
+			typedef typename SampleTraits<T>::Work Work;
+			for (int i = 0; i < count; ++i, position += step)
+			{
+				const T* p1 = source + (size_t)(position >> 32) * channels;
+				const Work f = Fraction<Work>(position);
+				for (int c = 0; c < channels; ++c)
+				{
+					*out++ = SampleTraits<T>::FromWork(Cubic<Work>((Work)p1[c - channels], (Work)p1[c], (Work)p1[c + channels], (Work)p1[c + channels * 2], f));
+				}
+			}
+		}
+
+		// get a source sample that may be out of bounds: wrap around when looping, clamp to start or return silence after end otherwise
+		template<typename T>
+		static inline typename SampleTraits<T>::Work EdgeSample(const T* source, int64_t frame, int sourceFrames, int channels, int channel, bool loop)
+		{
+			if (loop) {
+				frame %= sourceFrames;
+				if (frame < 0) { frame += sourceFrames; }
+			}
+			else if (frame < 0) {
+				frame = 0;
+			}
+			else if (frame >= sourceFrames) {
+				return (typename SampleTraits<T>::Work)SampleTraits<T>::Silence();
+			}
+			return (typename SampleTraits<T>::Work)source[(size_t)frame * channels + channel];
+		}
+
+		// resample a single frame near source edges, with bounds checks
+		template<typename T>
+		static void EdgeFrame(const T* source, int sourceFrames, int channels, bool loop, T* out, uint64_t position, ResamplerQuality quality)
+		{
+			typedef typename SampleTraits<T>::Work Work;
+			const int64_t frame = (int64_t)(position >> 32);
+			const Work f = Fraction<Work>(position);
+			for (int c = 0; c < channels; ++c)
+			{
+				Work p1 = EdgeSample(source, frame, sourceFrames, channels, c, loop);
+				Work p2 = EdgeSample(source, frame + 1, sourceFrames, channels, c, loop);
+				if (quality == ResamplerQuality::Cubic)
+				{
+					Work p0 = EdgeSample(source, frame - 1, sourceFrames, channels, c, loop);
+					Work p3 = EdgeSample(source, frame + 2, sourceFrames, channels, c, loop);
+					out[c] = SampleTraits<T>::FromWork(Cubic<Work>(p0, p1, p2, p3, f));
+				}
+				else
+				{
+					out[c] = SampleTraits<T>::FromWork(p1 + (p2 - p1) * f);
+				}
+			}
+		}
+
+#if defined(BON_RESAMPLER_SSE2)
+
+		// interpolate current + (next - current) * f and round to int with floor(value + 0.5), same as the scalar code
+		static inline __m128i LerpRoundS32(__m128 current, __m128 next, __m128 f)
+		{
+			__m128 value = _mm_add_ps(_mm_add_ps(current, _mm_mul_ps(_mm_sub_ps(next, current), f)), _mm_set1_ps(0.5f));
+			__m128i rounded = _mm_cvtps_epi32(value);
+			return _mm_add_epi32(rounded, _mm_castps_si128(_mm_cmplt_ps(value, _mm_cvtepi32_ps(rounded))));
+		}
+
+		// 16 bit stereo linear resampling, 4 frames per iteration.
+		// interpolates in float like the scalar code (so results are identical), 16 bit fixed-point weights can't be accurate for full-scale signals.
+		static void LinearRunStereoS16(const int16_t* source, int16_t* out, int count, uint64_t position, uint64_t step)
+		{
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i results[2];
+				for (int half = 0; half < 2; ++half)
+				{
+					uint64_t p0 = position, p1 = position + step;
+					position += step * 2;
+
+					// load [L R L' R'] of both frames, convert to float and split to current and next frames
+					__m128i a = _mm_loadl_epi64((const __m128i*)(source + (size_t)(p0 >> 32) * 2));
+					__m128i b = _mm_loadl_epi64((const __m128i*)(source + (size_t)(p1 >> 32) * 2));
+					__m128 fa = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16));
+					__m128 fb = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(b, b), 16));
+
+					// interpolate
+					float wa = Fraction<float>(p0), wb = Fraction<float>(p1);
+					results[half] = LerpRoundS32(_mm_movelh_ps(fa, fb), _mm_movehl_ps(fb, fa), _mm_setr_ps(wa, wa, wb, wb));
+				}
+				_mm_storeu_si128((__m128i*)(out + i * 2), _mm_packs_epi32(results[0], results[1]));
+			}
+			LinearRunScalar(source, 2, out + i * 2, count - i, position, step);
+		}
+
+		// 16 bit mono linear resampling, 4 frames per iteration
+		static void LinearRunMonoS16(const int16_t* source, int16_t* out, int count, uint64_t position, uint64_t step)
+		{
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				// gather current and next samples and their fractions
+				float current[4], next[4], fractions[4];
+				for (int j = 0; j < 4; ++j, position += step)
+				{
+					const int16_t* left = source + (size_t)(position >> 32);
+					current[j] = (float)left[0];
+					next[j] = (float)left[1];
+					fractions[j] = Fraction<float>(position);
+				}
+
+				// interpolate
+				__m128i result = LerpRoundS32(_mm_loadu_ps(current), _mm_loadu_ps(next), _mm_loadu_ps(fractions));
+				_mm_storel_epi64((__m128i*)(out + i), _mm_packs_epi32(result, result));
+			}
+			LinearRunScalar(source, 1, out + i, count - i, position, step);
+		}
+
+		// float stereo linear resampling, 2 frames per iteration
+		static void LinearRunStereoF32(const float* source, float* out, int count, uint64_t position, uint64_t step)
+		{
+			int i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				uint64_t p0 = position, p1 = position + step;
+				position += step * 2;
+
+				// load [L R L' R'] of both frames, and split to current and next frames
+				__m128 a = _mm_loadu_ps(source + (size_t)(p0 >> 32) * 2);
+				__m128 b = _mm_loadu_ps(source + (size_t)(p1 >> 32) * 2);
+				__m128 current = _mm_movelh_ps(a, b);
+				__m128 next = _mm_movehl_ps(b, a);
+
+				// interpolate
+				float fa = Fraction<float>(p0), fb = Fraction<float>(p1);
+				__m128 f = _mm_setr_ps(fa, fa, fb, fb);
+				_mm_storeu_ps(out + i * 2, _mm_add_ps(current, _mm_mul_ps(_mm_sub_ps(next, current), f)));
+			}
+			LinearRunScalar(source, 2, out + i * 2, count - i, position, step);
+		}
+
+#elif defined(BON_RESAMPLER_NEON)
+
+		// interpolate current + (next - current) * f and round to int16 with floor(value + 0.5) and clipping, same as the scalar code
+		static inline int16x4_t LerpRoundS16(float32x4_t current, float32x4_t next, float32x4_t f)
+		{
+			float32x4_t value = vaddq_f32(vaddq_f32(current, vmulq_f32(vsubq_f32(next, current), f)), vdupq_n_f32(0.5f));
+			int32x4_t truncated = vcvtq_s32_f32(value);
+			int32x4_t rounded = vaddq_s32(truncated, vreinterpretq_s32_u32(vcltq_f32(value, vcvtq_f32_s32(truncated))));
+			return vqmovn_s32(rounded);
+		}
+
+		// 16 bit stereo linear resampling, 2 frames per iteration.
+		// interpolates in float like the scalar code, same as the SSE2 version.
+		static void LinearRunStereoS16(const int16_t* source, int16_t* out, int count, uint64_t position, uint64_t step)
+		{
+			int i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				uint64_t p0 = position, p1 = position + step;
+				position += step * 2;
+
+				// load [L R L' R'] of both frames, convert to float and split to current and next frames
+				float32x4_t fa = vcvtq_f32_s32(vmovl_s16(vld1_s16(source + (size_t)(p0 >> 32) * 2)));
+				float32x4_t fb = vcvtq_f32_s32(vmovl_s16(vld1_s16(source + (size_t)(p1 >> 32) * 2)));
+				float32x4_t current = vcombine_f32(vget_low_f32(fa), vget_low_f32(fb));
+				float32x4_t next = vcombine_f32(vget_high_f32(fa), vget_high_f32(fb));
+
+				// interpolate
+				float wa = Fraction<float>(p0), wb = Fraction<float>(p1);
+				float fractions[4] = { wa, wa, wb, wb };
+				vst1_s16(out + i * 2, LerpRoundS16(current, next, vld1q_f32(fractions)));
+			}
+			LinearRunScalar(source, 2, out + i * 2, count - i, position, step);
+		}
+
+		// 16 bit mono linear resampling, 4 frames per iteration
+		static void LinearRunMonoS16(const int16_t* source, int16_t* out, int count, uint64_t position, uint64_t step)
+		{
+			int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				// gather current and next samples and their fractions
+				float current[4], next[4], fractions[4];
+				for (int j = 0; j < 4; ++j, position += step)
+				{
+					const int16_t* left = source + (size_t)(position >> 32);
+					current[j] = (float)left[0];
+					next[j] = (float)left[1];
+					fractions[j] = Fraction<float>(position);
+				}
+
+				// interpolate
+				vst1_s16(out + i, LerpRoundS16(vld1q_f32(current), vld1q_f32(next), vld1q_f32(fractions)));
+			}
+			LinearRunScalar(source, 1, out + i, count - i, position, step);
+		}
+
+		// float stereo linear resampling
+		static void LinearRunStereoF32(const float* source, float* out, int count, uint64_t position, uint64_t step)
+		{
+			for (int i = 0; i < count; ++i, position += step)
+			{
+				float32x4_t frames = vld1q_f32(source + (size_t)(position >> 32) * 2);
+				float32x2_t current = vget_low_f32(frames);
+				float32x2_t next = vget_high_f32(frames);
+				vst1_f32(out + i * 2, vmla_n_f32(current, vsub_f32(next, current), Fraction<float>(position)));
+			}
+		}
+
+#endif
+
+		// resample frames with linear interpolation, without bounds checks
+		template<typename T>
+		static inline void LinearRun(const T* source, int channels, T* out, int count, uint64_t position, uint64_t step)
+		{
+			LinearRunScalar(source, channels, out, count, position, step);
+		}
+
+#if defined(BON_RESAMPLER_SSE2) || defined(BON_RESAMPLER_NEON)
+
+		// 16 bit linear resampling, with SIMD for stereo and mono
+		template<>
+		inline void LinearRun<int16_t>(const int16_t* source, int channels, int16_t* out, int count, uint64_t position, uint64_t step)
+		{
+			if (Resampler::IsSimdEnabled() && channels == 2) {
+				LinearRunStereoS16(source, out, count, position, step);
+			}
+			else if (Resampler::IsSimdEnabled() && channels == 1) {
+				LinearRunMonoS16(source, out, count, position, step);
+			}
+			else {
+				LinearRunScalar(source, channels, out, count, position, step);
+			}
+		}
+
+		// float linear resampling, with SIMD for stereo
+		template<>
+		inline void LinearRun<float>(const float* source, int channels, float* out, int count, uint64_t position, uint64_t step)
+		{
+			if (Resampler::IsSimdEnabled() && channels == 2) {
+				LinearRunStereoF32(source, out, count, position, step);
+			}
+			else {
+				LinearRunScalar(source, channels, out, count, position, step);
+			}
+		}
+
+#endif
+
+		// resample any sample type
+		template<typename T>
+		static int ResampleImp(const T* source, int sourceFrames, int channels, bool loop, T* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			int written = 0;
+			if (source != nullptr && sourceFrames > 0 && channels > 0)
+			{
+				// how many extra frames each interpolation reads, before and after current frame
+				const int tapsBefore = (quality == ResamplerQuality::Cubic) ? 1 : 0;
+				const int tapsAfter = (quality == ResamplerQuality::Cubic) ? 2 : 1;
+				const uint64_t length = (uint64_t)sourceFrames << 32;
+
+				while (written < outFrames)
+				{
+					// reached source end? wrap around or stop
+					if (position >= length)
+					{
+						if (!loop) { break; }
+						position %= length;
+					}
+
+					// count how many frames we can resample before interpolation reads out of bounds
+					const int64_t frame = (int64_t)(position >> 32);
+					int count = 0;
+					if (frame >= tapsBefore && frame + tapsAfter < sourceFrames)
+					{
+						uint64_t lastSafePosition = ((uint64_t)(sourceFrames - 1 - tapsAfter) << 32) | 0xFFFFFFFFull;
+						uint64_t safeFrames = (step == 0) ? (uint64_t)(outFrames - written) : (lastSafePosition - position) / step + 1;
+						count = (int)std::min<uint64_t>(safeFrames, (uint64_t)(outFrames - written));
+					}
+
+					// resample a run without bounds checks
+					T* dest = out + (size_t)written * channels;
+					if (count > 0)
+					{
+						if (quality == ResamplerQuality::Cubic) {
+							CubicRunScalar(source, channels, dest, count, position, step);
+						}
+						else {
+							LinearRun(source, channels, dest, count, position, step);
+						}
+						position += step * (uint64_t)count;
+						written += count;
+					}
+					// near source edges, resample a single frame with bounds checks
+					else
+					{
+						EdgeFrame(source, sourceFrames, channels, loop, dest, position, quality);
+						position += step;
+						written++;
+					}
+				}
+			}
+
+			// fill what's left with silence
+			if (written < outFrames) {
+				std::fill(out + (size_t)written * channels, out + (size_t)outFrames * channels, SampleTraits<T>::Silence());
+			}
+			return written;
+		}
+
+		// get if SIMD code was compiled in
+		bool Resampler::IsSimdAvailable()
+		{
+#if defined(BON_RESAMPLER_SSE2) || defined(BON_RESAMPLER_NEON)
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		// enable / disable SIMD code
+		void Resampler::EnableSimd(bool enable)
+		{
+			_simdEnabled.store(enable);
+		}
+
+		// resample 16 bit audio
+		int Resampler::Resample(const int16_t* source, int sourceFrames, int channels, bool loop, int16_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			return ResampleImp(source, sourceFrames, channels, loop, out, outFrames, position, step, quality);
+		}
+
+		// resample float audio
+		int Resampler::Resample(const float* source, int sourceFrames, int channels, bool loop, float* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			return ResampleImp(source, sourceFrames, channels, loop, out, outFrames, position, step, quality);
+		}
+
+		// resample unsigned 8 bit audio
+		int Resampler::Resample(const uint8_t* source, int sourceFrames, int channels, bool loop, uint8_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			return ResampleImp(source, sourceFrames, channels, loop, out, outFrames, position, step, quality);
+		}
+
+		// resample signed 8 bit audio
+		int Resampler::Resample(const int8_t* source, int sourceFrames, int channels, bool loop, int8_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			return ResampleImp(source, sourceFrames, channels, loop, out, outFrames, position, step, quality);
+		}
+
+		// resample unsigned 16 bit audio
+		int Resampler::Resample(const uint16_t* source, int sourceFrames, int channels, bool loop, uint16_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			return ResampleImp(source, sourceFrames, channels, loop, out, outFrames, position, step, quality);
+		}
+
+		// resample 32 bit audio
+		int Resampler::Resample(const int32_t* source, int sourceFrames, int channels, bool loop, int32_t* out, int outFrames, uint64_t& position, uint64_t step, ResamplerQuality quality)
+		{
+			return ResampleImp(source, sourceFrames, channels, loop, out, outFrames, position, step, quality);
+		}
+	}
+}
@@ -21,6 +21,7 @@ namespace bon
 		// do updates
 		void Sfx::_Update(double deltaTime)
 		{
+			_Implementor.Update(deltaTime);
 		}
 
 		// called on main loop start
@@ -43,6 +44,7 @@ namespace bon
 		// start playing a music track
 		void Sfx::PlayMusic(assets::MusicAsset music, int volume, int loops, float fadeInTime)
 		{
+			BON_PROFILE_SCOPE("Sfx::PlayMusic");
 			_Implementor.PlayMusic(music, loops, fadeInTime);
 			SetMusicVolume(volume);
 		}
@@ -76,6 +78,7 @@ namespace bon
 		// play a sound effect
 		SoundChannelId Sfx::PlaySound(assets::SoundAsset sound, int volume, int loops, float pitch, float fadeInTime)
 		{
+			BON_PROFILE_SCOPE("Sfx::PlaySound");
 			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::PlaySoundCalls);
 			volume = (int)((float)volume * _masterVolume);
 			SoundChannelId ret = _Implementor.PlaySound(sound, volume, loops, pitch, fadeInTime);
@@ -85,6 +88,7 @@ namespace bon
 		// play a sound effect
 		SoundChannelId Sfx::PlaySound(assets::SoundAsset sound, int volume, int loops, float pitch, float panLeft, float panRight, float distance, float fadeInTime)
 		{
+			BON_PROFILE_SCOPE("Sfx::PlaySound");
 			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::PlaySoundCalls);
 			volume = (int)((float)volume * _masterVolume);
 			SoundChannelId ret = _Implementor.PlaySound(sound, volume, loops, pitch, fadeInTime);
@@ -96,6 +100,24 @@ namespace bon
 			return ret != AllChannels ? ret : InvalidSoundChannel;
 		}
 
+		// play a sound on engine mixer bus
+		MixerVoiceId Sfx::PlaySoundOnBus(assets::SoundAsset sound, MixerBus bus, int volume, int loops, float pan)
+		{
+			BON_PROFILE_SCOPE("Sfx::PlaySoundOnBus");
+			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::PlaySoundCalls);
+			volume = (int)((float)volume * _masterVolume);
+			return _Implementor.PlaySoundOnBus(sound, bus, volume, loops, pan);
+		}
+
+		// play a positional sound
+		SoundEmitterId Sfx::PlaySoundAt(assets::SoundAsset sound, const framework::PointF& position, int volume, int loops, float pitch)
+		{
+			BON_PROFILE_SCOPE("Sfx::PlaySoundAt");
+			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::PlaySoundCalls);
+			volume = (int)((float)volume * _masterVolume);
+			return _Implementor.PlaySoundAt(sound, position, volume, loops, pitch);
+		}
+
 		// set channel panning
 		void Sfx::SetChannelPanning(SoundChannelId channel, float panLeft, float panRight)
 		{
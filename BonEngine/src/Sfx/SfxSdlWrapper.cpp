@@ -9,6 +9,11 @@
 #include <Sfx/Defs.h>
 #include <BonEngine.h>
 #include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <fstream>
+#include <vector>
+#include <cstring>
 
 #pragma warning(push, 0)
 #include <SDL2-2.0.12/include/SDL.h>
@@ -54,15 +59,88 @@ namespace bon
 			return ((frames * 1000) / AudioSpec::frequency);
 		}
 
+		// read little endian integers
+		static inline uint32_t ReadLE32(const uint8_t* data) { return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24); }
+		static inline uint64_t ReadLE64(const uint8_t* data) { return (uint64_t)ReadLE32(data) | ((uint64_t)ReadLE32(data + 4) << 32); }
+
+		// get ogg (vorbis or opus) file length from its headers: sample rate from identification header, and samples count from last page granule position
+		static float ReadOggLength(const char* path)
+		{
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file.is_open()) { return -1.0f; }
+			size_t fileSize = (size_t)file.tellg();
+
+			// read first pages, to find identification header
+			std::vector<uint8_t> buffer(std::min(fileSize, (size_t)4096));
+			file.seekg(0);
+			file.read((char*)buffer.data(), buffer.size());
+			double rate = 0;
+			uint64_t preSkip = 0;
+			for (size_t i = 0; i + 16 <= buffer.size() && rate == 0; ++i)
+			{
+				if (memcmp(&buffer[i], "\x01vorbis", 7) == 0) {
+					rate = (double)ReadLE32(&buffer[i + 12]);
+				}
+				else if (memcmp(&buffer[i], "OpusHead", 8) == 0) {
+					rate = 48000.0;
+					preSkip = (uint64_t)buffer[i + 10] | ((uint64_t)buffer[i + 11] << 8);
+				}
+			}
+			if (rate <= 0) { return -1.0f; }
+
+			// read file end and find last page with a valid granule position
+			size_t tailSize = std::min(fileSize, (size_t)65536);
+			buffer.resize(tailSize);
+			file.seekg(fileSize - tailSize);
+			file.read((char*)buffer.data(), tailSize);
+			for (size_t i = tailSize >= 14 ? tailSize - 13 : 0; i-- > 0;)
+			{
+				if (buffer[i] == 'O' && memcmp(&buffer[i], "OggS", 4) == 0 && buffer[i + 4] == 0)
+				{
+					uint64_t granule = ReadLE64(&buffer[i + 6]);
+					if (granule != ~(uint64_t)0 && granule > preSkip) {
+						return (float)((double)(granule - preSkip) / rate);
+					}
+				}
+			}
+			return -1.0f;
+		}
+
+		// get music length, in seconds, from file headers. returns -1 if format is not supported
+		static float ReadMusicLength(const char* path)
+		{
+			// formats we have stream decoders for (wav, and any registered decoder) - get length from decoder
+			std::string extension = SoundStreams::GetExtension(path);
+			if (SoundStreams::HasDecoder(extension.c_str()))
+			{
+				auto decoder = SoundStreams::CreateDecoder(extension.c_str(), StreamSource::FromFile(path));
+				if (decoder && decoder->TotalFrames() >= 0 && decoder->Frequency() > 0) {
+					return (float)((double)decoder->TotalFrames() / (double)decoder->Frequency());
+				}
+			}
+
+			// ogg files
+			if (extension == "ogg" || extension == "oga" || extension == "opus") {
+				return ReadOggLength(path);
+			}
+
+			// unknown
+			return -1.0f;
+		}
+
 		// music handle for SDL
 		class SDL_MusicHandle : public assets::_MusicHandle
 		{
+		private:
+			// track length, in seconds (-1 if unknown)
+			float _length;
+
 		public:
 
 			/**
 			 * Create SDL music handle.
 			 */
-			SDL_MusicHandle(Mix_Music* track)
+			SDL_MusicHandle(Mix_Music* track, float length) : _length(length)
 			{
 				Track = track;
 			}
@@ -80,12 +158,11 @@ namespace bon
 			/**
 			 * Get track length, in seconds.
 			 *
-			 * \return Music track length.
+			 * \return Music track length, or -1 if unknown.
 			 */
 			virtual float Length() const override
 			{
-				BON_ELOG("Getting music track length is not supported! Returning -1.0 instead.");
-				return -1.0f;
+				return _length;
 			}
 		};
 
@@ -94,18 +171,18 @@ namespace bon
 		{
 			// get asset path
 			const char* path = asset->Path();
-			BON_DLOG("Load music track from file: %s.", path);
+			BON_DLOG_CAT(Sfx, "Load music track from file: %s.", path);
 
 			//Load music
 			Mix_Music* music = Mix_LoadMUS(path);
 			if (music == NULL)
 			{
-				BON_WLOG("Failed to load music! SDL_mixer Error: %s\n", Mix_GetError());
+				BON_WLOG_CAT(Sfx, "Failed to load music! SDL_mixer Error: %s\n", Mix_GetError());
 				throw AssetLoadError(path);
 			}
 			
 			// set handle
-			SDL_MusicHandle* handle = new SDL_MusicHandle(music);
+			SDL_MusicHandle* handle = new SDL_MusicHandle(music, ReadMusicLength(path));
 			asset->_SetHandle(handle);
 		}
 
@@ -115,9 +192,22 @@ namespace bon
 			asset->_DestroyHandle<SDL_MusicHandle>();
 		}
 
+		class SDLChunkHandle;
+
+		// what sound handle plays on every channel. set when a sound starts playing and cleared by channel finished callback
+		static std::atomic<SDLChunkHandle*> _channelSounds[MaxVoices];
+
+		// channel finished callback
+		static void ChannelFinishedCallback(int channel);
+
 		// chunk (sound) handle for SDL
 		class SDLChunkHandle : public assets::_SoundHandle
 		{
+		private:
+			// how many voices play this sound, and which channels they are (bitmask)
+			std::atomic<int> _instances{ 0 };
+			std::atomic<uint64_t> _channels[MaxVoices / 64] = {};
+
 		public:
 
 			/**
@@ -133,12 +223,62 @@ namespace bon
 			 */
 			virtual ~SDLChunkHandle()
 			{
+				// Mix_FreeChunk() stops channels without calling channel finished callback, so we stop them first
+				StopAll();
 				if (Track) 
 				{
 					Mix_FreeChunk((Mix_Chunk*)(Track));
 				}
 			}
 
+			/**
+			 * Called when this sound starts playing on a channel.
+			 */
+			void _OnVoiceStarted(int channel)
+			{
+				_channels[channel / 64].fetch_or((uint64_t)1 << (channel % 64), std::memory_order_relaxed);
+				_instances.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Called when this sound stops playing on a channel.
+			 */
+			void _OnVoiceFinished(int channel)
+			{
+				_channels[channel / 64].fetch_and(~((uint64_t)1 << (channel % 64)), std::memory_order_relaxed);
+				_instances.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Stop all channels playing this sound.
+			 */
+			void StopAll()
+			{
+				if (_instances.load(std::memory_order_relaxed) == 0) {
+					return;
+				}
+
+				// halting channels calls channel finished callback, which updates channels mask
+				for (int word = 0; word < MaxVoices / 64; ++word)
+				{
+					uint64_t channels = _channels[word].load(std::memory_order_relaxed);
+					for (int bit = 0; channels != 0; ++bit, channels >>= 1)
+					{
+						if (channels & 1) {
+							Mix_HaltChannel(word * 64 + bit);
+						}
+					}
+				}
+			}
+
+			/**
+			 * Get how many voices currently play this sound.
+			 */
+			virtual int PlayingInstances() const override
+			{
+				return _instances.load(std::memory_order_relaxed);
+			}
+
 			/**
 			 * Get track length, in seconds.
 			 *
@@ -154,29 +294,173 @@ namespace bon
 			*/
 			virtual bool IsPlaying() const override
 			{
-				for (int i = 0; i < AudioSpec::allocatedMixChannelsCount; ++i) 
-				{
-					if (Mix_Playing(i) && Mix_GetChunk(i) == Track) 
-					{
-						return true;
-					}
-				}
-				return false;
+				return PlayingInstances() > 0;
+			}
+
+			/**
+			 * Get decoded audio memory, in bytes.
+			 */
+			virtual size_t MemorySize() const override
+			{
+				return (size_t)((Mix_Chunk*)Track)->alen;
+			}
+		};
+
+		// channel finished playing (audio thread, or main thread when halting channels)
+		static void ChannelFinishedCallback(int channel)
+		{
+			if (channel < 0 || channel >= MaxVoices) {
+				return;
+			}
+			SDLChunkHandle* handle = _channelSounds[channel].exchange(nullptr, std::memory_order_acq_rel);
+			if (handle) {
+				handle->_OnVoiceFinished(channel);
+			}
+		}
+
+		// register sound that just started playing on a channel
+		static void RegisterChannelSound(SDLChunkHandle* handle, int channel, Mix_Chunk* chunk)
+		{
+			// if channel had a sound we missed the finish of, release it
+			SDLChunkHandle* previous = _channelSounds[channel].exchange(handle, std::memory_order_acq_rel);
+			if (previous) {
+				previous->_OnVoiceFinished(channel);
+			}
+			handle->_OnVoiceStarted(channel);
+
+			// if sound already ended before we registered it, its finished callback didn't find it - release it now
+			if (!Mix_Playing(channel) || Mix_GetChunk(channel) != chunk) {
+				ChannelFinishedCallback(channel);
+			}
+		}
+
+		// silent audio to play on channels of streamed sounds, which stream effect replaces with decoded audio
+		static Uint8 _streamCarrierData[4096] = { 0 };
+
+		// streamed sound handle for SDL.
+		// track is a silent chunk that loops while streaming, so channel based queries (like IsPlaying) work the same as regular sounds.
+		class SDLStreamHandle : public SDLChunkHandle
+		{
+		private:
+			// where to stream from
+			std::string _path;
+			std::string _format;
+			std::shared_ptr<const std::vector<uint8_t>> _buffer;
+
+			// decoded format info
+			int _frequency = 0;
+			int _channels = 0;
+			long long _totalFrames = -1;
+
+		public:
+
+			/**
+			 * Create SDL stream handle.
+			 */
+			SDLStreamHandle(const char* path, const std::string& format, std::shared_ptr<const std::vector<uint8_t>> buffer) :
+				SDLChunkHandle(Mix_QuickLoad_RAW(_streamCarrierData, sizeof(_streamCarrierData))), _path(path), _format(format), _buffer(std::move(buffer))
+			{
+			}
+
+			/**
+			 * Open a new decoder for this stream.
+			 */
+			std::unique_ptr<IStreamDecoder> OpenDecoder() const
+			{
+				auto source = _buffer ? StreamSource::FromMemory(_buffer) : StreamSource::FromFile(_path.c_str());
+				return SoundStreams::CreateDecoder(_format.c_str(), source);
+			}
+
+			/**
+			 * Set decoded format info.
+			 */
+			void SetFormatInfo(int frequency, int channels, long long totalFrames)
+			{
+				_frequency = frequency;
+				_channels = channels;
+				_totalFrames = totalFrames;
+			}
+
+			/**
+			 * Get track length, in seconds (or -1 if unknown).
+			 */
+			virtual float Length() const override
+			{
+				return (_totalFrames >= 0 && _frequency > 0) ? (float)((double)_totalFrames / (double)_frequency) : -1.0f;
+			}
+
+			/**
+			 * Get resident memory: encoded buffer, if streaming from memory.
+			 */
+			virtual size_t MemorySize() const override
+			{
+				return _buffer ? _buffer->size() : 0;
+			}
+
+			/**
+			 * Get memory this sound would take if fully decoded to device format.
+			 */
+			virtual size_t DecodedSize() const override
+			{
+				if (_totalFrames < 0 || _frequency <= 0) { return 0; }
+				double deviceFrames = (double)_totalFrames * AudioSpec::frequency / _frequency;
+				return (size_t)(deviceFrames * formatSampleSize(AudioSpec::format) * AudioSpec::channelCount);
 			}
 		};
 
+		// streamed sound loader
+		void StreamedSoundLoader(bon::assets::IAsset* asset, void* extraData)
+		{
+			// get source: memory buffer (copied) or file
+			const char* path = asset->Path();
+			std::shared_ptr<const std::vector<uint8_t>> buffer;
+			std::string format;
+			if (extraData)
+			{
+				_SoundStreamData* streamData = (_SoundStreamData*)extraData;
+				const uint8_t* data = (const uint8_t*)streamData->Data;
+				buffer = std::make_shared<const std::vector<uint8_t>>(data, data + streamData->Size);
+				format = SoundStreams::GetExtension((std::string(".") + (streamData->Format ? streamData->Format : "")).c_str());
+				BON_DLOG_CAT(Sfx, "Create streamed sound from memory: %d bytes, format: %s.", (int)streamData->Size, format.c_str());
+			}
+			else
+			{
+				format = SoundStreams::GetExtension(path);
+				BON_DLOG_CAT(Sfx, "Load streamed sound from file: %s.", path);
+			}
+
+			// create handle and probe decoder to validate source and get its format
+			SDLStreamHandle* handle = new SDLStreamHandle(path, format, buffer);
+			auto decoder = handle->OpenDecoder();
+			if (decoder == nullptr || !handle->IsValid())
+			{
+				delete handle;
+				BON_ELOG_CAT(Sfx, "Failed to load streamed sound '%s'! Format '%s' is not supported or data is invalid.", path, format.c_str());
+				throw AssetLoadError("Failed to load streamed sound.");
+			}
+			handle->SetFormatInfo(decoder->Frequency(), decoder->Channels(), decoder->TotalFrames());
+			asset->_SetHandle(handle);
+		}
+
 		// sound loader we set in the assets manager during initialize
 		void SoundLoader(bon::assets::IAsset* asset, void* context, void* extraData = nullptr)
 		{
+			// streamed sounds don't decode on load
+			if (static_cast<_Sound*>(asset)->IsStreamed())
+			{
+				StreamedSoundLoader(asset, extraData);
+				return;
+			}
+
 			// get asset path
 			const char* path = asset->Path();
-			BON_DLOG("Load sound effect from file: %s.", path);
+			BON_DLOG_CAT(Sfx, "Load sound effect from file: %s.", path);
 
 			// load chunk
 			Mix_Chunk* sound = Mix_LoadWAV(path);
 			if (sound == NULL)
 			{
-				BON_ELOG("Failed to load sound! SDL_mixer Error: %s\n", Mix_GetError());
+				BON_ELOG_CAT(Sfx, "Failed to load sound! SDL_mixer Error: %s\n", Mix_GetError());
 				throw AssetLoadError(path);
 			}
 
@@ -215,7 +499,7 @@ namespace bon
 			// initialize SDL and make sure succeed
 			if (SDL_Init(SDL_INIT_AUDIO) < 0)
 			{
-				BON_ELOG("SDL could not initialize! SDL_Error: %s\n", SDL_GetError());
+				BON_ELOG_CAT(Sfx, "SDL could not initialize! SDL_Error: %s\n", SDL_GetError());
 				throw InitializeError("Failed to initialize SDL sound drivers.");
 			}
 
@@ -232,24 +516,73 @@ namespace bon
 			// initialize SDL_mixer
 			if (Mix_OpenAudio(AudioSpec::frequency, AudioSpec::format, AudioSpec::channelCount, AudioSpec::chunkSize) < 0)
 			{
-				BON_ELOG("SDL_mixer could not initialize! SDL_mixer Error: %s\n", Mix_GetError());
+				BON_ELOG_CAT(Sfx, "SDL_mixer could not initialize! SDL_mixer Error: %s\n", Mix_GetError());
 				throw InitializeError("SDL_mixer could not initialize!");
 			}
 
+			// track when channels finish, to know which sounds are playing
+			Mix_ChannelFinished(ChannelFinishedCallback);
+
+			// count mixed frames to track music position
+			int frequency, channels;
+			Uint16 format;
+			if (Mix_QuerySpec(&frequency, &format, &channels))
+			{
+				_outputFrequency = frequency;
+				_outputFrameBytes = SDL_AUDIO_BITSIZE(format) / 8 * channels;
+			}
+			Mix_UnregisterEffect(MIX_CHANNEL_POST, _MusicPositionEffect);
+			Mix_RegisterEffect(MIX_CHANNEL_POST, _MusicPositionEffect, nullptr, this);
+
 			// allocate mix channels
-			AudioSpec::allocatedMixChannelsCount = Mix_AllocateChannels(MIX_CHANNELS);
+			AudioSpec::allocatedMixChannelsCount = Mix_AllocateChannels(_voicesCount);
+			_voices.assign(AudioSpec::allocatedMixChannelsCount, VoiceInfo());
+
+			// start streaming thread
+			_streams.Start(AudioSpec::chunkSize);
+
+			// create engine mixer
+			if (_engineMixerEnabled && !_mixer) {
+				_CreateEngineMixer();
+			}
 
 			// print spec and mark as initialized
-			BON_DLOG("Initialize sfx: frequency=%d, format=%d, channels=%d, chunks_size=%d, mix_channels: %d.", AudioSpec::frequency, AudioSpec::format, AudioSpec::channelCount, AudioSpec::chunkSize, AudioSpec::allocatedMixChannelsCount);
+			BON_DLOG_CAT(Sfx, "Initialize sfx: frequency=%d, format=%d, channels=%d, chunks_size=%d, mix_channels: %d.", AudioSpec::frequency, AudioSpec::format, AudioSpec::channelCount, AudioSpec::chunkSize, AudioSpec::allocatedMixChannelsCount);
 			_wasInit = true;
 
 			// update specs
 			Custom_Mix_UpdateSpecs();
 		}
 
+		// count frames mixed while music plays (audio thread)
+		void SfxSdlWrapper::_MusicPositionEffect(int channel, void* stream, int len, void* userData)
+		{
+			SfxSdlWrapper* self = (SfxSdlWrapper*)userData;
+			if (self->_outputFrameBytes > 0 && Mix_PlayingMusic() && !Mix_PausedMusic()) {
+				self->_musicFrames.fetch_add((uint64_t)(len / self->_outputFrameBytes), std::memory_order_relaxed);
+			}
+		}
+
+		// get music position
+		float SfxSdlWrapper::GetMusicPosition() const
+		{
+			if (_outputFrequency <= 0 || !Mix_PlayingMusic()) {
+				return 0.0f;
+			}
+			double position = (double)_musicFrames.load(std::memory_order_relaxed) / (double)_outputFrequency;
+			if (_musicLength > 0) {
+				position = std::fmod(position, (double)_musicLength);
+			}
+			return (float)position;
+		}
+
 		// play music track
 		void SfxSdlWrapper::PlayMusic(MusicAsset music, int loops, float fadeInTime)
 		{
+			// reset music position
+			_musicLength = music->Length();
+			_musicFrames.store(0, std::memory_order_relaxed);
+
 			// get track and play it
 			Mix_Music* sdlmusic = (Mix_Music*)(music->Handle()->Track);
 			if (fadeInTime > 0)
@@ -271,7 +604,122 @@ namespace bon
 		// set channel distance
 		void SfxSdlWrapper::SetChannelDistance(SoundChannelId channel, float distance)
 		{
-			Mix_SetDistance(channel, (Uint8)(std::min(distance, 1.0f) * 255));
+			Uint8 sdlDistance = (Uint8)(std::min(distance, 1.0f) * 255);
+			Mix_SetDistance(channel, sdlDistance);
+			if (channel >= 0 && channel < (int)_voices.size()) {
+				_voices[channel].Distance = sdlDistance;
+			}
+		}
+
+		// set how many voices to allocate
+		void SfxSdlWrapper::SetVoicesCount(int count)
+		{
+			_voicesCount = std::max(1, std::min(count, MaxVoices));
+			if (_wasInit)
+			{
+				AudioSpec::allocatedMixChannelsCount = Mix_AllocateChannels(_voicesCount);
+				_voices.resize(AudioSpec::allocatedMixChannelsCount);
+				BON_DLOG_CAT(Sfx, "Set voices count: %d.", AudioSpec::allocatedMixChannelsCount);
+			}
+		}
+
+		// set sound group limit
+		void SfxSdlWrapper::SetSoundGroupLimit(int group, int maxVoices)
+		{
+			if (maxVoices > 0) {
+				_groupLimits[group] = maxVoices;
+			}
+			else {
+				_groupLimits.erase(group);
+			}
+		}
+
+		// check if a voice is playing a sound we started on it
+		bool SfxSdlWrapper::_IsVoiceActive(int channel) const
+		{
+			return Mix_Playing(channel) && Mix_GetChunk(channel) == _voices[channel].Chunk;
+		}
+
+		// find voice to steal
+		int SfxSdlWrapper::_FindVoiceToSteal(int priority, int group) const
+		{
+			if (_stealingPolicy == VoiceStealingPolicy::None) {
+				return -1;
+			}
+
+			int best = -1;
+			for (int i = 0; i < (int)_voices.size(); ++i)
+			{
+				// skip inactive voices, voices from other groups and voices of more important sounds
+				const VoiceInfo& voice = _voices[i];
+				if (!_IsVoiceActive(i) || (group >= 0 && voice.Group != group) || voice.Priority > priority) {
+					continue;
+				}
+
+				// first candidate
+				if (best == -1) {
+					best = i;
+					continue;
+				}
+
+				// compare to best candidate so far. on ties, prefer the older sound
+				const VoiceInfo& current = _voices[best];
+				bool older = voice.StartOrder < current.StartOrder;
+				switch (_stealingPolicy)
+				{
+				case VoiceStealingPolicy::Oldest:
+					if (older) { best = i; }
+					break;
+
+				case VoiceStealingPolicy::Quietest:
+				{
+					int loudness = voice.Volume * (255 - voice.Distance);
+					int currentLoudness = current.Volume * (255 - current.Distance);
+					if (loudness < currentLoudness || (loudness == currentLoudness && older)) { best = i; }
+					break;
+				}
+
+				case VoiceStealingPolicy::LowestPriority:
+					if (voice.Priority < current.Priority || (voice.Priority == current.Priority && older)) { best = i; }
+					break;
+
+				default:
+					break;
+				}
+			}
+			return best;
+		}
+
+		// pick voice to play a new sound on
+		int SfxSdlWrapper::_PickVoice(int priority, int group)
+		{
+			// check if sound group reached its limit. if so, can only steal from the same group
+			if (group >= 0)
+			{
+				auto limit = _groupLimits.find(group);
+				if (limit != _groupLimits.end())
+				{
+					int inGroup = 0;
+					for (int i = 0; i < (int)_voices.size(); ++i) 
+					{
+						if (_voices[i].Group == group && _IsVoiceActive(i)) { inGroup++; }
+					}
+					if (inGroup >= limit->second) {
+						return _FindVoiceToSteal(priority, group);
+					}
+				}
+			}
+
+			// find a free voice
+			for (int i = 0; i < (int)_voices.size(); ++i)
+			{
+				if (!Mix_Playing(i)) {
+					return i;
+				}
+			}
+
+			// all voices are busy, try to steal one
+			return _FindVoiceToSteal(priority, -1);
 		}
 
 		// pause / resume music
@@ -325,31 +773,85 @@ namespace bon
 		// start playing sound
 		SoundChannelId SfxSdlWrapper::PlaySound(assets::SoundAsset sound, int volume, int loops, float pitch, float fadeInTime)
 		{
-			// get chunk and start playing
-			Mix_Chunk* sdlchunk = (Mix_Chunk*)(sound->Handle()->Track);
-			SoundChannelId channel;
+			// pick voice to play on. if no voice is available, drop the sound
+			SoundChannelId channel = _PickVoice(sound->Priority(), sound->Group());
+			if (channel < 0)
+			{
+				bon::_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::SoundsDropped);
+				BON_DLOG_RATE(1000, "No free voice to play sound '%s', sound dropped.", sound->Path());
+				return -1;
+			}
+
+			// play sound chunk
+			return _StartVoice(sound, sound->Handle()->Track, channel, volume, loops, pitch, fadeInTime);
+		}
+
+		// start playing sound chunk on voice
+		SoundChannelId SfxSdlWrapper::_StartVoice(assets::SoundAsset sound, void* chunk, SoundChannelId channel, int volume, int loops, float pitch, float fadeInTime)
+		{
+			Mix_Chunk* sdlchunk = (Mix_Chunk*)chunk;
+
+			// if voice is busy we steal it
+			if (Mix_Playing(channel))
+			{
+				Mix_HaltChannel(channel);
+				bon::_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::SoundsStolen);
+			}
+
+			// streamed sounds play their silent chunk endlessly, and stream handles loops
+			bool streamed = sound->IsStreamed();
+			int chunkLoops = streamed ? -1 : loops;
 
 			// play sound with fade in
 			if (fadeInTime > 0)
 			{
-				channel = Mix_FadeInChannel(-1, sdlchunk, loops, (int)(fadeInTime * 1000.0f));
+				channel = Mix_FadeInChannel(channel, sdlchunk, chunkLoops, (int)(fadeInTime * 1000.0f));
 			}
 			// play sound immediately
 			else
 			{
-				channel = Mix_PlayChannel(-1, sdlchunk, loops);
+				channel = Mix_PlayChannel(channel, sdlchunk, chunkLoops);
+			}
+
+			// track sound's voices
+			if (channel >= 0) {
+				RegisterChannelSound(static_cast<SDLChunkHandle*>(sound->Handle()), channel, sdlchunk);
+			}
+
+			// start streaming into channel
+			if (streamed && channel >= 0)
+			{
+				if (!_streams.Play(channel, static_cast<SDLStreamHandle*>(sound->Handle())->OpenDecoder(), loops))
+				{
+					BON_ELOG_CAT(Sfx, "Failed to start streaming sound '%s'.", sound->Path());
+					Mix_HaltChannel(channel);
+					return -1;
+				}
+				if (pitch != 1.0f) {
+					BON_WLOG_CAT(Sfx, "Pitch is not supported for streamed sounds, ignored.");
+					pitch = 1.0f;
+				}
 			}
 			
-			// if got a valid channel to play on (we might not get a channel if all are in use), set volume and pitch
+			// if got a valid channel to play on, set volume and pitch
 			if (channel >= 0) {
 
 				// set volume
 				Mix_Volume(channel, volume);
 
+				// store voice info
+				VoiceInfo& voice = _voices[channel];
+				voice.Chunk = sdlchunk;
+				voice.Priority = sound->Priority();
+				voice.Group = sound->Group();
+				voice.Volume = volume;
+				voice.Distance = 0;
+				voice.StartOrder = _playOrder++;
+
 				// set pitch
 				if (pitch != 1.0f) 
 				{
-					Custom_Mix_RegisterPlaybackSpeedEffect(channel, sdlchunk, pitch, loops, AudioSpec::format);
+					Custom_Mix_RegisterPlaybackSpeedEffect(channel, sdlchunk, pitch, loops, _pitchQuality);
 				}
 				// disable previously set pitch
 				else 
@@ -368,37 +870,455 @@ namespace bon
 			if (Mix_Playing(channel))
 			{
 				Mix_Volume(channel, max(volume, 0));
+				if (channel < (int)_voices.size()) {
+					_voices[channel].Volume = max(volume, 0);
+				}
 			}
 		}
 
 		// check if a given sound is playing on a channel
 		bool SfxSdlWrapper::IsPlaying(SoundAsset sound, SoundChannelId channel) const
 		{
-			// get chunk
-			Mix_Chunk* sdlchunk = (Mix_Chunk*)(sound->Handle()->Track);
-
 			// check a single channel
 			if (channel >= 0) 
 			{
-				return Mix_Playing(channel) && Mix_GetChunk(channel) == sdlchunk;
+				return channel < MaxVoices && _channelSounds[channel].load(std::memory_order_acquire) == sound->Handle();
 			}
+
 			// check all channels
-			else 
+			return sound->Handle()->IsPlaying();
+		}
+
+		// stop all instances of a sound
+		void SfxSdlWrapper::StopSound(SoundAsset sound)
+		{
+			// stop positional sounds, including virtual ones
+			for (auto it = _emitters.begin(); it != _emitters.end();)
+			{
+				if (it->second.Sound == sound)
+				{
+					_VirtualizeEmitter(it->second);
+					it = _emitters.erase(it);
+				}
+				else {
+					++it;
+				}
+			}
+
+			// stop channels
+			static_cast<SDLChunkHandle*>(sound->Handle())->StopAll();
+		}
+
+		// create engine mixer with the same format SDL_mixer got, so sound chunks can play on it as-is
+		void SfxSdlWrapper::_CreateEngineMixer()
+		{
+			int frequency, channels;
+			Uint16 format;
+			if (!Mix_QuerySpec(&frequency, &format, &channels)) {
+				frequency = AudioSpec::frequency;
+				channels = AudioSpec::channelCount;
+			}
+			_mixer.reset(new Mixer(frequency, channels));
+
+			// apply bus settings
+			for (int i = 0; i < (int)MixerBus::_Count; ++i)
+			{
+				const BusSettings& settings = _busSettings[i];
+				_mixer->SetBusVolume((MixerBus)i, settings.Volume);
+				_mixer->SetBusLowPass((MixerBus)i, settings.LowPass);
+				_mixer->SetBusDucking((MixerBus)i, settings.DuckTrigger, settings.DuckAmount, settings.DuckAttack, settings.DuckRelease);
+			}
+
+			// open device
+			if (!_mixer->OpenDevice(std::min(AudioSpec::chunkSize, 4096)))
+			{
+				BON_ELOG_CAT(Sfx, "Failed to open engine mixer device, engine mixer disabled.");
+				_mixer.reset();
+				_engineMixerEnabled = false;
+			}
+		}
+
+		// destroy engine mixer
+		void SfxSdlWrapper::_DestroyEngineMixer()
+		{
+			if (_mixer)
+			{
+				_mixer->CloseDevice();
+				_mixer.reset();
+			}
+			_mixerSounds.clear();
+		}
+
+		// enable / disable engine mixer
+		void SfxSdlWrapper::EnableEngineMixer(bool enable)
+		{
+			_engineMixerEnabled = enable;
+			if (!_wasInit) {
+				return;
+			}
+			if (enable && !_mixer) {
+				_CreateEngineMixer();
+			}
+			else if (!enable) {
+				_DestroyEngineMixer();
+			}
+		}
+
+		// play sound on engine mixer
+		MixerVoiceId SfxSdlWrapper::PlaySoundOnBus(assets::SoundAsset sound, MixerBus bus, int volume, int loops, float pan)
+		{
+			if (!_mixer)
+			{
+				BON_WLOG_CAT(Sfx, "Can't play sound on bus: engine mixer is not enabled.");
+				return InvalidMixerVoice;
+			}
+			if (sound->IsStreamed())
+			{
+				BON_WLOG_CAT(Sfx, "Streamed sounds can't play on engine mixer.");
+				return InvalidMixerVoice;
+			}
+
+			// chunks are in SDL_mixer format. engine mixer takes signed 16 bit samples
+			Uint16 format;
+			int frequency, channels;
+			Mix_QuerySpec(&frequency, &format, &channels);
+			if (format != AUDIO_S16SYS)
+			{
+				BON_WLOG_CAT(Sfx, "Engine mixer only plays sounds when audio format is signed 16 bit (native byte order).");
+				return InvalidMixerVoice;
+			}
+
+			// play and keep sound alive while playing
+			Mix_Chunk* sdlchunk = (Mix_Chunk*)(sound->Handle()->Track);
+			MixerSource source;
+			source.Data = sdlchunk->abuf;
+			source.Channels = channels;
+			source.Frames = (int)(sdlchunk->alen / (sizeof(int16_t) * channels));
+			MixerVoiceId ret = _mixer->Play(source, bus, (float)volume / 100.0f, pan, loops);
+			if (ret != InvalidMixerVoice) {
+				_mixerSounds[ret] = sound;
+			}
+			return ret;
+		}
+
+		// stop sound on engine mixer
+		void SfxSdlWrapper::StopMixerVoice(MixerVoiceId voice)
+		{
+			if (_mixer) {
+				_mixer->Stop(voice);
+			}
+		}
+
+		// set bus volume
+		void SfxSdlWrapper::SetBusVolume(MixerBus bus, float volume)
+		{
+			_busSettings[(int)bus].Volume = volume;
+			if (_mixer) {
+				_mixer->SetBusVolume(bus, volume);
+			}
+		}
+
+		// set bus low-pass
+		void SfxSdlWrapper::SetBusLowPass(MixerBus bus, float cutoff)
+		{
+			_busSettings[(int)bus].LowPass = cutoff;
+			if (_mixer) {
+				_mixer->SetBusLowPass(bus, cutoff);
+			}
+		}
+
+		// set bus ducking
+		void SfxSdlWrapper::SetBusDucking(MixerBus bus, MixerBus trigger, float amount, float attack, float release)
+		{
+			BusSettings& settings = _busSettings[(int)bus];
+			settings.DuckTrigger = trigger;
+			settings.DuckAmount = amount;
+			settings.DuckAttack = attack;
+			settings.DuckRelease = release;
+			if (_mixer) {
+				_mixer->SetBusDucking(bus, trigger, amount, attack, release);
+			}
+		}
+
+		// virtual emitters resume only when they get a bit closer than max distance, so sounds on the edge won't keep restarting
+		const float EmitterResumeRangeFactor = 0.95f;
+
+		// check if emitter is playing on its channel
+		bool SfxSdlWrapper::_IsEmitterReal(const Emitter& emitter) const
+		{
+			return emitter.Channel >= 0 && emitter.Channel < (int)_voices.size() &&
+				_IsVoiceActive(emitter.Channel) && _voices[emitter.Channel].StartOrder == emitter.StartOrder;
+		}
+
+		// check if virtual emitter finished playing
+		bool SfxSdlWrapper::_IsEmitterExpired(const Emitter& emitter) const
+		{
+			// unknown length (streamed sound) - non looping streams end when they become virtual
+			if (emitter.Length <= 0) {
+				return emitter.Loops == 0;
+			}
+
+			// check if played all loops
+			return emitter.Loops >= 0 && emitter.Elapsed >= emitter.Length * (emitter.Loops + 1);
+		}
+
+		// free emitter's tail chunk
+		static void FreeTailChunk(void*& chunk)
+		{
+			delete (Mix_Chunk*)chunk;
+			chunk = nullptr;
+		}
+
+		// try to resume virtual emitter
+		bool SfxSdlWrapper::_ResumeEmitter(Emitter& emitter, float distance)
+		{
+			// pick voice, without counting drops - we'll just try again next frame
+			SoundChannelId channel = _PickVoice(emitter.Sound->Priority(), emitter.Sound->Group());
+			if (channel < 0) {
+				return false;
+			}
+
+			// figure out where to start from. looping sounds restart their current loop, other sounds resume from where they should be by now
+			Mix_Chunk* sdlchunk = (Mix_Chunk*)(emitter.Sound->Handle()->Track);
+			int loops = emitter.Loops;
+			if (emitter.Length > 0)
+			{
+				double played = std::floor(emitter.Elapsed / emitter.Length);
+				if (emitter.Loops != 0)
+				{
+					if (emitter.Loops > 0) { loops = emitter.Loops - (int)played; }
+					emitter.Elapsed = played * emitter.Length;
+				}
+				else
+				{
+					int frequency, channels;
+					Uint16 format;
+					Mix_QuerySpec(&frequency, &format, &channels);
+					Uint32 frameBytes = (Uint32)(SDL_AUDIO_BITSIZE(format) / 8 * channels);
+					Uint32 offset = (Uint32)(emitter.Elapsed * frequency) * frameBytes;
+					if (offset > 0 && offset < sdlchunk->alen)
+					{
+						Mix_Chunk* tail = new Mix_Chunk();
+						tail->allocated = 0;
+						tail->abuf = sdlchunk->abuf + offset;
+						tail->alen = sdlchunk->alen - offset;
+						tail->volume = sdlchunk->volume;
+						emitter.TailChunk = tail;
+						sdlchunk = tail;
+					}
+				}
+			}
+
+			// play with volume it should have, so it won't start too loud
+			int volume = (int)(emitter.Volume * _spatial.Attenuation(distance) + 0.5f);
+			channel = _StartVoice(emitter.Sound, sdlchunk, channel, volume, loops, emitter.Pitch, 0);
+			if (channel < 0)
+			{
+				FreeTailChunk(emitter.TailChunk);
+				return false;
+			}
+
+			// got a channel
+			emitter.Channel = channel;
+			emitter.StartOrder = _voices[channel].StartOrder;
+			emitter.AppliedVolume = volume;
+			emitter.AppliedPan = -1;
+			_ApplySpatial(emitter, distance);
+			return true;
+		}
+
+		// stop emitter channel and make it virtual
+		void SfxSdlWrapper::_VirtualizeEmitter(Emitter& emitter)
+		{
+			if (_IsEmitterReal(emitter)) {
+				Mix_HaltChannel(emitter.Channel);
+			}
+			emitter.Channel = -1;
+			FreeTailChunk(emitter.TailChunk);
+		}
+
+		// apply emitter volume and panning
+		void SfxSdlWrapper::_ApplySpatial(Emitter& emitter, float distance)
+		{
+			// set volume, and update voice info so voice stealing will see the actual volume
+			int volume = (int)(emitter.Volume * _spatial.Attenuation(distance) + 0.5f);
+			if (volume != emitter.AppliedVolume)
+			{
+				Mix_Volume(emitter.Channel, volume);
+				_voices[emitter.Channel].Volume = volume;
+				emitter.AppliedVolume = volume;
+			}
+
+			// set panning (pan law keeps full volume at center)
+			float pan = _spatial.Pan(emitter.Position.X - _listenerPosition.X);
+			int panRight = (int)(std::min(1.0f + pan, 1.0f) * 255.0f);
+			int panLeft = (int)(std::min(1.0f - pan, 1.0f) * 255.0f);
+			int appliedPan = (panLeft << 8) | panRight;
+			if (appliedPan != emitter.AppliedPan)
+			{
+				Mix_SetPanning(emitter.Channel, (Uint8)panLeft, (Uint8)panRight);
+				emitter.AppliedPan = appliedPan;
+			}
+		}
+
+		// update positional sounds
+		void SfxSdlWrapper::_UpdateEmitters(double deltaTime)
+		{
+			int virtualCount = 0;
+			for (auto it = _emitters.begin(); it != _emitters.end();)
+			{
+				Emitter& emitter = it->second;
+				emitter.Elapsed += deltaTime * emitter.Pitch;
+				float distance = emitter.Position.DistanceTo(_listenerPosition);
+
+				// playing on a channel
+				if (emitter.Channel >= 0)
+				{
+					// ended or voice was stolen
+					if (!_IsEmitterReal(emitter))
+					{
+						FreeTailChunk(emitter.TailChunk);
+						it = _emitters.erase(it);
+						continue;
+					}
+
+					// still in range? update volume and panning
+					if (_spatial.InRange(distance))
+					{
+						_ApplySpatial(emitter, distance);
+						++it;
+						continue;
+					}
+
+					// went out of range - make virtual
+					_VirtualizeEmitter(emitter);
+				}
+
+				// virtual: check if ended, or resume if back in range
+				if (_IsEmitterExpired(emitter))
+				{
+					it = _emitters.erase(it);
+					continue;
+				}
+				if (!_spatial.InRange(distance / EmitterResumeRangeFactor) || !_ResumeEmitter(emitter, distance)) {
+					virtualCount++;
+				}
+				++it;
+			}
+
+			// update virtual voices gauge
+			bon::_GetEngine().Diagnostics()._SetCounter((int)DiagnosticsCounters::VirtualVoices, virtualCount);
+		}
+
+		// play positional sound
+		SoundEmitterId SfxSdlWrapper::PlaySoundAt(assets::SoundAsset sound, const framework::PointF& position, int volume, int loops, float pitch)
+		{
+			// create emitter
+			Emitter emitter;
+			emitter.Sound = sound;
+			emitter.Position = position;
+			emitter.Volume = volume;
+			emitter.Loops = loops;
+			emitter.Pitch = pitch;
+
+			// get sound length, so we can track time while virtual
+			if (!sound->IsStreamed())
 			{
-				for (int i = 0; i < AudioSpec::allocatedMixChannelsCount; ++i) 
+				int frequency, channels;
+				Uint16 format;
+				if (Mix_QuerySpec(&frequency, &format, &channels))
 				{
-					if (IsPlaying(sound, i)) { return true; }
+					Mix_Chunk* sdlchunk = (Mix_Chunk*)(sound->Handle()->Track);
+					emitter.Length = (double)sdlchunk->alen / (double)(SDL_AUDIO_BITSIZE(format) / 8 * channels) / (double)frequency;
 				}
 			}
 
-			// not playing
-			return false;
+			// start playing if in range. if not, or there's no free voice, it starts as virtual
+			float distance = _listenerPosition.DistanceTo(position);
+			if (_spatial.InRange(distance)) {
+				_ResumeEmitter(emitter, distance);
+			}
+
+			// add emitter
+			SoundEmitterId id = _nextEmitterId++;
+			if (_nextEmitterId < 0) { _nextEmitterId = 0; }
+			_emitters[id] = emitter;
+			return id;
+		}
+
+		// set emitter position
+		void SfxSdlWrapper::SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position)
+		{
+			auto found = _emitters.find(emitter);
+			if (found != _emitters.end()) {
+				found->second.Position = position;
+			}
+		}
+
+		// set emitter volume
+		void SfxSdlWrapper::SetEmitterVolume(SoundEmitterId emitter, int volume)
+		{
+			auto found = _emitters.find(emitter);
+			if (found != _emitters.end()) {
+				found->second.Volume = std::max(volume, 0);
+			}
+		}
+
+		// stop emitter
+		void SfxSdlWrapper::StopEmitter(SoundEmitterId emitter)
+		{
+			auto found = _emitters.find(emitter);
+			if (found != _emitters.end())
+			{
+				_VirtualizeEmitter(found->second);
+				_emitters.erase(found);
+			}
+		}
+
+		// get if emitter is virtual
+		bool SfxSdlWrapper::IsEmitterVirtual(SoundEmitterId emitter) const
+		{
+			auto found = _emitters.find(emitter);
+			return found != _emitters.end() && found->second.Channel < 0;
+		}
+
+		// get emitter channel
+		SoundChannelId SfxSdlWrapper::GetEmitterChannel(SoundEmitterId emitter) const
+		{
+			auto found = _emitters.find(emitter);
+			return (found != _emitters.end() && found->second.Channel >= 0) ? found->second.Channel : InvalidSoundChannel;
+		}
+
+		// do per-frame updates
+		void SfxSdlWrapper::Update(double deltaTime)
+		{
+			_streams.Update();
+			_UpdateEmitters(deltaTime);
+
+			// release sounds that finished playing on engine mixer
+			if (_mixer)
+			{
+				MixerVoiceId finished[64];
+				int count;
+				while ((count = _mixer->PollFinished(finished, 64)) > 0)
+				{
+					for (int i = 0; i < count; ++i) {
+						_mixerSounds.erase(finished[i]);
+					}
+				}
+			}
 		}
 
 		// dispose sfx imp
 		void SfxSdlWrapper::Dispose()
 		{
 			Mix_HaltChannel(-1);
+			for (auto& emitter : _emitters) {
+				FreeTailChunk(emitter.second.TailChunk);
+			}
+			_emitters.clear();
+			_streams.Stop();
+			_DestroyEngineMixer();
 			Mix_HaltMusic();
 			Mix_CloseAudio();
 			Mix_Quit();
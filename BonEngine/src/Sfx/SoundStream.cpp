@@ -0,0 +1,291 @@
+#include <Sfx/SoundStream.h>
+#include <unordered_map>
+#include <mutex>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// open stream source from file
+		std::shared_ptr<StreamSource> StreamSource::FromFile(const char* path)
+		{
+			auto ret = std::make_shared<StreamSource>();
+			ret->_file.open(path, std::ios::binary | std::ios::ate);
+			if (!ret->_file.is_open()) {
+				return nullptr;
+			}
+			ret->_size = (size_t)ret->_file.tellg();
+			ret->_file.seekg(0);
+			return ret;
+		}
+
+		// create stream source from memory buffer
+		std::shared_ptr<StreamSource> StreamSource::FromMemory(std::shared_ptr<const std::vector<uint8_t>> buffer)
+		{
+			auto ret = std::make_shared<StreamSource>();
+			ret->_size = buffer->size();
+			ret->_buffer = std::move(buffer);
+			return ret;
+		}
+
+		// read bytes
+		size_t StreamSource::Read(void* out, size_t bytes)
+		{
+			bytes = std::min(bytes, _size - _position);
+			if (_buffer == nullptr) {
+				_file.read((char*)out, bytes);
+				bytes = (size_t)_file.gcount();
+			}
+			else {
+				memcpy(out, _buffer->data() + _position, bytes);
+			}
+			_position += bytes;
+			return bytes;
+		}
+
+		// seek position
+		bool StreamSource::Seek(size_t position)
+		{
+			if (position > _size) {
+				return false;
+			}
+			if (_buffer == nullptr) {
+				_file.clear();
+				if (!_file.seekg((std::streamoff)position)) {
+					return false;
+				}
+			}
+			_position = position;
+			return true;
+		}
+
+		// read little endian values
+		static inline uint16_t ReadU16(const uint8_t* data) { return (uint16_t)(data[0] | (data[1] << 8)); }
+		static inline uint32_t ReadU32(const uint8_t* data) { return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24); }
+
+		/**
+		 * Stream decoder for PCM wav files.
+		 */
+		class WavStreamDecoder : public IStreamDecoder
+		{
+		private:
+			// source and where pcm data starts / ends in it
+			std::shared_ptr<StreamSource> _source;
+			size_t _dataStart = 0;
+			size_t _dataEnd = 0;
+
+			// format
+			int _frequency = 0;
+			int _channels = 0;
+			int _bitsPerSample = 0;
+			int _blockAlign = 0;
+			bool _float = false;
+
+			// raw data read buffer
+			std::vector<uint8_t> _raw;
+
+		public:
+			// parse header. returns false if not a supported wav file
+			bool Open(std::shared_ptr<StreamSource> source)
+			{
+				_source = std::move(source);
+
+				// riff header
+				uint8_t header[12];
+				if (_source->Read(header, 12) != 12 || memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+					return false;
+				}
+
+				// iterate chunks until we find data chunk
+				bool gotFormat = false;
+				uint8_t chunkHeader[8];
+				while (_source->Read(chunkHeader, 8) == 8)
+				{
+					uint32_t chunkSize = ReadU32(chunkHeader + 4);
+					size_t chunkStart = _source->Tell();
+
+					// format chunk
+					if (memcmp(chunkHeader, "fmt ", 4) == 0)
+					{
+						uint8_t fmt[40] = { 0 };
+						size_t toRead = std::min((size_t)chunkSize, sizeof(fmt));
+						if (toRead < 16 || _source->Read(fmt, toRead) != toRead) {
+							return false;
+						}
+						uint16_t formatTag = ReadU16(fmt);
+						_channels = ReadU16(fmt + 2);
+						_frequency = (int)ReadU32(fmt + 4);
+						_blockAlign = ReadU16(fmt + 12);
+						_bitsPerSample = ReadU16(fmt + 14);
+
+						// extensible format keeps the actual format tag in its sub format guid
+						if (formatTag == 0xFFFE && toRead >= 26) {
+							formatTag = ReadU16(fmt + 24);
+						}
+						_float = (formatTag == 3);
+						if ((formatTag != 1 && formatTag != 3) || (_float && _bitsPerSample != 32)) {
+							return false;
+						}
+						if (_bitsPerSample != 8 && _bitsPerSample != 16 && _bitsPerSample != 24 && _bitsPerSample != 32) {
+							return false;
+						}
+						if (_channels <= 0 || _frequency <= 0 || _blockAlign != _channels * (_bitsPerSample / 8)) {
+							return false;
+						}
+						gotFormat = true;
+					}
+					// data chunk
+					else if (memcmp(chunkHeader, "data", 4) == 0)
+					{
+						if (!gotFormat) {
+							return false;
+						}
+						_dataStart = chunkStart;
+						_dataEnd = std::min(chunkStart + chunkSize, _source->Size());
+						_dataEnd -= (_dataEnd - _dataStart) % _blockAlign;
+						return true;
+					}
+
+					// skip to next chunk (chunks are padded to even size)
+					if (!_source->Seek(chunkStart + chunkSize + (chunkSize & 1))) {
+						return false;
+					}
+				}
+				return false;
+			}
+
+			// get frequency
+			virtual int Frequency() const override { return _frequency; }
+
+			// get channels count
+			virtual int Channels() const override { return _channels; }
+
+			// get total frames
+			virtual long long TotalFrames() const override { return (long long)((_dataEnd - _dataStart) / _blockAlign); }
+
+			// rewind to data start
+			virtual bool Rewind() override { return _source->Seek(_dataStart); }
+
+			// decode frames
+			virtual int Read(int16_t* out, int frames) override
+			{
+				size_t position = _source->Tell();
+				size_t available = position < _dataEnd ? (_dataEnd - position) / _blockAlign : 0;
+				size_t toRead = std::min((size_t)std::max(frames, 0), available);
+				_raw.resize(toRead * _blockAlign);
+				toRead = _source->Read(_raw.data(), _raw.size()) / _blockAlign;
+
+				// convert to signed 16 bit
+				size_t samples = toRead * _channels;
+				const uint8_t* src = _raw.data();
+				switch (_bitsPerSample)
+				{
+				case 8:
+					for (size_t i = 0; i < samples; ++i) { out[i] = (int16_t)(((int)src[i] - 128) * 256); }
+					break;
+
+				case 16:
+					for (size_t i = 0; i < samples; ++i) { out[i] = (int16_t)ReadU16(src + i * 2); }
+					break;
+
+				case 24:
+					for (size_t i = 0; i < samples; ++i) { out[i] = (int16_t)ReadU16(src + i * 3 + 1); }
+					break;
+
+				case 32:
+					if (_float)
+					{
+						for (size_t i = 0; i < samples; ++i)
+						{
+							uint32_t bits = ReadU32(src + i * 4);
+							float value;
+							memcpy(&value, &bits, sizeof(value));
+							value = std::max(-1.0f, std::min(1.0f, value));
+							out[i] = (int16_t)(value * 32767.0f);
+						}
+					}
+					else
+					{
+						for (size_t i = 0; i < samples; ++i) { out[i] = (int16_t)ReadU16(src + i * 4 + 2); }
+					}
+					break;
+				}
+				return (int)toRead;
+			}
+		};
+
+		// create wav decoder
+		static std::unique_ptr<IStreamDecoder> CreateWavDecoder(std::shared_ptr<StreamSource> source)
+		{
+			std::unique_ptr<WavStreamDecoder> ret(new WavStreamDecoder());
+			if (!ret->Open(source)) {
+				return nullptr;
+			}
+			return ret;
+		}
+
+		// registered decoders, with built-in wav decoder
+		static std::mutex _decodersMutex;
+		static std::unordered_map<std::string, StreamDecoderFactory>& Decoders()
+		{
+			static std::unordered_map<std::string, StreamDecoderFactory> decoders = { { "wav", CreateWavDecoder } };
+			return decoders;
+		}
+
+		// get lowercase extension
+		static std::string ToLower(const char* str)
+		{
+			std::string ret(str ? str : "");
+			std::transform(ret.begin(), ret.end(), ret.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+			return ret;
+		}
+
+		// register decoder
+		void SoundStreams::RegisterDecoder(const char* extension, StreamDecoderFactory factory)
+		{
+			std::lock_guard<std::mutex> lock(_decodersMutex);
+			Decoders()[ToLower(extension)] = factory;
+		}
+
+		// check if got decoder
+		bool SoundStreams::HasDecoder(const char* extension)
+		{
+			std::lock_guard<std::mutex> lock(_decodersMutex);
+			return Decoders().find(ToLower(extension)) != Decoders().end();
+		}
+
+		// create decoder
+		std::unique_ptr<IStreamDecoder> SoundStreams::CreateDecoder(const char* extension, std::shared_ptr<StreamSource> source)
+		{
+			StreamDecoderFactory factory = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(_decodersMutex);
+				auto found = Decoders().find(ToLower(extension));
+				if (found == Decoders().end()) {
+					return nullptr;
+				}
+				factory = found->second;
+			}
+			if (source == nullptr) {
+				return nullptr;
+			}
+			return factory(std::move(source));
+		}
+
+		// get extension from path
+		std::string SoundStreams::GetExtension(const char* path)
+		{
+			std::string pathStr(path ? path : "");
+			size_t dot = pathStr.find_last_of('.');
+			size_t slash = pathStr.find_last_of("/\\");
+			if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+				return std::string();
+			}
+			return ToLower(pathStr.c_str() + dot + 1);
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#include <Sfx/Spatial.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// get volume factor by distance
+		float SpatialSettings::Attenuation(float distance) const
+		{
+			// full volume while inside min distance
+			float minDistance = std::max(MinDistance, 0.0001f);
+			float maxDistance = std::max(MaxDistance, minDistance);
+			if (distance <= minDistance) {
+				return 1.0f;
+			}
+			distance = std::min(distance, maxDistance);
+
+			// calculate by curve
+			float ret;
+			switch (Curve)
+			{
+			case AttenuationCurve::Linear:
+				ret = (maxDistance > minDistance) ? 1.0f - Rolloff * (distance - minDistance) / (maxDistance - minDistance) : 1.0f;
+				break;
+
+			case AttenuationCurve::Exponential:
+				ret = std::pow(distance / minDistance, -Rolloff);
+				break;
+
+			case AttenuationCurve::Inverse:
+			default:
+				ret = minDistance / (minDistance + Rolloff * (distance - minDistance));
+				break;
+			}
+			return std::max(0.0f, std::min(ret, 1.0f));
+		}
+
+		// get panning by horizontal offset
+		float SpatialSettings::Pan(float offsetX) const
+		{
+			if (PanDistance <= 0.0f) {
+				return 0.0f;
+			}
+			return std::max(-1.0f, std::min(offsetX / PanDistance, 1.0f));
+		}
+	}
+}
@@ -0,0 +1,320 @@
+#include <Sfx/StreamPlayer.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <cstring>
+#include <chrono>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#include <SDL2_mixer-2.0.4/include/SDL_mixer.h>
+#pragma warning(pop)
+
+
+namespace bon
+{
+	namespace sfx
+	{
+		// how many audio chunks each stream ring buffer holds
+		const int RingChunks = 4;
+
+		// how long worker thread sleeps when there's nothing to decode, in milliseconds
+		const int WorkerIdleWaitMs = 5;
+
+		/**
+		 * A single playing stream.
+		 * Ring buffer is single producer (worker thread) single consumer (audio thread). Positions only grow, and wrap by ring size.
+		 */
+		class _StreamVoice
+		{
+		public:
+			// owner and channel we play on
+			StreamPlayer* Owner = nullptr;
+			int Channel = -1;
+
+			// decoder, converter to device format and loops left (-1 = endless)
+			std::unique_ptr<IStreamDecoder> Decoder;
+			SDL_AudioStream* Converter = nullptr;
+			int Loops = 0;
+			bool DecoderDone = false;
+
+			// ring buffer with audio in device format
+			std::vector<uint8_t> Ring;
+			std::atomic<size_t> ReadPos{ 0 };
+			std::atomic<size_t> WritePos{ 0 };
+			int FrameBytes = 0;
+			uint8_t Silence = 0;
+
+			// decode and convert buffers, used by worker thread
+			std::vector<int16_t> DecodeBuffer;
+			std::vector<uint8_t> ConvertBuffer;
+
+			// state flags
+			std::atomic<bool> SourceEnded{ false };
+			std::atomic<bool> Finished{ false };
+			std::atomic<bool> Released{ false };
+
+			// free converter
+			~_StreamVoice()
+			{
+				if (Converter) {
+					SDL_FreeAudioStream(Converter);
+				}
+			}
+
+			// get resident memory, in bytes
+			size_t ResidentBytes() const
+			{
+				return Ring.size() + DecodeBuffer.size() * sizeof(int16_t) + ConvertBuffer.size();
+			}
+
+			// push data to ring (producer side)
+			void Push(const uint8_t* data, size_t size)
+			{
+				size_t write = WritePos.load(std::memory_order_relaxed);
+				size_t offset = write % Ring.size();
+				size_t first = std::min(size, Ring.size() - offset);
+				memcpy(Ring.data() + offset, data, first);
+				memcpy(Ring.data(), data + first, size - first);
+				WritePos.store(write + size, std::memory_order_release);
+			}
+
+			// pop data from ring (consumer side). returns how many bytes were read
+			size_t Pop(uint8_t* out, size_t size)
+			{
+				size_t read = ReadPos.load(std::memory_order_relaxed);
+				size_t available = WritePos.load(std::memory_order_acquire) - read;
+				size = std::min(size, available);
+				size_t offset = read % Ring.size();
+				size_t first = std::min(size, Ring.size() - offset);
+				memcpy(out, Ring.data() + offset, first);
+				memcpy(out + first, Ring.data(), size - first);
+				ReadPos.store(read + size, std::memory_order_release);
+				return size;
+			}
+		};
+
+		// start worker thread
+		void StreamPlayer::Start(int chunkFrames)
+		{
+			_chunkFrames = std::max(chunkFrames, 256);
+			if (!_running)
+			{
+				_running = true;
+				_thread = std::thread(&StreamPlayer::_WorkerLoop, this);
+			}
+		}
+
+		// stop worker thread and release streams
+		void StreamPlayer::Stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (!_running) { return; }
+				_running = false;
+			}
+			_wake.notify_all();
+			_thread.join();
+			_voices.clear();
+		}
+
+		// start streaming into channel
+		bool StreamPlayer::Play(int channel, std::unique_ptr<IStreamDecoder> decoder, int loops)
+		{
+			// get device format
+			int frequency, channels;
+			Uint16 format;
+			if (decoder == nullptr || !Mix_QuerySpec(&frequency, &format, &channels)) {
+				return false;
+			}
+
+			// create stream and converter from decoder format to device format
+			auto voice = std::make_shared<_StreamVoice>();
+			voice->Owner = this;
+			voice->Channel = channel;
+			voice->Loops = loops;
+			voice->Converter = SDL_NewAudioStream(AUDIO_S16SYS, (Uint8)decoder->Channels(), decoder->Frequency(), format, (Uint8)channels, frequency);
+			if (voice->Converter == nullptr)
+			{
+				BON_ELOG_CAT(Sfx, "Failed to create stream converter! SDL Error: %s", SDL_GetError());
+				return false;
+			}
+			voice->FrameBytes = SDL_AUDIO_BITSIZE(format) / 8 * channels;
+			voice->Silence = SDL_AUDIO_ISSIGNED(format) ? 0 : 0x80;
+			voice->Ring.resize((size_t)_chunkFrames * RingChunks * voice->FrameBytes);
+			voice->DecodeBuffer.resize((size_t)_chunkFrames * decoder->Channels());
+			voice->ConvertBuffer.resize((size_t)_chunkFrames * voice->FrameBytes);
+			voice->Decoder = std::move(decoder);
+
+			// fill ring before registering effect, so first callback will have data
+			_Fill(*voice);
+
+			// register effect that feeds channel from ring.
+			// must be registered before other effects (panning, distance), so they'll process stream audio.
+			if (!Mix_RegisterEffect(channel, _StreamEffect, _StreamEffectDone, voice.get()))
+			{
+				BON_ELOG_CAT(Sfx, "Failed to register stream effect! SDL_mixer Error: %s", Mix_GetError());
+				return false;
+			}
+
+			// add to streams list
+			std::lock_guard<std::mutex> lock(_mutex);
+			_voices.push_back(voice);
+			return true;
+		}
+
+		// decode into ring until full
+		void StreamPlayer::_Fill(_StreamVoice& voice)
+		{
+			bool justRewound = false;
+			int decoderChannels = voice.Decoder->Channels();
+			while (!voice.Released.load(std::memory_order_relaxed))
+			{
+				// check how much room we have in ring, in whole frames
+				size_t used = voice.WritePos.load(std::memory_order_relaxed) - voice.ReadPos.load(std::memory_order_acquire);
+				size_t room = voice.Ring.size() - used;
+				room -= room % voice.FrameBytes;
+				if (room == 0) {
+					return;
+				}
+
+				// got converted data? move to ring
+				int available = SDL_AudioStreamAvailable(voice.Converter);
+				if (available > 0)
+				{
+					int toGet = (int)std::min({ room, (size_t)available, voice.ConvertBuffer.size() });
+					int got = SDL_AudioStreamGet(voice.Converter, voice.ConvertBuffer.data(), toGet);
+					if (got <= 0) {
+						return;
+					}
+					voice.Push(voice.ConvertBuffer.data(), (size_t)got);
+					_decodedBytes.fetch_add((uint64_t)got, std::memory_order_relaxed);
+					continue;
+				}
+
+				// no more data to convert and decoder is done - source ended
+				if (voice.DecoderDone)
+				{
+					voice.SourceEnded.store(true, std::memory_order_release);
+					return;
+				}
+
+				// decode next block
+				int blockFrames = (int)(voice.DecodeBuffer.size() / decoderChannels);
+				int frames = voice.Decoder->Read(voice.DecodeBuffer.data(), blockFrames);
+				if (frames > 0)
+				{
+					SDL_AudioStreamPut(voice.Converter, voice.DecodeBuffer.data(), frames * decoderChannels * (int)sizeof(int16_t));
+					justRewound = false;
+				}
+
+				// reached source end: rewind to loop, or flush converter to get its remaining audio.
+				// rewinding feeds the same converter, so there's no gap or click between loops.
+				if (frames < blockFrames)
+				{
+					if (voice.Loops != 0 && !justRewound && voice.Decoder->Rewind())
+					{
+						if (voice.Loops > 0) { voice.Loops--; }
+						justRewound = true;
+					}
+					else
+					{
+						SDL_AudioStreamFlush(voice.Converter);
+						voice.DecoderDone = true;
+					}
+				}
+			}
+		}
+
+		// worker thread loop
+		void StreamPlayer::_WorkerLoop()
+		{
+			std::vector<std::shared_ptr<_StreamVoice>> voices;
+			std::unique_lock<std::mutex> lock(_mutex);
+			while (_running)
+			{
+				// fill streams without holding the lock
+				voices = _voices;
+				lock.unlock();
+				for (auto& voice : voices)
+				{
+					if (!voice->Released.load(std::memory_order_acquire) && !voice->SourceEnded.load(std::memory_order_acquire)) {
+						_Fill(*voice);
+					}
+				}
+				voices.clear();
+				lock.lock();
+
+				// wait until audio thread consumes data or timeout
+				if (_running) {
+					_wake.wait_for(lock, std::chrono::milliseconds(WorkerIdleWaitMs));
+				}
+			}
+		}
+
+		// feed channel from ring (audio thread)
+		void StreamPlayer::_StreamEffect(int channel, void* stream, int len, void* userData)
+		{
+			_StreamVoice* voice = (_StreamVoice*)userData;
+
+			// check if source ended before reading, so we won't miss data pushed right before it ended
+			bool sourceEnded = voice->SourceEnded.load(std::memory_order_acquire);
+			size_t got = voice->Pop((uint8_t*)stream, (size_t)len);
+
+			// not enough data - fill with silence. either stream ended, or worker didn't keep up
+			if (got < (size_t)len)
+			{
+				memset((uint8_t*)stream + got, voice->Silence, (size_t)len - got);
+				if (sourceEnded) {
+					voice->Finished.store(true, std::memory_order_release);
+				}
+				else {
+					voice->Owner->_underruns.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+
+			// wake worker to refill
+			voice->Owner->_wake.notify_one();
+		}
+
+		// channel stopped playing (audio thread or main thread, while audio is locked)
+		void StreamPlayer::_StreamEffectDone(int channel, void* userData)
+		{
+			_StreamVoice* voice = (_StreamVoice*)userData;
+			voice->Released.store(true, std::memory_order_release);
+		}
+
+		// halt finished streams and release stopped streams
+		void StreamPlayer::Update()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (auto& voice : _voices)
+			{
+				if (voice->Finished.load(std::memory_order_acquire) && !voice->Released.load(std::memory_order_acquire)) {
+					Mix_HaltChannel(voice->Channel);
+				}
+			}
+			_voices.erase(std::remove_if(_voices.begin(), _voices.end(), [](const std::shared_ptr<_StreamVoice>& voice) {
+				return voice->Released.load(std::memory_order_acquire);
+			}), _voices.end());
+		}
+
+		// get streaming stats
+		StreamingStats StreamPlayer::GetStats()
+		{
+			StreamingStats ret;
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (auto& voice : _voices)
+			{
+				if (!voice->Released.load(std::memory_order_acquire))
+				{
+					ret.ActiveStreams++;
+					ret.ResidentBytes += voice->ResidentBytes();
+				}
+			}
+			ret.DecodedBytes = _decodedBytes.load(std::memory_order_relaxed);
+			ret.Underruns = _underruns.load(std::memory_order_relaxed);
+			return ret;
+		}
+	}
+}
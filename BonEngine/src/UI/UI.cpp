@@ -72,6 +72,8 @@ namespace bon
 		// draw a UI system or element.
 		void UI::Draw(UIElement root, bool drawCursor)
 		{
+			BON_PROFILE_SCOPE("UI::Draw");
+
 			// draw UI
 			root->Draw(false);
 			root->Draw(true);
@@ -85,6 +87,8 @@ namespace bon
 		// update UI system and do input interactions
 		void UI::UpdateUI(UIElement root, UIElement* activeElement)
 		{
+			BON_PROFILE_SCOPE("UI::UpdateUI");
+
 			// first call updates
 			double dt = bon::_GetEngine().Game().DeltaTime();
 			root->Update(dt);
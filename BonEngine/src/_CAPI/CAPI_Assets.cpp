@@ -230,6 +230,30 @@ bool BON_Sound_IsPlaying(bon::SoundAsset* sound)
 	return (*sound)->IsPlaying();
 }
 
+// Get how many instances of a sound are currently playing.
+int BON_Sound_PlayingInstances(bon::SoundAsset* sound)
+{
+	return (*sound)->PlayingInstances();
+}
+
+// Set sound priority.
+void BON_Sound_SetPriority(bon::SoundAsset* sound, int priority)
+{
+	(*sound)->SetPriority(priority);
+}
+
+// Set sound group.
+void BON_Sound_SetGroup(bon::SoundAsset* sound, int group)
+{
+	(*sound)->SetGroup(group);
+}
+
+// Get fully decoded sound size.
+int64_t BON_Sound_DecodedSize(bon::SoundAsset* sound)
+{
+	return (int64_t)(*sound)->DecodedSize();
+}
+
 /**
 * Get font asset native size.
 */
@@ -38,6 +38,22 @@ bon::SoundAsset* BON_Assets_LoadSound(const char* filename, bool useCache)
 	return_asset_ptr(bon::SoundAsset,bon::_GetEngine().Assets().LoadSound(filename, useCache));
 }
 
+/**
+* Load and return a streamed sound asset.
+*/
+bon::SoundAsset* BON_Assets_LoadSoundStream(const char* filename, bool useCache)
+{
+	return_asset_ptr(bon::SoundAsset, bon::_GetEngine().Assets().LoadSoundStream(filename, useCache));
+}
+
+/**
+* Create a streamed sound asset from encoded data in memory.
+*/
+bon::SoundAsset* BON_Assets_CreateSoundStream(const void* data, int size, const char* format)
+{
+	return_asset_ptr(bon::SoundAsset, bon::_GetEngine().Assets().CreateSoundStream(data, (size_t)size, format));
+}
+
 /**
 * Load and return a font asset.
 */
@@ -78,6 +94,14 @@ bool BON_Assets_SaveConfig(bon::ConfigAsset* config, const char* filename)
 	return bon::_GetEngine().Assets().SaveConfig(*config, filename);
 }
 
+/**
+* Compile config into binary config file.
+*/
+bool BON_Assets_CompileConfig(bon::ConfigAsset* config, const char* filename)
+{
+	return bon::_GetEngine().Assets().CompileConfig(*config, filename);
+}
+
 /**
 * Clear all assets from cache.
 */
@@ -86,6 +110,30 @@ void BON_Assets_ClearCache()
 	bon::_GetEngine().Assets().ClearCache();
 }
 
+/**
+* Set memory budget for cached assets.
+*/
+void BON_Assets_SetMemoryBudget(int64_t bytes)
+{
+	bon::_GetEngine().Assets().SetMemoryBudget(bytes > 0 ? (size_t)bytes : 0);
+}
+
+/**
+* Get estimated memory currently held by the assets cache.
+*/
+int64_t BON_Assets_CachedMemorySize()
+{
+	return (int64_t)bon::_GetEngine().Assets().CachedMemorySize();
+}
+
+/**
+* Enable / disable hot reload.
+*/
+void BON_Assets_EnableHotReload(bool enable)
+{
+	bon::_GetEngine().Assets().EnableHotReload(enable);
+}
+
 /**
 * Delete an asset pointer.
 */
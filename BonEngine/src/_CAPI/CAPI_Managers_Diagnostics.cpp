@@ -1,5 +1,6 @@
 #include <_CAPI/CAPI_Managers_Diagnostics.h>
 #include <BonEngine.h>
+#include <cstring>
 
 // Get counter value.
 int64_t BON_Diagnostics_GetCounter(int id)
@@ -19,8 +20,148 @@ void BON_Diagnostics_ResetCounter(int id)
 	bon::_GetEngine().Diagnostics()._ResetCounter(id);
 }
 
+// Set counter value.
+void BON_Diagnostics_SetCounter(int id, int64_t value)
+{
+	bon::_GetEngine().Diagnostics()._SetCounter(id, (long)value);
+}
+
+// Get per-frame counter value from last frame.
+int64_t BON_Diagnostics_GetCounterLastFrame(int id)
+{
+	return bon::_GetEngine().Diagnostics()._GetCounterLastFrame(id);
+}
+
+// Register a named counter.
+int BON_Diagnostics_RegisterCounter(const char* name, BON_CounterTypes type)
+{
+	return bon::_GetEngine().Diagnostics().RegisterCounter(name, (bon::CounterTypes)type);
+}
+
+// Get registered counter id.
+int BON_Diagnostics_GetCounterId(const char* name)
+{
+	return bon::_GetEngine().Diagnostics().GetCounterId(name);
+}
+
+// Draw top counters on screen.
+void BON_Diagnostics_DrawCountersOverlay(const bon::assets::FontAsset* font, int topN, float x, float y, int fontSize)
+{
+	bon::_GetEngine().Diagnostics().DrawCountersOverlay(*font, topN, bon::PointF(x, y), fontSize);
+}
+
 // get fps counter.
 void BON_Diagnostics_FpsCounter()
 {
 	bon::_GetEngine().Diagnostics().FpsCount();
+}
+
+// get assets residency stats by type (empty stats for invalid type).
+static bon::AssetsResidencyStats GetAssetsResidency(int assetType)
+{
+	bool validType = assetType >= 0 && assetType < (int)bon::AssetTypes::_Count;
+	return validType ? bon::_GetEngine().Diagnostics().GetAssetsResidency((bon::AssetTypes)assetType) : bon::AssetsResidencyStats();
+}
+
+// get loaded assets memory by type.
+int64_t BON_Diagnostics_GetAssetsLoadedBytes(int assetType)
+{
+	return GetAssetsResidency(assetType).LoadedBytes;
+}
+
+// get cached assets memory by type.
+int64_t BON_Diagnostics_GetAssetsCachedBytes(int assetType)
+{
+	return GetAssetsResidency(assetType).CachedBytes;
+}
+
+// get evictions count by type.
+long BON_Diagnostics_GetAssetsEvictions(int assetType)
+{
+	return GetAssetsResidency(assetType).Evictions;
+}
+
+// start recording profiled scopes.
+void BON_Diagnostics_StartProfiler()
+{
+	bon::_GetEngine().Diagnostics().StartProfiler();
+}
+
+// stop recording profiled scopes.
+void BON_Diagnostics_StopProfiler()
+{
+	bon::_GetEngine().Diagnostics().StopProfiler();
+}
+
+// export recorded profiled scopes.
+bool BON_Diagnostics_ExportProfiler(const char* filename)
+{
+	return bon::_GetEngine().Diagnostics().ExportProfiler(filename);
+}
+
+// enable or disable allocations tracking.
+void BON_Diagnostics_EnableAllocationTracker(bool enable)
+{
+	bon::_GetEngine().Diagnostics().EnableAllocationTracker(enable);
+}
+
+// get last frame allocations.
+int64_t BON_Diagnostics_GetFrameAllocations()
+{
+	return (int64_t)bon::_GetEngine().Diagnostics().GetFrameAllocations().Allocations;
+}
+
+// get last frame allocated bytes.
+int64_t BON_Diagnostics_GetFrameAllocatedBytes()
+{
+	return (int64_t)bon::_GetEngine().Diagnostics().GetFrameAllocations().Bytes;
+}
+
+// write allocations per tag to csv.
+bool BON_Diagnostics_DumpAllocationTags(const char* filename)
+{
+	return bon::_GetEngine().Diagnostics().DumpAllocationTags(filename);
+}
+
+// get frame time stats (empty stats for invalid phase).
+BON_FrameTimeStats BON_Diagnostics_GetFrameStats(int phase)
+{
+	static_assert(sizeof(BON_FrameTimeStats::Histogram) == sizeof(bon::FrameTimeStats::Histogram), "Frame stats histogram size mismatch.");
+	bool validPhase = phase >= 0 && phase < (int)bon::FramePhases::_Count;
+	bon::FrameTimeStats stats = validPhase ? bon::_GetEngine().Diagnostics().GetFrameStats((bon::FramePhases)phase) : bon::FrameTimeStats();
+	BON_FrameTimeStats ret;
+	ret.FramesCount = stats.FramesCount;
+	ret.Min = stats.Min;
+	ret.Max = stats.Max;
+	ret.Mean = stats.Mean;
+	ret.P50 = stats.P50;
+	ret.P95 = stats.P95;
+	ret.P99 = stats.P99;
+	ret.FramesOverBudget = stats.FramesOverBudget;
+	memcpy(ret.Histogram, stats.Histogram, sizeof(ret.Histogram));
+	return ret;
+}
+
+// set frame stats window.
+void BON_Diagnostics_SetFrameStatsWindow(int frames)
+{
+	bon::_GetEngine().Diagnostics().SetFrameStatsWindow(frames);
+}
+
+// set frame budget.
+void BON_Diagnostics_SetFrameBudget(double milliseconds)
+{
+	bon::_GetEngine().Diagnostics().SetFrameBudget(milliseconds);
+}
+
+// write frame stats to csv.
+bool BON_Diagnostics_DumpFrameStatsCsv(const char* filename)
+{
+	return bon::_GetEngine().Diagnostics().DumpFrameStatsCsv(filename);
+}
+
+// set csv file to write frame stats to on exit.
+void BON_Diagnostics_SetFrameStatsCsvOnExit(const char* filename)
+{
+	bon::_GetEngine().Diagnostics().SetFrameStatsCsvOnExit(filename);
 }
\ No newline at end of file
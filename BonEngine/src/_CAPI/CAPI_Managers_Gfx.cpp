@@ -208,4 +208,12 @@ void BON_Gfx_GetTextBoundingBox(const bon::assets::FontAsset* font, const char*
 	*outY = ret.Y;
 	*outWidth = ret.Width;
 	*outHeight = ret.Height;
+}
+
+/**
+ * Enable or disable GPU timer queries.
+ */
+bool BON_Gfx_EnableGpuTimers(bool enable)
+{
+	return bon::_GetEngine().Gfx().EnableGpuTimers(enable);
 }
\ No newline at end of file
@@ -26,6 +26,110 @@ bool BON_Input_PressedNow(const char* actionId)
 	return bon::_GetEngine().Input().PressedNow(actionId);
 }
 
+/**
+* Get action id from action name.
+*/
+int BON_Input_GetActionId(const char* actionId)
+{
+	return bon::_GetEngine().Input().GetActionId(actionId);
+}
+
+/**
+* Get if a given game action is down, by action id.
+*/
+bool BON_Input_DownId(int actionId)
+{
+	return bon::_GetEngine().Input().Down((bon::ActionId)actionId);
+}
+
+/**
+* Get if a given game action was released this frame, by action id.
+*/
+bool BON_Input_ReleasedNowId(int actionId)
+{
+	return bon::_GetEngine().Input().ReleasedNow((bon::ActionId)actionId);
+}
+
+/**
+* Get if a given game action was pressed this frame, by action id.
+*/
+bool BON_Input_PressedNowId(int actionId)
+{
+	return bon::_GetEngine().Input().PressedNow((bon::ActionId)actionId);
+}
+
+/**
+* Start recording input into a file.
+*/
+void BON_Input_StartRecording(const char* filename)
+{
+	bon::_GetEngine().Input().StartRecording(filename);
+}
+
+/**
+* Stop recording input.
+*/
+void BON_Input_StopRecording()
+{
+	bon::_GetEngine().Input().StopRecording();
+}
+
+/**
+* Start replaying recorded input.
+*/
+void BON_Input_StartReplay(const char* filename, bool exitWhenDone)
+{
+	bon::_GetEngine().Input().StartReplay(filename, exitWhenDone);
+}
+
+/**
+* Stop replaying recorded input.
+*/
+void BON_Input_StopReplay()
+{
+	bon::_GetEngine().Input().StopReplay();
+}
+
+/**
+* Get if a gamepad is connected for a given player.
+*/
+bool BON_Input_GamepadConnected(int player)
+{
+	return bon::_GetEngine().Input().GamepadConnected(player);
+}
+
+/**
+* Get if a gamepad button is down for a given player.
+*/
+bool BON_Input_GamepadDown(int player, BON_KeyCodes button)
+{
+	return bon::_GetEngine().Input().GamepadDown(player, (bon::KeyCodes)button);
+}
+
+/**
+* Get gamepad axis value for a given player.
+*/
+float BON_Input_GamepadAxis(int player, int axis)
+{
+	return bon::_GetEngine().Input().GamepadAxis(player, (bon::GamepadAxes)axis);
+}
+
+/**
+* Set gamepad dead zones.
+*/
+void BON_Input_SetGamepadDeadZones(float sticks, float triggers)
+{
+	bon::_GetEngine().Input().SetGamepadDeadZones(sticks, triggers);
+}
+
+/**
+* Rumble a player's gamepad.
+*/
+bool BON_Input_GamepadRumble(int player, float lowFrequency, float highFrequency, unsigned int durationMs)
+{
+	return bon::_GetEngine().Input().GamepadRumble(player, lowFrequency, highFrequency, durationMs);
+}
+
 /**
 * Get if a key code is down.
 */
@@ -22,11 +22,53 @@ void BON_Log_SetLevel(BON_LogLevel level)
 // Write log.
 void BON_Log_Write(BON_LogLevel level, const char* msg)
 {
-	bon::_GetEngine().Log().Write((bon::LogLevel)level, msg);
+	bon::_GetEngine().Log().Write((bon::LogLevel)level, "%s", msg);
 }
 
 // flush log.
 void BON_Log_Flush()
 {
 	bon::_GetEngine().Log().Flush();
+}
+
+// enable or disable async logging.
+void BON_Log_SetAsync(bool async, BON_LogOverflowPolicy overflowPolicy, int capacity)
+{
+	bon::_GetEngine().Log().SetAsync(async, (bon::LogOverflowPolicy)overflowPolicy, capacity);
+}
+
+// get if async logging is enabled.
+bool BON_Log_IsAsync()
+{
+	return bon::_GetEngine().Log().IsAsync();
+}
+
+// set log file write buffer size.
+void BON_Log_SetFileBufferSize(int bufferSize)
+{
+	bon::_GetEngine().Log().SetFileBufferSize(bufferSize);
+}
+
+// set interval between forced log file flushes.
+void BON_Log_SetFlushInterval(double seconds)
+{
+	bon::_GetEngine().Log().SetFlushInterval(seconds);
+}
+
+// set log file rotation by size.
+void BON_Log_SetFileRotation(long long maxFileSize, int maxBackups)
+{
+	bon::_GetEngine().Log().SetFileRotation(maxFileSize, maxBackups);
+}
+
+// set log level of a category.
+void BON_Log_SetCategoryLevel(BON_LogCategory category, BON_LogLevel level)
+{
+	bon::_GetEngine().Log().SetCategoryLevel((bon::LogCategory)category, (bon::LogLevel)level);
+}
+
+// get log level of a category.
+BON_LogLevel BON_Log_GetCategoryLevel(BON_LogCategory category)
+{
+	return (BON_LogLevel)bon::_GetEngine().Log().GetCategoryLevel((bon::LogCategory)category);
 }
\ No newline at end of file
@@ -41,6 +41,14 @@ void BON_Sfx_StopMusic()
 	bon::_GetEngine().Sfx().StopMusic();
 }
 
+/**
+* Get current music position, in seconds.
+*/
+float BON_Sfx_GetMusicPosition()
+{
+	return bon::_GetEngine().Sfx().GetMusicPosition();
+}
+
 /**
 * Play a sound effect.
 */
@@ -105,10 +113,215 @@ void BON_Sfx_StopChannel(int channel)
 	return bon::_GetEngine().Sfx().StopChannel(channel);
 }
 
+/**
+* Stop all playing instances of a sound.
+*/
+void BON_Sfx_StopSound(bon::assets::SoundAsset* sound)
+{
+	bon::_GetEngine().Sfx().StopSound(*sound);
+}
+
 /**
 * Set the master volume of music and sound effects.
 */
 void BON_Sfx_SetMasterVolume(int soundEffectsVolume, int musicVolume)
 {
 	return bon::_GetEngine().Sfx().SetMasterVolume(soundEffectsVolume, musicVolume);
+}
+
+/**
+* Set resampling quality of sounds played with pitch.
+*/
+void BON_Sfx_SetPitchQuality(BON_ResamplerQuality quality)
+{
+	return bon::_GetEngine().Sfx().SetPitchQuality((bon::ResamplerQuality)quality);
+}
+
+/**
+* Set how many voices to allocate.
+*/
+void BON_Sfx_SetVoicesCount(int count)
+{
+	bon::_GetEngine().Sfx().SetVoicesCount(count);
+}
+
+/**
+* Get how many voices are allocated.
+*/
+int BON_Sfx_GetVoicesCount()
+{
+	return bon::_GetEngine().Sfx().GetVoicesCount();
+}
+
+/**
+* Set what to do when playing a sound while all voices are busy.
+*/
+void BON_Sfx_SetVoiceStealingPolicy(BON_VoiceStealingPolicy policy)
+{
+	bon::_GetEngine().Sfx().SetVoiceStealingPolicy((bon::VoiceStealingPolicy)policy);
+}
+
+/**
+* Limit how many sounds of a given sound group can play at the same time.
+*/
+void BON_Sfx_SetSoundGroupLimit(int group, int maxVoices)
+{
+	bon::_GetEngine().Sfx().SetSoundGroupLimit(group, maxVoices);
+}
+
+/**
+* Get streaming stats.
+*/
+BON_StreamingStats BON_Sfx_GetStreamingStats()
+{
+	bon::StreamingStats stats = bon::_GetEngine().Sfx().GetStreamingStats();
+	BON_StreamingStats ret;
+	ret.ActiveStreams = stats.ActiveStreams;
+	ret.DecodedBytes = (int64_t)stats.DecodedBytes;
+	ret.ResidentBytes = (int64_t)stats.ResidentBytes;
+	ret.Underruns = (int64_t)stats.Underruns;
+	return ret;
+}
+
+/**
+* Enable or disable the engine mixer.
+*/
+void BON_Sfx_EnableEngineMixer(bool enable)
+{
+	bon::_GetEngine().Sfx().EnableEngineMixer(enable);
+}
+
+/**
+* Get if engine mixer is enabled.
+*/
+bool BON_Sfx_IsEngineMixerEnabled()
+{
+	return bon::_GetEngine().Sfx().IsEngineMixerEnabled();
+}
+
+/**
+* Play a sound on an engine mixer bus.
+*/
+int BON_Sfx_PlaySoundOnBus(bon::assets::SoundAsset* sound, BON_MixerBus bus, int volume, int loops, float pan)
+{
+	return bon::_GetEngine().Sfx().PlaySoundOnBus(*sound, (bon::MixerBus)bus, volume, loops, pan);
+}
+
+/**
+* Stop a sound playing on engine mixer.
+*/
+void BON_Sfx_StopMixerVoice(int voice)
+{
+	bon::_GetEngine().Sfx().StopMixerVoice(voice);
+}
+
+/**
+* Set engine mixer bus volume.
+*/
+void BON_Sfx_SetBusVolume(BON_MixerBus bus, float volume)
+{
+	bon::_GetEngine().Sfx().SetBusVolume((bon::MixerBus)bus, volume);
+}
+
+/**
+* Set engine mixer bus low-pass filter.
+*/
+void BON_Sfx_SetBusLowPass(BON_MixerBus bus, float cutoff)
+{
+	bon::_GetEngine().Sfx().SetBusLowPass((bon::MixerBus)bus, cutoff);
+}
+
+/**
+* Set engine mixer bus ducking.
+*/
+void BON_Sfx_SetBusDucking(BON_MixerBus bus, BON_MixerBus trigger, float amount, float attack, float release)
+{
+	bon::_GetEngine().Sfx().SetBusDucking((bon::MixerBus)bus, (bon::MixerBus)trigger, amount, attack, release);
+}
+
+/**
+* Get engine mixer stats.
+*/
+BON_MixerStats BON_Sfx_GetMixerStats()
+{
+	bon::MixerStats stats = bon::_GetEngine().Sfx().GetMixerStats();
+	BON_MixerStats ret;
+	ret.Callbacks = (int64_t)stats.Callbacks;
+	ret.LastCallbackMs = stats.LastCallbackMs;
+	ret.AverageCallbackMs = stats.AverageCallbackMs;
+	ret.MaxCallbackMs = stats.MaxCallbackMs;
+	ret.Load = stats.Load;
+	ret.ActiveVoices = stats.ActiveVoices;
+	ret.DroppedCommands = (int64_t)stats.DroppedCommands;
+	return ret;
+}
+
+/**
+* Set listener position, for positional sounds.
+*/
+void BON_Sfx_SetListenerPosition(float x, float y)
+{
+	bon::_GetEngine().Sfx().SetListenerPosition(bon::PointF(x, y));
+}
+
+/**
+* Set positional sounds settings.
+*/
+void BON_Sfx_SetSpatialSettings(BON_AttenuationCurve curve, float minDistance, float maxDistance, float rolloff, float panDistance)
+{
+	bon::SpatialSettings settings;
+	settings.Curve = (bon::AttenuationCurve)curve;
+	settings.MinDistance = minDistance;
+	settings.MaxDistance = maxDistance;
+	settings.Rolloff = rolloff;
+	settings.PanDistance = panDistance;
+	bon::_GetEngine().Sfx().SetSpatialSettings(settings);
+}
+
+/**
+* Play a positional sound.
+*/
+int BON_Sfx_PlaySoundAt(bon::assets::SoundAsset* sound, float x, float y, int volume, int loops, float pitch)
+{
+	return bon::_GetEngine().Sfx().PlaySoundAt(*sound, bon::PointF(x, y), volume, loops, pitch);
+}
+
+/**
+* Set positional sound position.
+*/
+void BON_Sfx_SetEmitterPosition(int emitter, float x, float y)
+{
+	bon::_GetEngine().Sfx().SetEmitterPosition(emitter, bon::PointF(x, y));
+}
+
+/**
+* Set positional sound volume.
+*/
+void BON_Sfx_SetEmitterVolume(int emitter, int volume)
+{
+	bon::_GetEngine().Sfx().SetEmitterVolume(emitter, volume);
+}
+
+/**
+* Stop a positional sound.
+*/
+void BON_Sfx_StopEmitter(int emitter)
+{
+	bon::_GetEngine().Sfx().StopEmitter(emitter);
+}
+
+/**
+* Get if a positional sound is still playing.
+*/
+bool BON_Sfx_IsEmitterPlaying(int emitter)
+{
+	return bon::_GetEngine().Sfx().IsEmitterPlaying(emitter);
+}
+
+/**
+* Get if a positional sound is virtual.
+*/
+bool BON_Sfx_IsEmitterVirtual(int emitter)
+{
+	return bon::_GetEngine().Sfx().IsEmitterVirtual(emitter);
 }
\ No newline at end of file
@@ -26,6 +26,7 @@ int main()
 	std::cout << " 17: Effects demo (light scene)\n";
 	std::cout << " 18: Rotation & Origin\n";
 	std::cout << " 19: Texts\n";
+	std::cout << " 20: Benchmarks\n";
 	std::cout << "Your choice: ";
 
 	int demoNumber = -1;
@@ -114,6 +115,10 @@ int main()
 			demo19_texts::main();
 			break;
 
+		case 20:
+			demo20_benchmarks::main();
+			break;
+
 		default:
 			gotValidInput = false;
 			break;
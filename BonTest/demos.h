@@ -149,6 +149,14 @@ namespace demo18_rotation
  * Demo 19 - texts.
  */
 namespace demo19_texts
+{
+	void main();
+}
+
+/**
+ * Demo 20 - benchmarks.
+ */
+namespace demo20_benchmarks
 {
 	void main();
 }
\ No newline at end of file
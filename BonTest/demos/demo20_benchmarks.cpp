@@ -0,0 +1,438 @@
+#include "../demos.h"
+#include "../../BonEngine/inc/BonEngine.h"
+#include "utils/Benchmark.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <fstream>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+
+namespace demo20_benchmarks
+{
+	/**
+	 * Micro-benchmarks for engine internals.
+	 * Runs all benchmarks on start and show results on screen (and in console).
+	 * Optimized paths are compared against a baseline: the slower API, or the old implementation reproduced here.
+	 */
+	class BenchmarksScene : public bon::engine::Scene
+	{
+	private:
+		// default font
+		bon::FontAsset _font;
+
+		// measures benchmarks and holds results to show
+		Benchmark _benchmark;
+
+	public:
+		// on scene load
+		virtual void _Load() override
+		{
+			if (IsFirstScene())
+				Game().LoadConfig("../TestAssets/config.ini");
+		}
+
+		// on scene start
+		virtual void _Start() override
+		{
+			_font = Assets().LoadFont("../TestAssets/gfx/OpenSans-Regular.ttf", 36);
+
+			// disable debug logs while measuring, they would be most of what we measure
+			auto prevLogLevel = Log().GetLevel();
+			Log().SetLevel(bon::LogLevel::Warn);
+
+			// count allocations of every benchmark, to spot hot paths that allocate
+			Diagnostics().EnableAllocationTracker(true);
+
+			// run benchmarks
+			BenchmarkCachedLoadImage();
+			BenchmarkConfigLookups();
+			BenchmarkSpriteAnimations();
+			CheckBakedSpriteSheet();
+			BenchmarkInputActions();
+			BenchmarkLogging();
+			BenchmarkResampler();
+			BenchmarkSoundStream();
+			BenchmarkMixer();
+
+			// restore log level and stop tracking allocations
+			Diagnostics().EnableAllocationTracker(false);
+			Log().SetLevel(prevLogLevel);
+		}
+
+		// measure loading images that are already in cache, compared to the old cache lookup path
+		void BenchmarkCachedLoadImage()
+		{
+			const int iterations = 100000;
+			const char* path = "../TestAssets/gfx/gnu.png";
+
+			// load once to make sure its in cache
+			bon::ImageAsset image = Assets().LoadImage(path);
+
+			// baseline: old lookup path - check file exists, build a string key, take exclusive lock and find by string
+			std::unordered_map<std::string, bon::ImageAsset> oldCache;
+			std::mutex oldCacheMutex;
+			oldCache[std::string(path) + std::to_string((int)bon::ImageFilterMode::Nearest)] = image;
+			double baseline = _benchmark.Run("Cached LoadImage() old lookup path (baseline)", iterations, [&](int) {
+				std::ifstream exists(path);
+				std::string key = std::string(path) + std::to_string((int)bon::ImageFilterMode::Nearest);
+				std::lock_guard<std::mutex> guard(oldCacheMutex);
+				bon::ImageAsset fromCache = exists.good() ? oldCache.find(key)->second : nullptr;
+			});
+
+			_benchmark.Run("Cached LoadImage()", iterations, [&](int) {
+				bon::ImageAsset fromCache = Assets().LoadImage(path);
+			}, baseline);
+		}
+
+		// measure reading typed values from config, compared to uncached ini lookup and parsing
+		void BenchmarkConfigLookups()
+		{
+			const int iterations = 100000;
+			bon::ConfigAsset config = Assets().LoadConfig("../TestAssets/config.ini");
+
+			// baseline: old path - get string from ini and parse it on every read
+			double baseline = _benchmark.Run("Config GetPointF() uncached (baseline)", iterations, [&](int) {
+				std::string asStr = config->Handle()->GetStr("gfx", "resolution", "0,0");
+				bon::PointF point(std::stof(asStr.substr(0, asStr.find(','))), std::stof(asStr.substr(asStr.find(',') + 1)));
+			});
+
+			_benchmark.Run("Config GetPointF() by names", iterations, [&](int) {
+				config->GetPointF("gfx", "resolution", bon::PointF::Zero);
+			}, baseline);
+
+			static const bon::assets::ConfigKey key("gfx", "resolution");
+			_benchmark.Run("Config GetPointF() by ConfigKey", iterations, [&](int) {
+				config->GetPointF(key, bon::PointF::Zero);
+			}, baseline);
+		}
+
+		// measure animating many sprites, compared to getting animation by name and animating it on every call
+		void BenchmarkSpriteAnimations()
+		{
+			const int spritesCount = 50000;
+			bon::gfx::SpriteSheet sheet(Assets().LoadConfig("../TestAssets/gfx/player_spritesheet.ini"));
+			std::vector<bon::gfx::Sprite> sprites(spritesCount, bon::gfx::Sprite(Assets().LoadImage("../TestAssets/gfx/player.png"), bon::PointF::Zero));
+
+			// baseline: old path - find animation by string key and copy its pointer for every sprite
+			std::vector<double> progress(spritesCount, 0.0);
+			double baseline = _benchmark.Run("Animate 50k sprites old lookup path (baseline)", spritesCount, [&](int i) {
+				bon::gfx::SpriteAnimationPtr animation = sheet.GetAnimation("walk");
+				bon::PointI index;
+				animation->Animate(progress[i], 0.016 + i * 0.00001, index);
+				sheet.SetSprite(sprites[i], index);
+			});
+
+			// animate by name
+			std::fill(progress.begin(), progress.end(), 0.0);
+			_benchmark.Run("Animate 50k sprites by name", spritesCount, [&](int i) {
+				sheet.Animate(sprites[i], "walk", progress[i], 0.016 + i * 0.00001);
+			}, baseline);
+
+			// animate by handle
+			std::vector<bon::gfx::AnimationState> states(spritesCount, bon::gfx::AnimationState(sheet.GetAnimationHandle("walk")));
+			_benchmark.Run("Animate 50k sprites by handle", spritesCount, [&](int i) {
+				sheet.Animate(sprites[i], states[i], 0.016 + i * 0.00001);
+			}, baseline);
+		}
+
+		// check that a baked spritesheet loads back with the same animations, including animations without steps
+		void CheckBakedSpriteSheet()
+		{
+			const char* bakedPath = "benchmark_spritesheet.bsheet";
+			bon::gfx::SpriteSheet sheet(Assets().LoadConfig("../TestAssets/gfx/player_spritesheet.ini"));
+			sheet.AddAnimation(bon::gfx::SpriteAnimationPtr(new bon::gfx::SpriteAnimation("empty")));
+
+			bool ok = false;
+			if (sheet.Bake(bakedPath))
+			{
+				try
+				{
+					bon::gfx::SpriteSheet loaded;
+					loaded.LoadFromBaked(bakedPath);
+					ok = loaded.ContainsAnimation("walk") && loaded.ContainsAnimation("empty") &&
+						loaded.GetAnimationHandle("empty") == sheet.GetAnimationHandle("empty") &&
+						loaded.GetAnimation("empty")->StepsCount() == 0 &&
+						loaded.GetAnimation("walk")->StepsCount() == sheet.GetAnimation("walk")->StepsCount();
+				}
+				catch (const bon::framework::AssetLoadError&) {}
+			}
+			std::remove(bakedPath);
+			_benchmark.AddLine(std::string("Baked spritesheet round-trip (with empty animation): ") + (ok ? "OK." : "FAILED!"));
+		}
+
+		// measure querying input actions by action id, compared to by action name
+		void BenchmarkInputActions()
+		{
+			const int iterations = 100000;
+			int downCount = 0;
+
+			double baseline = _benchmark.Run("Input Down() by action name (baseline)", iterations, [&](int) {
+				if (Input().Down("exit")) { downCount++; }
+			});
+
+			bon::ActionId exitAction = Input().GetActionId("exit");
+			_benchmark.Run("Input Down() by action id", iterations, [&](int) {
+				if (Input().Down(exitAction)) { downCount++; }
+			}, baseline);
+		}
+
+		// measure writing log messages asynchronously, compared to synchronously
+		void BenchmarkLogging()
+		{
+			const int iterations = 20000;
+			auto prevLogLevel = Log().GetLevel();
+			Log().SetLevel(bon::LogLevel::Debug);
+
+			// write synchronously
+			double baseline = _benchmark.Run("Sync log Write() (baseline)", iterations, [&](int i) {
+				Log().Write(bon::LogLevel::Debug, "Benchmark message %d, value: %f, name: %s.", i, i * 0.5f, "sync");
+			});
+
+			// write asynchronously, with a queue big enough to never block
+			Log().SetAsync(true, bon::LogOverflowPolicy::Block, iterations);
+			_benchmark.Run("Async log Write()", iterations, [&](int i) {
+				Log().Write(bon::LogLevel::Debug, "Benchmark message %d, value: %f, name: %s.", i, i * 0.5f, "async");
+			}, baseline);
+
+			// wait for background thread to write everything
+			double ms = _benchmark.Measure([this]() {
+				Log().Flush();
+			});
+			_benchmark.AddResult("Async log Flush() after writes", iterations, ms);
+			Log().SetAsync(false);
+
+			// log macros of a filtered out level, should cost a single branch
+			Log().SetLevel(bon::LogLevel::Warn);
+			_benchmark.Run("Filtered out BON_DLOG()", iterations, [](int i) {
+				BON_DLOG("Benchmark message %d, value: %f, name: %s.", i, i * 0.5f, "filtered");
+			}, baseline);
+			Log().SetLevel(prevLogLevel);
+		}
+
+		// reference resampling of a single looped 16 bit sample, in double precision
+		static double ReferenceResample(const std::vector<int16_t>& source, int channels, int channel, uint64_t position, bon::ResamplerQuality quality)
+		{
+			long long frames = (long long)source.size() / channels;
+			long long frame = (long long)(position >> 32);
+			double f = (double)(uint32_t)position / 4294967296.0;
+			auto sample = [&](long long index) { return (double)source[(size_t)(((index % frames) + frames) % frames) * channels + channel]; };
+			double p0 = sample(frame - 1), p1 = sample(frame), p2 = sample(frame + 1), p3 = sample(frame + 2);
+			if (quality == bon::ResamplerQuality::Linear) {
+				return p1 + (p2 - p1) * f;
+			}
+			return p1 + 0.5 * f * (p2 - p0 + f * (2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3 + f * (3.0 * (p1 - p2) + p3 - p0)));
+		}
+
+		// measure resampling used for sound pitch, and check its accuracy against double precision reference
+		void BenchmarkResampler()
+		{
+			const int iterations = 2000;
+			const int bufferFrames = 1024;
+			const int sourceFrames = 44100;
+			const bon::ResamplerQuality qualities[] = { bon::ResamplerQuality::Linear, bon::ResamplerQuality::Cubic };
+			const char* qualityNames[] = { "linear", "cubic" };
+
+			// create source sound: two sines with some noise, on mono and stereo
+			std::vector<int16_t> sources[2];
+			for (int channels = 1; channels <= 2; ++channels)
+			{
+				for (int i = 0; i < sourceFrames * channels; ++i)
+				{
+					double t = (double)(i / channels) / 44100.0;
+					double value = 12000.0 * sin(t * 440.0 * 6.2831853) + 8000.0 * sin(t * 3000.0 * 6.2831853 + channels) + (double)(rand() % 2000 - 1000);
+					sources[channels - 1].push_back((int16_t)value);
+				}
+			}
+
+			// create full-scale source sound, alternating between min and max values, for worst case interpolation error
+			std::vector<int16_t> fullScaleSources[2];
+			for (int channels = 1; channels <= 2; ++channels)
+			{
+				for (int i = 0; i < sourceFrames * channels; ++i)
+				{
+					fullScaleSources[channels - 1].push_back(((i / channels) % 2) ? 32767 : -32768);
+				}
+			}
+			std::vector<int16_t> out(bufferFrames * 2);
+
+			// check accuracy of all quality, channels and SIMD combinations
+			const float speeds[] = { 0.5f, 0.73f, 1.0f, 1.3f, 1.91f };
+			for (int simd = 0; simd <= 1; ++simd)
+			{
+				bon::Resampler::EnableSimd(simd == 1);
+				for (int q = 0; q < 2; ++q)
+				{
+					double maxError = 0;
+					for (const std::vector<int16_t>* signals : { sources, fullScaleSources })
+					{
+						for (int channels = 1; channels <= 2; ++channels)
+						{
+							const std::vector<int16_t>& source = signals[channels - 1];
+							for (float speed : speeds)
+							{
+								uint64_t step = bon::Resampler::SpeedToStep(speed);
+								uint64_t position = 0;
+								for (int buffer = 0; buffer < 100; ++buffer)
+								{
+									uint64_t start = position;
+									bon::Resampler::Resample(source.data(), sourceFrames, channels, true, out.data(), bufferFrames, position, step, qualities[q]);
+									for (int i = 0; i < bufferFrames; ++i)
+									{
+										uint64_t framePosition = (start + step * i) % ((uint64_t)sourceFrames << 32);
+										for (int c = 0; c < channels; ++c)
+										{
+											double expected = ReferenceResample(source, channels, c, framePosition, qualities[q]);
+											expected = std::max(-32768.0, std::min(32767.0, expected));
+											maxError = std::max(maxError, std::abs(expected - (double)out[i * channels + c]));
+										}
+									}
+								}
+							}
+						}
+					}
+					_benchmark.AddLine(std::string("Resampler accuracy (") + qualityNames[q] + (simd ? ", simd" : ", scalar") + "): max error " + std::to_string(maxError) + " LSB, " + (maxError <= 1.0 ? "OK." : "FAILED!"));
+				}
+			}
+
+			// measure resampling stereo buffers, like the pitch effect does per audio callback (simd compared to scalar baseline)
+			double baselines[2] = { 0, 0 };
+			for (int simd = 0; simd <= 1; ++simd)
+			{
+				bon::Resampler::EnableSimd(simd == 1);
+				for (int q = 0; q < 2; ++q)
+				{
+					uint64_t position = 0;
+					uint64_t step = bon::Resampler::SpeedToStep(1.3f);
+					std::string name = std::string("Resample 1024 stereo frames (") + qualityNames[q] + (simd ? ", simd)" : ", scalar, baseline)");
+					double ms = _benchmark.Run(name.c_str(), iterations, [&](int) {
+						bon::Resampler::Resample(sources[1].data(), sourceFrames, 2, true, out.data(), bufferFrames, position, step, qualities[q]);
+					}, baselines[q]);
+					if (!simd) { baselines[q] = ms; }
+				}
+			}
+			bon::Resampler::EnableSimd(true);
+		}
+
+		// measure incremental decoding of a streamed sound from memory, like the streaming thread does
+		void BenchmarkSoundStream()
+		{
+			const int seconds = 10;
+			const int frequency = 44100;
+			const int blockFrames = 4096;
+
+			// build a 16 bit stereo wav file in memory
+			int dataSize = seconds * frequency * 2 * 2;
+			auto wav = std::make_shared<std::vector<uint8_t>>();
+			auto write32 = [&](uint32_t value) { for (int i = 0; i < 4; ++i) { wav->push_back((uint8_t)(value >> (i * 8))); } };
+			auto write16 = [&](uint16_t value) { wav->push_back((uint8_t)value); wav->push_back((uint8_t)(value >> 8)); };
+			auto writeTag = [&](const char* tag) { wav->insert(wav->end(), tag, tag + 4); };
+			writeTag("RIFF"); write32(36 + dataSize); writeTag("WAVE");
+			writeTag("fmt "); write32(16); write16(1); write16(2); write32(frequency); write32(frequency * 4); write16(4); write16(16);
+			writeTag("data"); write32(dataSize);
+			for (int i = 0; i < seconds * frequency; ++i)
+			{
+				int16_t value = (int16_t)(12000.0 * sin((double)i / frequency * 440.0 * 6.2831853));
+				write16((uint16_t)value); write16((uint16_t)value);
+			}
+
+			// decode whole sound in blocks, looping once
+			std::vector<int16_t> block(blockFrames * 2);
+			auto decoder = bon::SoundStreams::CreateDecoder("wav", bon::StreamSource::FromMemory(wav));
+			int blocks = 0;
+			double ms = _benchmark.Measure([&]() {
+				for (int pass = 0; pass < 2; ++pass)
+				{
+					while (decoder->Read(block.data(), blockFrames) == blockFrames) { blocks++; }
+					decoder->Rewind();
+				}
+			});
+			_benchmark.AddResult("Stream decode 4096 stereo frames (wav)", blocks, ms);
+
+			// compare fully decoded size to what streaming keeps resident (ring of 4 chunks plus decode buffer)
+			size_t decodedBytes = (size_t)decoder->TotalFrames() * 4;
+			size_t residentBytes = (size_t)blockFrames * 4 * 4 + block.size() * sizeof(int16_t);
+			_benchmark.AddLine("Stream " + std::to_string(seconds) + " seconds sound: " + std::to_string(decodedBytes) + " bytes fully decoded, ~" + std::to_string(residentBytes) + " bytes resident while streaming.");
+		}
+
+		// benchmark engine mixer, by mixing into memory (no audio device needed)
+		void BenchmarkMixer()
+		{
+			const int frequency = 44100;
+			const int frames = 1024;
+			const int voicesCount = 64;
+			const int callbacks = 200;
+
+			// a 1 second 16 bit stereo source
+			std::vector<int16_t> samples(frequency * 2);
+			for (int i = 0; i < frequency; ++i)
+			{
+				int16_t value = (int16_t)(2000.0 * sin((double)i / frequency * 440.0 * 6.2831853));
+				samples[i * 2] = samples[i * 2 + 1] = value;
+			}
+			bon::MixerSource source;
+			source.Data = samples.data();
+			source.Frames = frequency;
+			source.Channels = 2;
+
+			// play looping voices on all buses, with low-pass and ducking enabled
+			bon::Mixer mixer(frequency, 2);
+			mixer.SetBusLowPass(bon::MixerBus::Music, 2000.0f);
+			mixer.SetBusDucking(bon::MixerBus::Music, bon::MixerBus::Voice, 0.5f);
+			for (int i = 0; i < voicesCount; ++i) {
+				mixer.Play(source, (bon::MixerBus)(1 + i % 4), 0.5f, (float)(i % 3) - 1.0f, -1);
+			}
+
+			// mix callbacks into memory
+			std::vector<float> out(frames * 2);
+			_benchmark.Run("Engine mixer 1024 frames, 64 voices", callbacks, [&](int) {
+				mixer.Mix(out.data(), frames);
+			});
+
+			// report load relative to real time
+			bon::MixerStats stats = mixer.GetStats();
+			_benchmark.AddLine("Engine mixer: avg " + std::to_string(stats.AverageCallbackMs) + " ms, max " + std::to_string(stats.MaxCallbackMs) +
+				" ms per callback, load " + std::to_string((int)(stats.Load * 100.0)) + "% of real time.");
+		}
+
+		// per-frame update
+		virtual void _Update(double deltaTime) override
+		{
+			// exit up
+			if (Input().Down("exit")) { Game().Exit(); }
+		}
+
+		// drawing
+		virtual void _Draw() override
+		{
+			// clear screen
+			Gfx().ClearScreen(bon::Color::Black);
+
+			// draw title and results
+			Gfx().DrawText(_font, "Demo #20: Benchmarks", bon::PointF(20, 20), &bon::Color::White, 30);
+			float y = 80;
+			for (auto& result : _benchmark.Results())
+			{
+				Gfx().DrawText(_font, result.c_str(), bon::PointF(20, y), &bon::Color::White, 18);
+				y += 30;
+			}
+			Gfx().DrawText(_font, "Hit escape to exit.", bon::PointF(20, y + 20), &bon::Color::White, 18);
+
+#if _DEBUG
+			Gfx().DrawText(_font, "Warning - Debug Mode [slower]", bon::PointF(10, 530), &bon::Color::Red, 30);
+#endif
+		}
+	};
+
+	/**
+	 * Init demo.
+	 */
+	void main()
+	{
+		auto scene = BenchmarksScene();
+		bon::Start(scene);
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "../../../BonEngine/inc/BonEngine.h"
+#include <vector>
+#include <string>
+#include <chrono>
+#include <iostream>
+
+/**
+ * Measure and report micro-benchmarks, so all benchmarks in demos are measured and reported the same way.
+ * Results are printed to console and kept as text lines to show on screen.
+ */
+class Benchmark
+{
+private:
+	// results lines
+	std::vector<std::string> _results;
+
+	// heap allocations made during last Measure() call
+	uint64_t _lastAllocations = 0;
+
+public:
+	/**
+	 * Run a function once and return how long it took, in milliseconds.
+	 * Also counts the heap allocations it made, if allocation tracker is enabled.
+	 */
+	template <class Func>
+	double Measure(Func func)
+	{
+		bool trackAllocations = bon::AllocationTracker::IsEnabled();
+		if (trackAllocations) { bon::AllocationTracker::BeginNoAllocations(); }
+		auto start = std::chrono::high_resolution_clock::now();
+		func();
+		auto end = std::chrono::high_resolution_clock::now();
+		_lastAllocations = trackAllocations ? bon::AllocationTracker::EndNoAllocations(false) : 0;
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+	/**
+	 * Call a function with iteration index for given number of iterations, and add its result.
+	 *
+	 * \param name Benchmark name.
+	 * \param iterations How many times to call func.
+	 * \param func Function to call, gets iteration index.
+	 * \param baselineMs If not 0, will also report speedup compared to this baseline total time.
+	 * \return Total time, in milliseconds.
+	 */
+	template <class Func>
+	double Run(const char* name, int iterations, Func func, double baselineMs = 0)
+	{
+		double ms = Measure([&]() {
+			for (int i = 0; i < iterations; ++i) {
+				func(i);
+			}
+		});
+		AddResult(name, iterations, ms, baselineMs);
+		return ms;
+	}
+
+	/**
+	 * Add result of a measured benchmark (using allocations count from last Measure() call).
+	 *
+	 * \param name Benchmark name.
+	 * \param iterations How many iterations were measured.
+	 * \param totalMs Total measured time, in milliseconds.
+	 * \param baselineMs If not 0, will also report speedup compared to this baseline total time.
+	 */
+	void AddResult(const char* name, int iterations, double totalMs, double baselineMs = 0)
+	{
+		std::string result = std::string(name) + ": " + std::to_string(iterations) + " iterations, " +
+			std::to_string(totalMs) + " ms total, " + std::to_string(totalMs * 1000000.0 / iterations) + " ns per iteration, " +
+			std::to_string((double)_lastAllocations / iterations) + " allocations per iteration.";
+		if (baselineMs > 0 && totalMs > 0) {
+			result += " x" + std::to_string(baselineMs / totalMs) + " vs baseline.";
+		}
+		AddLine(result);
+	}
+
+	/**
+	 * Add a free text result line.
+	 */
+	void AddLine(const std::string& line)
+	{
+		std::cout << line << std::endl;
+		_results.push_back(line);
+	}
+
+	/**
+	 * Get all results lines.
+	 */
+	const std::vector<std::string>& Results() const { return _results; }
+};
@@ -0,0 +1,86 @@
+"""
+Generate the key names perfect hash table in BonEngine/src/Input/Defs.cpp.
+Run this after adding, removing or reordering key codes (Defs.cpp static_assert fails if table is out of date).
+Table is generated offline and not at compile time, because searching for displacements takes too many constexpr steps for MSVC.
+"""
+import re
+
+# source file and markers of generated table
+DEFS_PATH = "BonEngine/src/Input/Defs.cpp"
+BEGIN_MARKER = "// generated by create_key_names_table.py - begin"
+END_MARKER = "// generated by create_key_names_table.py - end"
+
+# must match KeyNamesSlotsCount and KeyNamesBucketsCount in Defs.cpp
+SLOTS_COUNT = 512
+BUCKETS_COUNT = 128
+
+
+def hash_key_name(name, seed):
+    """
+    Hash a key name, same as HashKeyName() in Defs.cpp (FNV-1a with seed).
+    """
+    hash = (2166136261 ^ ((seed * 16777619) & 0xFFFFFFFF)) & 0xFFFFFFFF
+    for c in name.encode('ascii'):
+        hash = ((hash ^ c) * 16777619) & 0xFFFFFFFF
+    return hash ^ (hash >> 15)
+
+
+def build_table(names):
+    """
+    Build perfect hash table: returns (displacements, slots).
+    Buckets are placed from biggest to smallest, finding for each a displacement that puts all its names in free and different slots.
+    """
+    slots = [-1] * SLOTS_COUNT
+    displacements = [0] * BUCKETS_COUNT
+    buckets = [[] for _ in range(BUCKETS_COUNT)]
+    for i, name in enumerate(names):
+        buckets[hash_key_name(name, 0) % BUCKETS_COUNT].append(i)
+
+    for size in range(max(len(b) for b in buckets), 0, -1):
+        for bucket in range(BUCKETS_COUNT):
+            if len(buckets[bucket]) != size:
+                continue
+            displacement = 1
+            while True:
+                wanted = [hash_key_name(names[i], displacement) & (SLOTS_COUNT - 1) for i in buckets[bucket]]
+                if len(set(wanted)) == len(wanted) and all(slots[s] == -1 for s in wanted):
+                    for i, s in zip(buckets[bucket], wanted):
+                        slots[s] = i
+                    displacements[bucket] = displacement
+                    break
+                displacement += 1
+    return displacements, slots
+
+
+def format_array(values, per_line, indent):
+    """
+    Format values as lines of a C array initializer.
+    """
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+if __name__ == "__main__":
+
+    # read key names, in key codes order
+    with open(DEFS_PATH, 'r', newline='') as f:
+        source = f.read()
+    names = re.findall(r"BON_KEY_NAME\((\w+)\),", source)
+
+    # build table and generate code
+    displacements, slots = build_table(names)
+    code = (BEGIN_MARKER + "\n" +
+        "\t\tconstexpr KeyNamesTable KeyNames =\n\t\t{\n" +
+        "\t\t\t{\n" + format_array(displacements, 16, "\t\t\t\t") + "\n\t\t\t},\n" +
+        "\t\t\t{\n" + format_array(slots, 32, "\t\t\t\t") + "\n\t\t\t},\n" +
+        "\t\t};\n\t\t" + END_MARKER)
+
+    # replace generated part
+    begin = source.index(BEGIN_MARKER)
+    end = source.index(END_MARKER) + len(END_MARKER)
+    source = source[:begin] + code + source[end:]
+    with open(DEFS_PATH, 'w', newline='') as f:
+        f.write(source)
+    print("Generated key names table for %d key codes." % len(names))